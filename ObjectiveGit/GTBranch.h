@@ -83,6 +83,8 @@ NS_ASSUME_NONNULL_BEGIN
 
 /// Count all commits in this branch
 ///
+/// Uses the repository's `commitCountCache` when it has one.
+///
 /// error(out) - will be filled if an error occurs
 ///
 /// returns number of commits in the branch or NSNotFound if an error occurred
@@ -26,6 +26,7 @@
 #import "GTBranch.h"
 
 #import "GTCommit.h"
+#import "GTCommitCountCache.h"
 #import "GTEnumerator.h"
 #import "GTOID.h"
 #import "GTReference.h"
@@ -134,6 +135,17 @@
 }
 
 - (NSUInteger)numberOfCommitsWithError:(NSError **)error {
+	GTCommitCountCache *cache = self.repository.commitCountCache;
+	if (cache != nil) {
+		GTOID *oid = self.OID;
+		if (oid == nil) {
+			if (error != NULL) *error = GTReference.invalidReferenceError;
+			return NSNotFound;
+		}
+
+		return [cache numberOfCommitsReachableFromOID:oid referenceName:self.reference.name inRepository:self.repository error:error];
+	}
+
 	GTEnumerator *enumerator = [[GTEnumerator alloc] initWithRepository:self.repository error:error];
 	if (enumerator == nil) return NSNotFound;
 
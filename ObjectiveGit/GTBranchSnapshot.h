@@ -0,0 +1,91 @@
+//
+//  GTBranchSnapshot.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "GTBranch.h"
+
+@class GTOID;
+@class GTRepository;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A branch as recorded by a GTBranchSnapshot.
+@interface GTBranchSnapshotEntry : NSObject
+
+/// The full reference name of the branch, like `refs/heads/master`.
+@property (nonatomic, readonly, copy) NSString *name;
+
+/// The name of the branch without its `refs/heads/` or `refs/remotes/` prefix.
+@property (nonatomic, readonly, copy) NSString *shortName;
+
+/// Whether the branch is local or remote.
+@property (nonatomic, readonly, assign) GTBranchType branchType;
+
+/// The commit the branch pointed to when the snapshot was taken.
+@property (nonatomic, readonly, strong) GTOID *OID;
+
+/// The full reference name of the branch's upstream, like
+/// `refs/remotes/origin/master`, or nil if it has none. Only local branches
+/// have upstreams.
+///
+/// The upstream doesn't have to exist.
+@property (nonatomic, readonly, copy) NSString * _Nullable upstreamName;
+
+/// Whether HEAD pointed to the branch when the snapshot was taken.
+@property (nonatomic, readonly, assign, getter=isHEAD) BOOL HEAD;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+/// Every branch of a repository, read at once.
+///
+/// Taking a snapshot iterates the references once and reads the `branch.*`
+/// configuration once, where listing GTBranches and asking each for its
+/// tracking branch reads the configuration for every branch. Lookups by name
+/// are hashed.
+///
+/// Snapshots don't change after they're taken.
+@interface GTBranchSnapshot : NSObject
+
+/// Every branch, local branches first, each sorted by name. Symbolic remote
+/// references, like `refs/remotes/origin/HEAD`, are left out.
+@property (nonatomic, readonly, copy) NSArray<GTBranchSnapshotEntry *> *branches;
+
+/// The local branches, sorted by name.
+@property (nonatomic, readonly, copy) NSArray<GTBranchSnapshotEntry *> *localBranches;
+
+/// The remote branches, sorted by name.
+@property (nonatomic, readonly, copy) NSArray<GTBranchSnapshotEntry *> *remoteBranches;
+
+/// The local branch HEAD pointed to, or nil if HEAD was detached or unborn.
+@property (nonatomic, readonly, strong) GTBranchSnapshotEntry * _Nullable HEADBranch;
+
+/// Takes a snapshot of the branches of the given repository.
+///
+/// repository - The repository to read. Cannot be nil.
+/// error      - The error if one occurred.
+///
+/// Returns the snapshot, or nil if an error occurred.
++ (instancetype _Nullable)branchSnapshotWithRepository:(GTRepository *)repository error:(NSError **)error;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Returns the branch with the given full reference name, or nil if there was
+/// no such branch.
+- (GTBranchSnapshotEntry * _Nullable)branchWithName:(NSString *)name;
+
+/// Returns the upstream of the given branch, or nil if it has none or its
+/// upstream didn't exist.
+- (GTBranchSnapshotEntry * _Nullable)upstreamOfBranch:(GTBranchSnapshotEntry *)branch;
+
+/// Returns the local branches with the given branch as their upstream.
+- (NSArray<GTBranchSnapshotEntry *> *)branchesTrackingBranch:(GTBranchSnapshotEntry *)branch;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,293 @@
+//
+//  GTBranchSnapshot.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTBranchSnapshot.h"
+#import "GTOID.h"
+#import "GTRepository+Private.h"
+#import "NSError+Git.h"
+
+#import "git2/buffer.h"
+#import "git2/config.h"
+#import "git2/errors.h"
+#import "git2/refs.h"
+#import "git2/refspec.h"
+#import "git2/remote.h"
+#import "git2/repository.h"
+
+static NSString * const GTBranchSnapshotLocalPrefix = @"refs/heads/";
+static NSString * const GTBranchSnapshotRemotePrefix = @"refs/remotes/";
+
+@interface GTBranchSnapshotEntry ()
+
+- (instancetype)initWithName:(NSString *)name shortName:(NSString *)shortName branchType:(GTBranchType)branchType OID:(GTOID *)OID upstreamName:(NSString *)upstreamName HEAD:(BOOL)HEAD NS_DESIGNATED_INITIALIZER;
+
+@end
+
+@implementation GTBranchSnapshotEntry
+
+- (instancetype)init {
+	NSAssert(NO, @"Call to an unavailable initializer.");
+	return nil;
+}
+
+- (instancetype)initWithName:(NSString *)name shortName:(NSString *)shortName branchType:(GTBranchType)branchType OID:(GTOID *)OID upstreamName:(NSString *)upstreamName HEAD:(BOOL)HEAD {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_name = [name copy];
+	_shortName = [shortName copy];
+	_branchType = branchType;
+	_OID = OID;
+	_upstreamName = [upstreamName copy];
+	_HEAD = HEAD;
+
+	return self;
+}
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> name: %@, OID: %@, upstreamName: %@, HEAD: %i", self.class, self, self.name, self.OID, self.upstreamName, (int)self.HEAD];
+}
+
+@end
+
+@interface GTBranchSnapshot ()
+
+// Every branch, keyed by full reference name.
+@property (nonatomic, readonly, copy) NSDictionary<NSString *, GTBranchSnapshotEntry *> *branchesByName;
+
+// The local branches tracking each upstream, keyed by the upstream's full
+// reference name.
+@property (nonatomic, readonly, copy) NSDictionary<NSString *, NSArray<GTBranchSnapshotEntry *> *> *trackingBranchesByUpstreamName;
+
+@end
+
+@implementation GTBranchSnapshot
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	NSAssert(NO, @"Call to an unavailable initializer.");
+	return nil;
+}
+
+- (instancetype)initWithLocalBranches:(NSArray *)localBranches remoteBranches:(NSArray *)remoteBranches {
+	self = [super init];
+	if (self == nil) return nil;
+
+	NSSortDescriptor *byName = [NSSortDescriptor sortDescriptorWithKey:@"name" ascending:YES selector:@selector(compare:)];
+	_localBranches = [localBranches sortedArrayUsingDescriptors:@[ byName ]];
+	_remoteBranches = [remoteBranches sortedArrayUsingDescriptors:@[ byName ]];
+	_branches = [_localBranches arrayByAddingObjectsFromArray:_remoteBranches];
+
+	NSMutableDictionary *branchesByName = [NSMutableDictionary dictionaryWithCapacity:_branches.count];
+	NSMutableDictionary *trackingBranchesByUpstreamName = [NSMutableDictionary dictionary];
+	for (GTBranchSnapshotEntry *branch in _branches) {
+		branchesByName[branch.name] = branch;
+		if (branch.HEAD) _HEADBranch = branch;
+
+		if (branch.upstreamName == nil) continue;
+
+		NSMutableArray *trackingBranches = trackingBranchesByUpstreamName[branch.upstreamName];
+		if (trackingBranches == nil) {
+			trackingBranches = [NSMutableArray array];
+			trackingBranchesByUpstreamName[branch.upstreamName] = trackingBranches;
+		}
+		[trackingBranches addObject:branch];
+	}
+
+	_branchesByName = [branchesByName copy];
+	_trackingBranchesByUpstreamName = [trackingBranchesByUpstreamName copy];
+
+	return self;
+}
+
++ (instancetype)branchSnapshotWithRepository:(GTRepository *)repository error:(NSError **)error {
+	NSParameterAssert(repository != nil);
+
+	NSDictionary *upstreamNames = [self upstreamNamesInRepository:repository error:error];
+	if (upstreamNames == nil) return nil;
+
+	NSString *HEADTargetName = nil;
+	git_reference *HEAD = NULL;
+	if (git_reference_lookup(&HEAD, repository.git_repository, "HEAD") == GIT_OK) {
+		if (git_reference_type(HEAD) == GIT_REFERENCE_SYMBOLIC) HEADTargetName = @(git_reference_symbolic_target(HEAD));
+		git_reference_free(HEAD);
+	}
+
+	git_reference_iterator *iterator = NULL;
+	int gitError = git_reference_iterator_new(&iterator, repository.git_repository);
+	if (gitError != GIT_OK) {
+		if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to iterate references"];
+		return nil;
+	}
+
+	NSMutableArray *localBranches = [NSMutableArray array];
+	NSMutableArray *remoteBranches = [NSMutableArray array];
+
+	git_reference *reference = NULL;
+	while ((gitError = git_reference_next(&reference, iterator)) == GIT_OK) {
+		NSString *name = @(git_reference_name(reference));
+		BOOL isLocal = [name hasPrefix:GTBranchSnapshotLocalPrefix];
+		BOOL isRemote = !isLocal && [name hasPrefix:GTBranchSnapshotRemotePrefix];
+
+		git_reference *resolved = NULL;
+		if (git_reference_type(reference) == GIT_REFERENCE_SYMBOLIC) {
+			// Remote HEADs are left out, like -remoteBranchesWithError: does.
+			// Symbolic local branches are rare enough to resolve one at a time.
+			if (isLocal && git_reference_resolve(&resolved, reference) != GIT_OK) isLocal = NO;
+			isRemote = NO;
+		}
+
+		const git_oid *oid = (isLocal || isRemote ? git_reference_target(resolved ?: reference) : NULL);
+		if (oid != NULL) {
+			NSString *shortName = [name substringFromIndex:(isLocal ? GTBranchSnapshotLocalPrefix : GTBranchSnapshotRemotePrefix).length];
+			GTBranchSnapshotEntry *branch = [[GTBranchSnapshotEntry alloc] initWithName:name shortName:shortName branchType:(isLocal ? GTBranchTypeLocal : GTBranchTypeRemote) OID:[repository OIDWithGitOid:oid] upstreamName:(isLocal ? upstreamNames[shortName] : nil) HEAD:(isLocal && [name isEqualToString:HEADTargetName])];
+			[(isLocal ? localBranches : remoteBranches) addObject:branch];
+		}
+
+		git_reference_free(resolved);
+		git_reference_free(reference);
+	}
+
+	git_reference_iterator_free(iterator);
+
+	if (gitError != GIT_ITEROVER) {
+		if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to iterate references"];
+		return nil;
+	}
+
+	return [[self alloc] initWithLocalBranches:localBranches remoteBranches:remoteBranches];
+}
+
+// Reads `branch.<name>.remote` and `branch.<name>.merge` for every branch, and
+// works out their upstreams the way git_branch_upstream_name does.
+//
+// Returns the full reference names of the upstreams, keyed by the short names
+// of the branches, or nil if an error occurred.
++ (NSDictionary<NSString *, NSString *> *)upstreamNamesInRepository:(GTRepository *)repository error:(NSError **)error {
+	git_config *config = NULL;
+	int gitError = git_repository_config_snapshot(&config, repository.git_repository);
+	if (gitError != GIT_OK) {
+		if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to read the repository configuration"];
+		return nil;
+	}
+
+	git_config_iterator *iterator = NULL;
+	gitError = git_config_iterator_glob_new(&iterator, config, "^branch\\..+\\.(remote|merge)$");
+	if (gitError != GIT_OK) {
+		git_config_free(config);
+		if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to read the branch configuration"];
+		return nil;
+	}
+
+	NSMutableDictionary<NSString *, NSString *> *remoteNames = [NSMutableDictionary dictionary];
+	NSMutableDictionary<NSString *, NSString *> *mergeNames = [NSMutableDictionary dictionary];
+
+	git_config_entry *entry = NULL;
+	while (git_config_next(&entry, iterator) == GIT_OK) {
+		// Branch names may contain dots, so the variable is whatever follows
+		// the last one.
+		NSString *key = @(entry->name);
+		NSRange lastDot = [key rangeOfString:@"." options:NSBackwardsSearch];
+		NSString *branchName = [key substringWithRange:NSMakeRange(7, lastDot.location - 7)];
+		NSString *value = @(entry->value);
+		if (branchName.length == 0 || value == nil) continue;
+
+		if ([[key substringFromIndex:NSMaxRange(lastDot)] isEqualToString:@"remote"]) {
+			remoteNames[branchName] = value;
+		} else {
+			mergeNames[branchName] = value;
+		}
+	}
+
+	git_config_iterator_free(iterator);
+	git_config_free(config);
+
+	// Look up each remote once, for all the branches tracking it.
+	NSMutableDictionary<NSString *, NSMutableArray<NSString *> *> *branchNamesByRemoteName = [NSMutableDictionary dictionary];
+	NSMutableDictionary<NSString *, NSString *> *upstreamNames = [NSMutableDictionary dictionary];
+	[mergeNames enumerateKeysAndObjectsUsingBlock:^(NSString *branchName, NSString *mergeName, BOOL *stop) {
+		NSString *remoteName = remoteNames[branchName];
+		if (remoteName == nil) return;
+
+		// "." means the upstream is another local branch.
+		if ([remoteName isEqualToString:@"."]) {
+			upstreamNames[branchName] = mergeName;
+			return;
+		}
+
+		NSMutableArray *branchNames = branchNamesByRemoteName[remoteName];
+		if (branchNames == nil) {
+			branchNames = [NSMutableArray array];
+			branchNamesByRemoteName[remoteName] = branchNames;
+		}
+		[branchNames addObject:branchName];
+	}];
+
+	[branchNamesByRemoteName enumerateKeysAndObjectsUsingBlock:^(NSString *remoteName, NSArray<NSString *> *branchNames, BOOL *stop) {
+		git_remote *remote = NULL;
+		if (git_remote_lookup(&remote, repository.git_repository, remoteName.UTF8String) != GIT_OK) return;
+
+		for (NSString *branchName in branchNames) {
+			NSString *upstreamName = [self upstreamNameOfMergeName:mergeNames[branchName] remote:remote];
+			if (upstreamName != nil) upstreamNames[branchName] = upstreamName;
+		}
+
+		git_remote_free(remote);
+	}];
+
+	return upstreamNames;
+}
+
+// Maps a merge reference on a remote to the remote tracking branch it's
+// fetched into, using the first fetch refspec which matches it.
++ (NSString *)upstreamNameOfMergeName:(NSString *)mergeName remote:(git_remote *)remote {
+	const char *source = mergeName.UTF8String;
+
+	size_t count = git_remote_refspec_count(remote);
+	for (size_t i = 0; i < count; i++) {
+		const git_refspec *refspec = git_remote_get_refspec(remote, i);
+		if (git_refspec_direction(refspec) != GIT_DIRECTION_FETCH) continue;
+		if (!git_refspec_src_matches(refspec, source)) continue;
+
+		git_buf buffer = GIT_BUF_INIT_CONST(0, NULL);
+		if (git_refspec_transform(&buffer, refspec, source) != GIT_OK) return nil;
+
+		NSString *upstreamName = [[NSString alloc] initWithBytes:buffer.ptr length:buffer.size encoding:NSUTF8StringEncoding];
+		git_buf_dispose(&buffer);
+		return upstreamName;
+	}
+
+	return nil;
+}
+
+#pragma mark Lookups
+
+- (GTBranchSnapshotEntry *)branchWithName:(NSString *)name {
+	NSParameterAssert(name != nil);
+	return self.branchesByName[name];
+}
+
+- (GTBranchSnapshotEntry *)upstreamOfBranch:(GTBranchSnapshotEntry *)branch {
+	NSParameterAssert(branch != nil);
+
+	if (branch.upstreamName == nil) return nil;
+	return self.branchesByName[branch.upstreamName];
+}
+
+- (NSArray<GTBranchSnapshotEntry *> *)branchesTrackingBranch:(GTBranchSnapshotEntry *)branch {
+	NSParameterAssert(branch != nil);
+	return self.trackingBranchesByUpstreamName[branch.name] ?: @[];
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> localBranches: %lu, remoteBranches: %lu, HEADBranch: %@", self.class, self, (unsigned long)self.localBranches.count, (unsigned long)self.remoteBranches.count, self.HEADBranch.name];
+}
+
+@end
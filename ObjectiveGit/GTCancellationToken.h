@@ -0,0 +1,33 @@
+//
+//  GTCancellationToken.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Cancels one or more operations.
+///
+/// Pass the same token to every operation which should be cancelled together.
+/// Operations check it from their libgit2 callbacks, and fail with
+/// +cancellationError once it's cancelled. A token can't be reset.
+///
+/// This class is thread safe.
+@interface GTCancellationToken : NSObject
+
+/// Whether -cancel has been called.
+@property (atomic, readonly, assign, getter=isCancelled) BOOL cancelled;
+
+/// The error operations fail with when they're cancelled. Its domain is
+/// NSCocoaErrorDomain and its code NSUserCancelledError.
++ (NSError *)cancellationError;
+
+/// Cancels every operation using the receiver.
+- (void)cancel;
+
+@end
+
+NS_ASSUME_NONNULL_END
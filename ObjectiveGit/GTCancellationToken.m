@@ -0,0 +1,30 @@
+//
+//  GTCancellationToken.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTCancellationToken.h"
+
+@interface GTCancellationToken ()
+
+@property (atomic, readwrite, assign, getter=isCancelled) BOOL cancelled;
+
+@end
+
+@implementation GTCancellationToken
+
++ (NSError *)cancellationError {
+	return [NSError errorWithDomain:NSCocoaErrorDomain code:NSUserCancelledError userInfo:@{ NSLocalizedDescriptionKey: NSLocalizedString(@"The operation was cancelled.", @"") }];
+}
+
+- (void)cancel {
+	self.cancelled = YES;
+}
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> cancelled: %i", self.class, self, (int)self.cancelled];
+}
+
+@end
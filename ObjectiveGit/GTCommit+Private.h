@@ -0,0 +1,40 @@
+//
+//  GTCommit+Private.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTCommit.h"
+#import "git2/odb.h"
+#import "git2/oid.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface GTCommit ()
+
+/// Reads the raw commit from the object database, without parsing it.
+///
+/// The header is parsed the first time a property is accessed, and the
+/// message and signatures are only decoded when they're requested. The commit
+/// is only looked up through libgit2 if its `git_commit` is needed.
+///
+/// oid        - The ID of the commit. Cannot be NULL.
+/// repository - The repository containing the commit. Cannot be nil.
+/// error      - The error if one occurred.
+///
+/// Returns the commit, or nil if it couldn't be read or isn't a commit.
+- (instancetype _Nullable)initLazilyWithGitOid:(const git_oid *)oid inRepository:(GTRepository *)repository error:(NSError **)error;
+
+/// Wraps a raw commit which has already been read, parsing it lazily like
+/// -initLazilyWithGitOid:inRepository:error: does.
+///
+/// rawCommit  - The raw commit, which the receiver takes ownership of. It must
+///              be a commit in `repository`, but may have been read through
+///              another handle on it. Cannot be NULL.
+/// repository - The repository containing the commit. Cannot be nil.
+- (instancetype _Nullable)initWithRawCommit:(git_odb_object *)rawCommit inRepository:(GTRepository *)repository;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -28,10 +28,13 @@
 //
 
 #import "GTCommit.h"
+#import "GTCommit+Private.h"
+#import "GTObject+Private.h"
 #import "GTSignature.h"
 #import "GTTree.h"
 #import "NSError+Git.h"
 #import "GTRepository.h"
+#import "GTRepository+Private.h"
 #import "NSString+Git.h"
 #import "NSDate+GTTimeAdditions.h"
 #import "GTOID.h"
@@ -40,9 +43,78 @@
 #import "git2/commit.h"
 #import "git2/errors.h"
 #import "git2/merge.h"
+#import "git2/odb.h"
+#import "git2/repository.h"
+#import "git2/signature.h"
+
+@interface GTCommit () {
+	// The raw commit, for commits initialized lazily. NULL otherwise.
+	git_odb_object *_rawCommit;
+
+	// The header fields of `_rawCommit`, once parsed. Ranges are byte ranges
+	// into the raw commit.
+	BOOL _parsedRawHeader;
+	git_oid _rawTreeOid;
+	NSData *_rawParentOids;
+	NSRange _rawAuthorRange;
+	NSRange _rawCommitterRange;
+	NSUInteger _rawMessageOffset;
+}
+
+@end
 
 @implementation GTCommit
 
+#pragma mark Lifecycle
+
+- (instancetype)initLazilyWithGitOid:(const git_oid *)oid inRepository:(GTRepository *)repository error:(NSError **)error {
+	NSParameterAssert(oid != NULL);
+	NSParameterAssert(repository != nil);
+
+	git_odb *odb = NULL;
+	git_odb_object *rawCommit = NULL;
+	int gitError = git_repository_odb(&odb, repository.git_repository);
+	if (gitError == GIT_OK) gitError = git_odb_read(&rawCommit, odb, oid);
+	git_odb_free(odb);
+
+	// Match git_object_lookup, which can't find objects of the wrong type.
+	if (gitError == GIT_OK && git_odb_object_type(rawCommit) != GIT_OBJECT_COMMIT) {
+		git_odb_object_free(rawCommit);
+		gitError = GIT_ENOTFOUND;
+	}
+
+	if (gitError != GIT_OK) {
+		if (error != NULL) {
+			char oid_str[GIT_OID_HEXSZ+1];
+			git_oid_tostr(oid_str, sizeof(oid_str), oid);
+			*error = [NSError git_errorFor:gitError description:@"Failed to lookup commit" userInfo:@{GTGitErrorOID: [GTOID oidWithGitOid:oid]} failureReason:@"The commit %s couldn't be found in the repository.", oid_str];
+		}
+		return nil;
+	}
+
+	return [self initWithRawCommit:rawCommit inRepository:repository];
+}
+
+- (instancetype)initWithRawCommit:(git_odb_object *)rawCommit inRepository:(GTRepository *)repository {
+	NSParameterAssert(rawCommit != NULL);
+	NSParameterAssert(git_odb_object_type(rawCommit) == GIT_OBJECT_COMMIT);
+	NSParameterAssert(repository != nil);
+
+	self = [super initWithGitOid:git_odb_object_id(rawCommit) objectType:GTObjectTypeCommit inRepository:repository];
+	if (self == nil) {
+		git_odb_object_free(rawCommit);
+		return nil;
+	}
+
+	_rawCommit = rawCommit;
+
+	return self;
+}
+
+- (void)dealloc {
+	git_odb_object_free(_rawCommit);
+}
+
 - (NSString *)description {
 	return [NSString stringWithFormat:@"<%@: %p>{ SHA: %@, author: %@, message: %@ }", self.class, self, self.SHA, self.author, self.message];
 }
@@ -51,13 +123,109 @@
 	return (git_commit *) self.git_object;
 }
 
+#pragma mark Raw Commits
+
+// Parses the header of `_rawCommit` the first time it's needed.
+- (void)parseRawHeader {
+	@synchronized (self) {
+		if (_parsedRawHeader) return;
+
+		const char *bytes = git_odb_object_data(_rawCommit);
+		const char *end = bytes + git_odb_object_size(_rawCommit);
+
+		NSMutableData *parentOids = [NSMutableData data];
+		_rawAuthorRange = NSMakeRange(NSNotFound, 0);
+		_rawCommitterRange = NSMakeRange(NSNotFound, 0);
+
+		const char *line = bytes;
+		while (line < end && *line != '\n') {
+			const char *lineEnd = memchr(line, '\n', end - line);
+			if (lineEnd == NULL) lineEnd = end;
+
+			size_t length = lineEnd - line;
+			if (length >= 5 + GIT_OID_HEXSZ && memcmp(line, "tree ", 5) == 0) {
+				git_oid_fromstrn(&_rawTreeOid, line + 5, GIT_OID_HEXSZ);
+			} else if (length >= 7 + GIT_OID_HEXSZ && memcmp(line, "parent ", 7) == 0) {
+				git_oid parentOid;
+				if (git_oid_fromstrn(&parentOid, line + 7, GIT_OID_HEXSZ) == GIT_OK) [parentOids appendBytes:&parentOid length:sizeof(parentOid)];
+			} else if (length >= 7 && memcmp(line, "author ", 7) == 0) {
+				_rawAuthorRange = NSMakeRange(line + 7 - bytes, length - 7);
+			} else if (length >= 10 && memcmp(line, "committer ", 10) == 0) {
+				_rawCommitterRange = NSMakeRange(line + 10 - bytes, length - 10);
+			}
+
+			line = lineEnd + 1;
+		}
+
+		// Skip the blank line after the header, then any leading newlines, like
+		// git_commit_message.
+		while (line < end && *line == '\n') line++;
+		_rawMessageOffset = MIN(line, end) - bytes;
+
+		_rawParentOids = parentOids;
+		_parsedRawHeader = YES;
+	}
+}
+
+- (NSUInteger)rawParentCount {
+	[self parseRawHeader];
+	return _rawParentOids.length / sizeof(git_oid);
+}
+
+- (const git_oid *)rawParentOids {
+	[self parseRawHeader];
+	return _rawParentOids.bytes;
+}
+
+- (void)getRawMessage:(const char **)message length:(size_t *)length {
+	[self parseRawHeader];
+
+	*message = (const char *)git_odb_object_data(_rawCommit) + _rawMessageOffset;
+	*length = git_odb_object_size(_rawCommit) - _rawMessageOffset;
+}
+
+// Parses the signature in the given range of the raw commit. The caller must
+// free the result with git_signature_free.
+- (git_signature *)rawGitSignatureInRange:(NSRange)range {
+	if (range.location == NSNotFound) return NULL;
+
+	// git_signature_from_buffer needs a NUL-terminated string.
+	char *buffer = malloc(range.length + 1);
+	if (buffer == NULL) return NULL;
+
+	memcpy(buffer, (const char *)git_odb_object_data(_rawCommit) + range.location, range.length);
+	buffer[range.length] = '\0';
+
+	git_signature *signature = NULL;
+	if (git_signature_from_buffer(&signature, buffer) != GIT_OK) signature = NULL;
+
+	free(buffer);
+	return signature;
+}
+
+- (GTSignature *)rawSignatureInRange:(NSRange)range {
+	git_signature *signature = [self rawGitSignatureInRange:range];
+	if (signature == NULL) return nil;
+
+	GTSignature *result = [[GTSignature alloc] initWithGitSignature:signature];
+	git_signature_free(signature);
+	return result;
+}
+
 #pragma mark API
 
 - (GTOID *)OID {
-	return [GTOID oidWithGitOid:git_commit_id(self.git_commit)];
+	return [self.repository OIDWithGitOid:self.git_oid];
 }
 
 - (NSString *)message {
+	if (_rawCommit != NULL) {
+		const char *message;
+		size_t length;
+		[self getRawMessage:&message length:&length];
+		return [[NSString alloc] initWithBytes:message length:length encoding:NSUTF8StringEncoding];
+	}
+
 	const char *s = git_commit_message(self.git_commit);
 	if(s == NULL) return nil;
 	return [NSString stringWithUTF8String:s];
@@ -81,11 +249,36 @@
 }
 
 - (NSString *)messageSummary {
+	if (_rawCommit != NULL) {
+		// Only decode the first line.
+		const char *message;
+		size_t length;
+		[self getRawMessage:&message length:&length];
+
+		const char *newline = memchr(message, '\n', length);
+		if (newline != NULL) length = newline - message;
+
+		NSString *firstLine = [[NSString alloc] initWithBytes:message length:length encoding:NSUTF8StringEncoding];
+		NSArray *lineComponents = [firstLine componentsSeparatedByCharactersInSet:[NSCharacterSet newlineCharacterSet]];
+		return lineComponents.count > 0 ? [lineComponents objectAtIndex:0] : @"";
+	}
+
 	NSArray *messageComponents = [self.message componentsSeparatedByCharactersInSet:[NSCharacterSet newlineCharacterSet]];
 	return messageComponents.count > 0 ? [messageComponents objectAtIndex:0] : @"";
 }
 
 - (git_time)commitTime {
+	if (_rawCommit != NULL) {
+		[self parseRawHeader];
+
+		git_signature *committer = [self rawGitSignatureInRange:_rawCommitterRange];
+		if (committer == NULL) return (git_time){ .time = 0, .offset = 0 };
+
+		git_time time = { .time = committer->when.time, .offset = committer->when.offset };
+		git_signature_free(committer);
+		return time;
+	}
+
 	return (git_time){ .time = git_commit_time(self.git_commit), .offset = git_commit_time_offset(self.git_commit) };
 }
 
@@ -98,14 +291,33 @@
 }
 
 - (GTSignature *)author {
+	if (_rawCommit != NULL) {
+		[self parseRawHeader];
+		return [self rawSignatureInRange:_rawAuthorRange];
+	}
+
 	return [[GTSignature alloc] initWithGitSignature:git_commit_author(self.git_commit)];
 }
 
 - (GTSignature *)committer {
+	if (_rawCommit != NULL) {
+		[self parseRawHeader];
+		return [self rawSignatureInRange:_rawCommitterRange];
+	}
+
 	return [[GTSignature alloc] initWithGitSignature:git_commit_committer(self.git_commit)];
 }
 
 - (GTTree *)tree {
+	if (_rawCommit != NULL) {
+		[self parseRawHeader];
+
+		NSError *error = nil;
+		GTTree *tree = [self.repository lookUpObjectByGitOid:&_rawTreeOid objectType:GTObjectTypeTree error:&error];
+		if (tree == nil) NSLog(@"Failed to get tree with error: %@", error);
+		return tree;
+	}
+
 	git_tree *tree = NULL;
 	int gitError = git_commit_tree(&tree, self.git_commit);
 	if (gitError < GIT_OK) {
@@ -118,23 +330,53 @@
 }
 
 - (BOOL)isMerge {
+	if (_rawCommit != NULL) return self.rawParentCount > 1;
+
 	return git_commit_parentcount(self.git_commit) > 1;
 }
 
 - (NSArray <GTOID *> *)parentOIDs {
+	if (_rawCommit != NULL) {
+		NSUInteger numberOfParents = self.rawParentCount;
+		const git_oid *parentOids = self.rawParentOids;
+
+		NSMutableArray <GTOID *> *parents = [NSMutableArray arrayWithCapacity:numberOfParents];
+		for (NSUInteger i = 0; i < numberOfParents; i++) {
+			[parents addObject:[self.repository OIDWithGitOid:&parentOids[i]]];
+		}
+
+		return parents;
+	}
+
 	unsigned numberOfParents = git_commit_parentcount(self.git_commit);
 	NSMutableArray <GTOID *> *parents = [NSMutableArray arrayWithCapacity:numberOfParents];
 
 	for (unsigned i = 0; i < numberOfParents; i++) {
 		const git_oid *parent = git_commit_parent_id(self.git_commit, i);
 
-		[parents addObject:[GTOID oidWithGitOid:parent]];
+		[parents addObject:[self.repository OIDWithGitOid:parent]];
 	}
 
 	return parents;
 }
 
 - (NSArray *)parents {
+	if (_rawCommit != NULL) {
+		// Lazy commits have lazy parents.
+		NSUInteger numberOfParents = self.rawParentCount;
+		const git_oid *parentOids = self.rawParentOids;
+
+		NSMutableArray *parents = [NSMutableArray arrayWithCapacity:numberOfParents];
+		for (NSUInteger i = 0; i < numberOfParents; i++) {
+			GTCommit *parent = [[GTCommit alloc] initLazilyWithGitOid:&parentOids[i] inRepository:self.repository error:NULL];
+			if (parent == nil) continue;
+
+			[parents addObject:parent];
+		}
+
+		return parents;
+	}
+
 	unsigned numberOfParents = git_commit_parentcount(self.git_commit);
 	NSMutableArray *parents = [NSMutableArray arrayWithCapacity:numberOfParents];
 	
@@ -0,0 +1,80 @@
+//
+//  GTCommitCountCache.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@class GTOID;
+@class GTRepository;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A persistent cache of the number of commits reachable from a commit.
+///
+/// Counts are keyed by the tip commit. The cache also remembers the last tip
+/// counted for each reference, so when a reference is fast-forwarded only the
+/// new commits are counted and added to the old count. Anything else falls
+/// back to a full walk.
+///
+/// Only the counts of tips a reference still points to are kept, so a count is
+/// forgotten once its reference moves on. Changes are saved to the file
+/// shortly after they're made, so a pass over many references is saved once.
+///
+/// This class is thread safe.
+@interface GTCommitCountCache : NSObject
+
+/// The file the cache is loaded from and saved to.
+@property (nonatomic, readonly, copy) NSURL *fileURL;
+
+/// The number of counts answered straight from the cache.
+@property (readonly, assign) NSUInteger hitCount;
+
+/// The number of counts computed by extending the count of a previous tip.
+@property (readonly, assign) NSUInteger extensionCount;
+
+/// The number of counts which needed a full walk.
+@property (readonly, assign) NSUInteger fullWalkCount;
+
+/// The default location of the cache file for the given repository, inside its
+/// git directory.
+///
+/// repository - The repository to locate the cache for. Cannot be nil.
++ (NSURL *)defaultFileURLForRepository:(GTRepository *)repository;
+
+/// Returns a cache using the default file for the given repository.
+///
+/// repository - The repository to cache counts for. Cannot be nil.
++ (instancetype)commitCountCacheForRepository:(GTRepository *)repository;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Loads the cache from the given file. Designated initializer.
+///
+/// A missing or unreadable file results in an empty cache.
+///
+/// fileURL - The file to load from and save to. Cannot be nil.
+- (instancetype)initWithFileURL:(NSURL *)fileURL NS_DESIGNATED_INITIALIZER;
+
+/// Counts the commits reachable from the given commit, including itself.
+///
+/// OID           - The tip commit to count from. Cannot be nil.
+/// referenceName - The reference which points to `OID`, if any. Used to find
+///                 a previous count to extend when the reference has moved.
+/// repository    - The repository containing the commit. Cannot be nil.
+/// error         - The error if one occurred.
+///
+/// Returns the number of commits, or NSNotFound if an error occurred.
+- (NSUInteger)numberOfCommitsReachableFromOID:(GTOID *)OID referenceName:(NSString * _Nullable)referenceName inRepository:(GTRepository *)repository error:(NSError **)error;
+
+/// Saves any changes which haven't been saved yet, without waiting.
+- (void)save;
+
+/// Forgets every count, and removes the cache file.
+- (void)removeAllCounts;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,280 @@
+//
+//  GTCommitCountCache.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTCommitCountCache.h"
+
+#import "GTEnumerator.h"
+#import "GTOID.h"
+#import "GTRepository.h"
+
+#import <pthread.h>
+
+// The version written into, and required from, the cache file.
+static const NSInteger GTCommitCountCacheVersion = 1;
+
+// Past this many counts, the counts of tips no reference points to are dropped
+// from memory too. Only their counts are ever saved.
+static const NSUInteger GTCommitCountCacheMaximumCount = 4096;
+
+// How long changes wait to be saved, so a pass over many references is saved
+// once rather than once per count.
+static const NSTimeInterval GTCommitCountCacheSaveDelay = 1;
+
+static NSString * const GTCommitCountCacheVersionKey = @"version";
+static NSString * const GTCommitCountCacheCountsKey = @"counts";
+static NSString * const GTCommitCountCacheTipsKey = @"tips";
+
+@interface GTCommitCountCache () {
+	pthread_mutex_t _lock;
+
+	// Whether there are changes which haven't been saved. Guarded by `_lock`.
+	BOOL _needsSave;
+
+	// Whether a save has been scheduled. Guarded by `_lock`.
+	BOOL _saveScheduled;
+}
+
+// Serializes writes to, and the removal of, the cache file.
+@property (nonatomic, readonly, strong) dispatch_queue_t saveQueue;
+
+// Commit counts, keyed by the SHA of the tip commit. Guarded by `_lock`.
+@property (nonatomic, readonly, strong) NSMutableDictionary<NSString *, NSNumber *> *counts;
+
+// The SHA of the last tip counted for each reference name. Guarded by `_lock`.
+@property (nonatomic, readonly, strong) NSMutableDictionary<NSString *, NSString *> *tips;
+
+@property (readwrite, assign) NSUInteger hitCount;
+@property (readwrite, assign) NSUInteger extensionCount;
+@property (readwrite, assign) NSUInteger fullWalkCount;
+
+@end
+
+@implementation GTCommitCountCache
+
+#pragma mark Lifecycle
+
++ (NSURL *)defaultFileURLForRepository:(GTRepository *)repository {
+	NSParameterAssert(repository != nil);
+
+	return [repository.gitDirectoryURL URLByAppendingPathComponent:@"objective-git/commit-counts" isDirectory:NO];
+}
+
++ (instancetype)commitCountCacheForRepository:(GTRepository *)repository {
+	return [[self alloc] initWithFileURL:[self defaultFileURLForRepository:repository]];
+}
+
+- (instancetype)init {
+	NSAssert(NO, @"Call to an unavailable initializer.");
+	return nil;
+}
+
+- (instancetype)initWithFileURL:(NSURL *)fileURL {
+	NSParameterAssert(fileURL != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_fileURL = [fileURL copy];
+	_counts = [NSMutableDictionary dictionary];
+	_tips = [NSMutableDictionary dictionary];
+	_saveQueue = dispatch_queue_create("org.libgit2.ObjectiveGit.commitCountCache", DISPATCH_QUEUE_SERIAL);
+	pthread_mutex_init(&_lock, NULL);
+
+	[self load];
+
+	return self;
+}
+
+- (void)dealloc {
+	// A scheduled save can't reach the receiver anymore, so it's done here.
+	if (_needsSave) [self writeData:[self lockedSerializedData]];
+
+	pthread_mutex_destroy(&_lock);
+}
+
+#pragma mark Persistence
+
+- (void)load {
+	NSData *data = [NSData dataWithContentsOfURL:self.fileURL];
+	if (data == nil) return;
+
+	NSDictionary *plist = [NSPropertyListSerialization propertyListWithData:data options:NSPropertyListImmutable format:NULL error:NULL];
+	if (![plist isKindOfClass:NSDictionary.class]) return;
+	if (![plist[GTCommitCountCacheVersionKey] isEqual:@(GTCommitCountCacheVersion)]) return;
+
+	NSDictionary *counts = plist[GTCommitCountCacheCountsKey];
+	NSDictionary *tips = plist[GTCommitCountCacheTipsKey];
+	if (![counts isKindOfClass:NSDictionary.class] || ![tips isKindOfClass:NSDictionary.class]) return;
+
+	[counts enumerateKeysAndObjectsUsingBlock:^(id SHA, id count, BOOL *stop) {
+		if (![SHA isKindOfClass:NSString.class] || ![count isKindOfClass:NSNumber.class]) return;
+		self.counts[SHA] = count;
+	}];
+
+	[tips enumerateKeysAndObjectsUsingBlock:^(id name, id SHA, BOOL *stop) {
+		if (![name isKindOfClass:NSString.class] || ![SHA isKindOfClass:NSString.class]) return;
+		if (self.counts[SHA] == nil) return;
+		self.tips[name] = SHA;
+	}];
+}
+
+// Must be called with `_lock` held.
+- (NSData *)lockedSerializedData {
+	NSMutableDictionary *counts = [NSMutableDictionary dictionaryWithCapacity:self.tips.count];
+	for (NSString *SHA in self.tips.objectEnumerator) {
+		counts[SHA] = self.counts[SHA];
+	}
+
+	NSDictionary *plist = @{
+		GTCommitCountCacheVersionKey: @(GTCommitCountCacheVersion),
+		GTCommitCountCacheCountsKey: counts,
+		GTCommitCountCacheTipsKey: [self.tips copy],
+	};
+
+	return [NSPropertyListSerialization dataWithPropertyList:plist format:NSPropertyListBinaryFormat_v1_0 options:0 error:NULL];
+}
+
+- (void)writeData:(NSData *)data {
+	// The cache only saves work, so failing to save it isn't worth reporting.
+	NSURL *URL = self.fileURL;
+	if (![NSFileManager.defaultManager createDirectoryAtURL:URL.URLByDeletingLastPathComponent withIntermediateDirectories:YES attributes:nil error:NULL]) return;
+	[data writeToURL:URL options:NSDataWritingAtomic error:NULL];
+}
+
+// Must be called with `_lock` held.
+- (void)lockedScheduleSave {
+	_needsSave = YES;
+	if (_saveScheduled) return;
+
+	_saveScheduled = YES;
+
+	__weak GTCommitCountCache *weakSelf = self;
+	dispatch_after(dispatch_time(DISPATCH_TIME_NOW, (int64_t)(GTCommitCountCacheSaveDelay * NSEC_PER_SEC)), self.saveQueue, ^{
+		[weakSelf writeChanges];
+	});
+}
+
+// Must be called on `saveQueue`.
+- (void)writeChanges {
+	pthread_mutex_lock(&_lock);
+	_saveScheduled = NO;
+	NSData *data = (_needsSave ? [self lockedSerializedData] : nil);
+	_needsSave = NO;
+	pthread_mutex_unlock(&_lock);
+
+	if (data != nil) [self writeData:data];
+}
+
+- (void)save {
+	dispatch_sync(self.saveQueue, ^{
+		[self writeChanges];
+	});
+}
+
+- (void)removeAllCounts {
+	dispatch_sync(self.saveQueue, ^{
+		pthread_mutex_lock(&_lock);
+		[self.counts removeAllObjects];
+		[self.tips removeAllObjects];
+		_needsSave = NO;
+		pthread_mutex_unlock(&_lock);
+
+		[NSFileManager.defaultManager removeItemAtURL:self.fileURL error:NULL];
+	});
+}
+
+// Points `referenceName` at `SHA`, and forgets the count of the tip it pointed
+// to if no other reference points there.
+//
+// Must be called with `_lock` held.
+- (void)lockedSetTip:(NSString *)SHA forReferenceName:(NSString *)referenceName {
+	NSString *previousSHA = self.tips[referenceName];
+	self.tips[referenceName] = SHA;
+
+	if (previousSHA != nil && ![previousSHA isEqualToString:SHA] && ![self.tips.allValues containsObject:previousSHA]) {
+		[self.counts removeObjectForKey:previousSHA];
+	}
+
+	[self lockedScheduleSave];
+}
+
+#pragma mark Counting
+
+- (NSUInteger)numberOfCommitsReachableFromOID:(GTOID *)OID referenceName:(NSString *)referenceName inRepository:(GTRepository *)repository error:(NSError **)error {
+	NSParameterAssert(OID != nil);
+	NSParameterAssert(repository != nil);
+
+	NSString *SHA = OID.SHA;
+
+	pthread_mutex_lock(&_lock);
+	NSNumber *cachedCount = self.counts[SHA];
+	NSString *previousSHA = (referenceName != nil ? self.tips[referenceName] : nil);
+	NSNumber *previousCount = (previousSHA != nil ? self.counts[previousSHA] : nil);
+	BOOL tipMoved = (referenceName != nil && ![previousSHA isEqualToString:SHA]);
+	if (cachedCount != nil) {
+		self.hitCount++;
+		if (tipMoved) [self lockedSetTip:SHA forReferenceName:referenceName];
+	}
+	pthread_mutex_unlock(&_lock);
+
+	if (cachedCount != nil) return cachedCount.unsignedIntegerValue;
+
+	// Walks happen outside the lock, so concurrent callers counting the same
+	// tip may both walk. They'll agree on the result.
+	NSUInteger count = NSNotFound;
+	if (previousCount != nil) {
+		count = [self countByExtendingCount:previousCount.unsignedIntegerValue ofOID:[[GTOID alloc] initWithSHA:previousSHA] toOID:OID inRepository:repository];
+	}
+
+	BOOL extended = (count != NSNotFound);
+	if (!extended) {
+		GTEnumerator *enumerator = [[GTEnumerator alloc] initWithRepository:repository error:error];
+		if (enumerator == nil) return NSNotFound;
+		if (![enumerator pushSHA:SHA error:error]) return NSNotFound;
+
+		count = [enumerator countRemainingObjects:error];
+		if (count == NSNotFound) return NSNotFound;
+	}
+
+	pthread_mutex_lock(&_lock);
+	if (extended) {
+		self.extensionCount++;
+	} else {
+		self.fullWalkCount++;
+	}
+	self.counts[SHA] = @(count);
+	if (referenceName != nil) [self lockedSetTip:SHA forReferenceName:referenceName];
+
+	// Counts of tips no reference points to aren't saved, so they're only
+	// kept in memory while there's room.
+	if (self.counts.count > GTCommitCountCacheMaximumCount) {
+		NSSet *referencedSHAs = [NSSet setWithArray:self.tips.allValues];
+		for (NSString *countedSHA in self.counts.allKeys) {
+			if (![referencedSHAs containsObject:countedSHA]) [self.counts removeObjectForKey:countedSHA];
+		}
+	}
+	pthread_mutex_unlock(&_lock);
+
+	return count;
+}
+
+// Adds the number of commits in `previousOID..OID` to `previousCount`.
+//
+// Returns NSNotFound if `previousOID` isn't an ancestor of `OID`, e.g. after a
+// force push, or if it's gone from the object database.
+- (NSUInteger)countByExtendingCount:(NSUInteger)previousCount ofOID:(GTOID *)previousOID toOID:(GTOID *)OID inRepository:(GTRepository *)repository {
+	// Both counts come from a single walk, which stops at the merge base and
+	// uses the repository's commit graph when it has one.
+	size_t ahead = 0;
+	size_t behind = 0;
+	if (![repository calculateAhead:&ahead behind:&behind ofOID:OID relativeToOID:previousOID error:NULL]) return NSNotFound;
+	if (behind != 0) return NSNotFound;
+
+	return previousCount + ahead;
+}
+
+@end
@@ -0,0 +1,77 @@
+//
+//  GTCommitFilter.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Matches commits by author, committer, date, message and parent count.
+///
+/// Filters are evaluated on the raw commit object, without parsing it into a
+/// GTCommit or creating any signatures or strings. Assign one to a
+/// GTEnumerator's `commitFilter` to only return matching commits.
+///
+/// Every condition which is set has to match. A new filter matches every
+/// commit.
+///
+/// Filters are copied when assigned to an enumerator. A filter which isn't
+/// being mutated can be used from several threads.
+@interface GTCommitFilter : NSObject <NSCopying>
+
+/// The email address commits must be authored by, compared case
+/// insensitively, or nil to match any author.
+@property (nonatomic, copy) NSString * _Nullable authorEmail;
+
+/// The email address commits must be committed by, compared case
+/// insensitively, or nil to match any committer.
+@property (nonatomic, copy) NSString * _Nullable committerEmail;
+
+/// The earliest commit date to match, inclusive, or nil for no limit. Like
+/// `git log --since`, this compares the committer date.
+@property (nonatomic, copy) NSDate * _Nullable since;
+
+/// The latest commit date to match, inclusive, or nil for no limit.
+@property (nonatomic, copy) NSDate * _Nullable until;
+
+/// The fewest parents a commit may have. Defaults to 0.
+@property (nonatomic, assign) NSUInteger minimumParentCount;
+
+/// The most parents a commit may have. Defaults to NSUIntegerMax.
+@property (nonatomic, assign) NSUInteger maximumParentCount;
+
+/// The POSIX extended regular expression commit messages must contain a match
+/// for, or nil to match any message. Like `git log --grep`, `^` and `$` match
+/// at the start and end of every line.
+///
+/// To set a new pattern, use -setMessagePattern:caseInsensitive:error:.
+@property (nonatomic, copy, readonly) NSString * _Nullable messagePattern;
+
+/// Whether `messagePattern` ignores case.
+@property (nonatomic, assign, readonly) BOOL messagePatternIsCaseInsensitive;
+
+/// Compiles and sets the pattern commit messages must match.
+///
+/// pattern         - A POSIX extended regular expression, or nil to match any
+///                   message.
+/// caseInsensitive - Whether to ignore case when matching.
+/// error           - The error if one occurred.
+///
+/// Returns whether the pattern was valid. An invalid pattern leaves the
+/// previous pattern in place.
+- (BOOL)setMessagePattern:(NSString * _Nullable)pattern caseInsensitive:(BOOL)caseInsensitive error:(NSError **)error;
+
+/// Whether the given raw commit object, as stored in the object database,
+/// matches the receiver.
+///
+/// bytes  - The contents of the commit object, without the object header.
+///          Cannot be NULL unless `length` is 0.
+/// length - The length of `bytes`.
+- (BOOL)matchesCommitBytes:(const void *)bytes length:(size_t)length;
+
+@end
+
+NS_ASSUME_NONNULL_END
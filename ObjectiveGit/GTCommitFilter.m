@@ -0,0 +1,214 @@
+//
+//  GTCommitFilter.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTCommitFilter.h"
+#import "NSError+Git.h"
+
+#import "git2/errors.h"
+
+#import <regex.h>
+
+// The parts of a raw commit the filter looks at. Pointers are into the raw
+// commit, and aren't NUL-terminated.
+typedef struct {
+	NSUInteger parentCount;
+	const char *authorEmail;
+	size_t authorEmailLength;
+	const char *committerEmail;
+	size_t committerEmailLength;
+	BOOL hasCommitTime;
+	int64_t commitTime;
+	const char *message;
+	size_t messageLength;
+} GTCommitFilterFields;
+
+static BOOL GTCommitFilterHasPrefix(const char *line, const char *lineEnd, const char *prefix, size_t prefixLength) {
+	return (size_t)(lineEnd - line) >= prefixLength && memcmp(line, prefix, prefixLength) == 0;
+}
+
+// Finds the email and time in a signature of the form
+// "Name <email> 1234567890 +0000".
+static void GTCommitFilterParseSignature(const char *signature, const char *end, const char **email, size_t *emailLength, BOOL *hasTime, int64_t *time) {
+	const char *emailStart = memchr(signature, '<', end - signature);
+	if (emailStart == NULL) return;
+	emailStart++;
+
+	const char *emailEnd = memchr(emailStart, '>', end - emailStart);
+	if (emailEnd == NULL) return;
+
+	*email = emailStart;
+	*emailLength = emailEnd - emailStart;
+
+	if (hasTime == NULL) return;
+
+	const char *digit = emailEnd + 1;
+	while (digit < end && *digit == ' ') digit++;
+
+	int64_t value = 0;
+	const char *digitsStart = digit;
+	for (; digit < end && *digit >= '0' && *digit <= '9'; digit++) {
+		value = value * 10 + (*digit - '0');
+	}
+
+	if (digit == digitsStart) return;
+	*hasTime = YES;
+	*time = value;
+}
+
+static void GTCommitFilterParse(GTCommitFilterFields *fields, const char *bytes, size_t length) {
+	memset(fields, 0, sizeof(*fields));
+
+	const char *line = bytes;
+	const char *end = bytes + length;
+	while (line < end && *line != '\n') {
+		const char *lineEnd = memchr(line, '\n', end - line);
+		if (lineEnd == NULL) lineEnd = end;
+
+		if (GTCommitFilterHasPrefix(line, lineEnd, "parent ", 7)) {
+			fields->parentCount++;
+		} else if (GTCommitFilterHasPrefix(line, lineEnd, "author ", 7)) {
+			GTCommitFilterParseSignature(line + 7, lineEnd, &fields->authorEmail, &fields->authorEmailLength, NULL, NULL);
+		} else if (GTCommitFilterHasPrefix(line, lineEnd, "committer ", 10)) {
+			GTCommitFilterParseSignature(line + 10, lineEnd, &fields->committerEmail, &fields->committerEmailLength, &fields->hasCommitTime, &fields->commitTime);
+		}
+
+		line = lineEnd + 1;
+	}
+
+	// Skip the blank line between the header and the message.
+	if (line < end) line++;
+	fields->message = (line < end ? line : end);
+	fields->messageLength = end - fields->message;
+}
+
+static BOOL GTCommitFilterEmailMatches(NSData *expected, const char *email, size_t length) {
+	if (expected == nil) return YES;
+	if (email == NULL || expected.length != length) return NO;
+
+	return strncasecmp(expected.bytes, email, length) == 0;
+}
+
+@interface GTCommitFilter () {
+	regex_t _messageRegex;
+}
+
+// The UTF-8 bytes of `authorEmail` and `committerEmail`.
+@property (nonatomic, copy) NSData *authorEmailData;
+@property (nonatomic, copy) NSData *committerEmailData;
+
+@property (nonatomic, copy, readwrite) NSString *messagePattern;
+@property (nonatomic, assign, readwrite) BOOL messagePatternIsCaseInsensitive;
+
+@end
+
+@implementation GTCommitFilter
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_maximumParentCount = NSUIntegerMax;
+
+	return self;
+}
+
+- (void)dealloc {
+	if (_messagePattern != nil) regfree(&_messageRegex);
+}
+
+#pragma mark Properties
+
+- (void)setAuthorEmail:(NSString *)authorEmail {
+	_authorEmail = [authorEmail copy];
+	self.authorEmailData = [authorEmail dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (void)setCommitterEmail:(NSString *)committerEmail {
+	_committerEmail = [committerEmail copy];
+	self.committerEmailData = [committerEmail dataUsingEncoding:NSUTF8StringEncoding];
+}
+
+- (BOOL)setMessagePattern:(NSString *)pattern caseInsensitive:(BOOL)caseInsensitive error:(NSError **)error {
+	if (pattern == nil) {
+		if (self.messagePattern != nil) regfree(&_messageRegex);
+		self.messagePattern = nil;
+		self.messagePatternIsCaseInsensitive = NO;
+		return YES;
+	}
+
+	regex_t regex;
+	int flags = REG_EXTENDED | REG_NOSUB | REG_NEWLINE | (caseInsensitive ? REG_ICASE : 0);
+	int regexError = regcomp(&regex, pattern.UTF8String, flags);
+	if (regexError != 0) {
+		char description[256];
+		regerror(regexError, &regex, description, sizeof(description));
+		if (error != NULL) *error = [NSError git_errorFor:GIT_ERROR description:@"Invalid message pattern '%@': %s", pattern, description];
+		return NO;
+	}
+
+	if (self.messagePattern != nil) regfree(&_messageRegex);
+	_messageRegex = regex;
+	self.messagePattern = pattern;
+	self.messagePatternIsCaseInsensitive = caseInsensitive;
+	return YES;
+}
+
+#pragma mark Matching
+
+- (BOOL)matchesCommitBytes:(const void *)bytes length:(size_t)length {
+	NSParameterAssert(bytes != NULL || length == 0);
+
+	GTCommitFilterFields fields;
+	GTCommitFilterParse(&fields, bytes, length);
+
+	// Cheapest first, leaving the regular expression for last.
+	if (fields.parentCount < self.minimumParentCount || fields.parentCount > self.maximumParentCount) return NO;
+	if (!GTCommitFilterEmailMatches(self.authorEmailData, fields.authorEmail, fields.authorEmailLength)) return NO;
+	if (!GTCommitFilterEmailMatches(self.committerEmailData, fields.committerEmail, fields.committerEmailLength)) return NO;
+
+	if (self.since != nil || self.until != nil) {
+		if (!fields.hasCommitTime) return NO;
+		if (self.since != nil && fields.commitTime < (int64_t)floor(self.since.timeIntervalSince1970)) return NO;
+		if (self.until != nil && fields.commitTime > (int64_t)floor(self.until.timeIntervalSince1970)) return NO;
+	}
+
+	if (self.messagePattern != nil) {
+		// REG_STARTEND matches within the message without copying it to
+		// terminate it.
+		regmatch_t range = { .rm_so = 0, .rm_eo = (regoff_t)fields.messageLength };
+		if (regexec(&_messageRegex, fields.message, 1, &range, REG_STARTEND) != 0) return NO;
+	}
+
+	return YES;
+}
+
+#pragma mark NSCopying
+
+- (id)copyWithZone:(NSZone *)zone {
+	GTCommitFilter *filter = [[self.class allocWithZone:zone] init];
+	filter.authorEmail = self.authorEmail;
+	filter.committerEmail = self.committerEmail;
+	filter.since = self.since;
+	filter.until = self.until;
+	filter.minimumParentCount = self.minimumParentCount;
+	filter.maximumParentCount = self.maximumParentCount;
+
+	// The pattern already compiled once, so it will again.
+	[filter setMessagePattern:self.messagePattern caseInsensitive:self.messagePatternIsCaseInsensitive error:NULL];
+
+	return filter;
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> authorEmail: %@, committerEmail: %@, since: %@, until: %@, parents: %lu-%lu, messagePattern: %@", self.class, self, self.authorEmail, self.committerEmail, self.since, self.until, (unsigned long)self.minimumParentCount, (unsigned long)self.maximumParentCount, self.messagePattern];
+}
+
+@end
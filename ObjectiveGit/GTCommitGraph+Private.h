@@ -0,0 +1,40 @@
+//
+//  GTCommitGraph+Private.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTCommitGraph.h"
+#import "git2/oid.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Returned in place of an index for commits which aren't in the graph.
+extern const uint32_t GTCommitGraphNotFound;
+
+@interface GTCommitGraph ()
+
+/// Returns the position of the given commit in the graph, or
+/// GTCommitGraphNotFound.
+- (uint32_t)indexOfGitOid:(const git_oid *)oid;
+
+/// Returns the OID of the commit at the given position.
+- (const git_oid *)gitOidAtIndex:(uint32_t)index;
+
+/// Counts the commits reachable from `headIndex` but not `baseIndex`, and the
+/// other way around, like git_graph_ahead_behind.
+- (void)getAhead:(size_t *)ahead behind:(size_t *)behind ofIndex:(uint32_t)headIndex relativeToIndex:(uint32_t)baseIndex;
+
+/// Returns a best common ancestor of the two commits, or GTCommitGraphNotFound
+/// if they have none.
+- (uint32_t)mergeBaseOfIndex:(uint32_t)firstIndex andIndex:(uint32_t)secondIndex;
+
+/// Returns the commits reachable from `pushedIndexes` but not from
+/// `hiddenIndexes` as packed git_oids, with children before their parents and
+/// ties broken by commit time, newest first.
+- (NSData *)topologicallySortedOIDsFromIndexes:(const uint32_t *)pushedIndexes count:(NSUInteger)pushedCount hidingIndexes:(const uint32_t *)hiddenIndexes count:(NSUInteger)hiddenCount reverse:(BOOL)reverse;
+
+@end
+
+NS_ASSUME_NONNULL_END
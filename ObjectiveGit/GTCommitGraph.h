@@ -0,0 +1,94 @@
+//
+//  GTCommitGraph.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@class GTOID;
+@class GTRepository;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A memory-mapped table of the parents, root tree, commit time and
+/// generation number of every commit reachable from a repository's
+/// references, so history can be traversed without inflating commits.
+///
+/// The generation number of a commit is one more than the largest generation
+/// number of its parents, and 1 for root commits. A commit can only be an
+/// ancestor of commits with a larger generation number.
+///
+/// Once a graph is assigned to a repository's `commitGraph` property,
+/// topologically sorted GTEnumerator walks, ahead/behind counts and merge
+/// bases use it whenever every commit involved is in the graph, and fall back
+/// to libgit2 otherwise.
+///
+/// The file is private to ObjectiveGit and isn't read by git itself.
+///
+/// This class is thread safe.
+@interface GTCommitGraph : NSObject
+
+/// The file the receiver was read from.
+@property (nonatomic, readonly, copy) NSURL *fileURL;
+
+/// The number of commits in the graph.
+@property (nonatomic, readonly, assign) NSUInteger count;
+
+/// The location of the commit graph file for the given repository.
+///
+/// repository - The repository whose commit graph to locate. Cannot be nil.
++ (NSURL *)commitGraphURLForRepository:(GTRepository *)repository;
+
+/// Reads the repository's commit graph file, without updating it.
+///
+/// repository - The repository whose commit graph to read. Cannot be nil.
+/// error      - The error if one occurred, e.g. if the graph was never written.
+///
+/// Returns the commit graph, or nil if an error occurred.
++ (instancetype _Nullable)commitGraphWithRepository:(GTRepository *)repository error:(NSError **)error;
+
+/// Writes a commit graph covering every commit reachable from the
+/// repository's references and HEAD.
+///
+/// If the repository already has a commit graph file, only commits missing
+/// from it are read from the object database, e.g. those added by a fetch.
+///
+/// repository - The repository to write the graph for. Cannot be nil.
+/// error      - The error if one occurred.
+///
+/// Returns the new commit graph, or nil if an error occurred.
++ (instancetype _Nullable)writeCommitGraphForRepository:(GTRepository *)repository error:(NSError **)error;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Maps a commit graph file. Designated initializer.
+///
+/// fileURL - The commit graph file to read. Cannot be nil.
+/// error   - The error if one occurred.
+///
+/// Returns the commit graph, or nil if the file couldn't be read or isn't a
+/// valid commit graph.
+- (instancetype _Nullable)initWithContentsOfURL:(NSURL *)fileURL error:(NSError **)error NS_DESIGNATED_INITIALIZER;
+
+/// Whether the graph contains the given commit.
+- (BOOL)containsOID:(GTOID *)OID;
+
+/// Returns the parents of the given commit, or nil if it isn't in the graph.
+- (NSArray<GTOID *> * _Nullable)parentOIDsOfOID:(GTOID *)OID;
+
+/// Returns the root tree of the given commit, or nil if it isn't in the graph.
+- (GTOID * _Nullable)treeOIDOfOID:(GTOID *)OID;
+
+/// Returns the committer time of the given commit, or nil if it isn't in the
+/// graph.
+- (NSDate * _Nullable)commitDateOfOID:(GTOID *)OID;
+
+/// Returns the generation number of the given commit, or NSNotFound if it
+/// isn't in the graph.
+- (NSUInteger)generationOfOID:(GTOID *)OID;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,912 @@
+//
+//  GTCommitGraph.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTCommitGraph.h"
+#import "GTCommitGraph+Private.h"
+#import "GTOID.h"
+#import "GTOIDTable.h"
+#import "GTRepository.h"
+#import "NSError+Git.h"
+#import "EXTScope.h"
+
+#import "git2/commit.h"
+#import "git2/errors.h"
+#import "git2/refs.h"
+#import "git2/revparse.h"
+
+// The file starts with a header, followed by a fanout table, the sorted OIDs,
+// one data entry per OID and a list of extra parent edges for octopus merges.
+// All integers are little endian.
+//
+// Header        - "GTCG", then the version, commit count and extra edge count
+//                 as 32-bit integers.
+// Fanout        - 256 32-bit integers. Entry n is the number of commits whose
+//                 first OID byte is at most n.
+// OIDs          - The raw OIDs of the commits, sorted.
+// Data          - Per commit: the raw tree OID, the first and second parent
+//                 positions and the generation number as 32-bit integers, and
+//                 the commit time as a 64-bit integer.
+// Extra edges   - 32-bit parent positions. A second parent position with
+//                 GTCommitGraphExtraEdges set instead indexes this list, which
+//                 continues until an entry with GTCommitGraphLastEdge set.
+static const char GTCommitGraphMagic[4] = { 'G', 'T', 'C', 'G' };
+static const uint32_t GTCommitGraphVersion = 1;
+static const NSUInteger GTCommitGraphHeaderSize = 16;
+static const NSUInteger GTCommitGraphFanoutSize = 256 * sizeof(uint32_t);
+static const NSUInteger GTCommitGraphEntrySize = GIT_OID_RAWSZ + 3 * sizeof(uint32_t) + sizeof(int64_t);
+
+static const uint32_t GTCommitGraphParentNone = 0x70000000;
+static const uint32_t GTCommitGraphExtraEdges = 0x80000000;
+static const uint32_t GTCommitGraphLastEdge = 0x80000000;
+
+const uint32_t GTCommitGraphNotFound = UINT32_MAX;
+
+#pragma mark Table
+
+typedef struct {
+	const unsigned char *fanout;
+	const unsigned char *oids;
+	const unsigned char *entries;
+	const unsigned char *extraEdges;
+	uint32_t count;
+	uint32_t extraEdgeCount;
+} GTCommitGraphTable;
+
+static inline uint32_t GTCommitGraphReadUInt32(const unsigned char *bytes) {
+	uint32_t value;
+	memcpy(&value, bytes, sizeof(value));
+	return CFSwapInt32LittleToHost(value);
+}
+
+static inline int64_t GTCommitGraphReadInt64(const unsigned char *bytes) {
+	uint64_t value;
+	memcpy(&value, bytes, sizeof(value));
+	return (int64_t)CFSwapInt64LittleToHost(value);
+}
+
+static inline void GTCommitGraphAppendUInt32(NSMutableData *data, uint32_t value) {
+	value = CFSwapInt32HostToLittle(value);
+	[data appendBytes:&value length:sizeof(value)];
+}
+
+static inline void GTCommitGraphAppendInt64(NSMutableData *data, int64_t value) {
+	uint64_t swapped = CFSwapInt64HostToLittle((uint64_t)value);
+	[data appendBytes:&swapped length:sizeof(swapped)];
+}
+
+static inline const git_oid *GTCommitGraphOid(const GTCommitGraphTable *table, uint32_t index) {
+	return (const git_oid *)(table->oids + (size_t)index * GIT_OID_RAWSZ);
+}
+
+static inline const unsigned char *GTCommitGraphEntry(const GTCommitGraphTable *table, uint32_t index) {
+	return table->entries + (size_t)index * GTCommitGraphEntrySize;
+}
+
+static inline const git_oid *GTCommitGraphTree(const GTCommitGraphTable *table, uint32_t index) {
+	return (const git_oid *)GTCommitGraphEntry(table, index);
+}
+
+static inline uint32_t GTCommitGraphGeneration(const GTCommitGraphTable *table, uint32_t index) {
+	return GTCommitGraphReadUInt32(GTCommitGraphEntry(table, index) + GIT_OID_RAWSZ + 2 * sizeof(uint32_t));
+}
+
+static inline int64_t GTCommitGraphTime(const GTCommitGraphTable *table, uint32_t index) {
+	return GTCommitGraphReadInt64(GTCommitGraphEntry(table, index) + GIT_OID_RAWSZ + 3 * sizeof(uint32_t));
+}
+
+static uint32_t GTCommitGraphFind(const GTCommitGraphTable *table, const git_oid *oid) {
+	uint8_t first = oid->id[0];
+	uint32_t low = (first == 0 ? 0 : GTCommitGraphReadUInt32(table->fanout + (first - 1) * sizeof(uint32_t)));
+	uint32_t high = GTCommitGraphReadUInt32(table->fanout + first * sizeof(uint32_t));
+
+	while (low < high) {
+		uint32_t middle = low + (high - low) / 2;
+		int comparison = git_oid_cmp(GTCommitGraphOid(table, middle), oid);
+		if (comparison == 0) return middle;
+
+		if (comparison < 0) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+
+	return GTCommitGraphNotFound;
+}
+
+// Iterates over the parents of a commit. `cursor` must start at 0.
+//
+// Returns the position of the next parent, or GTCommitGraphNotFound once
+// there are no more.
+static const uint32_t GTCommitGraphCursorDone = UINT32_MAX;
+
+static uint32_t GTCommitGraphNextParent(const GTCommitGraphTable *table, uint32_t index, uint32_t *cursor) {
+	const unsigned char *parents = GTCommitGraphEntry(table, index) + GIT_OID_RAWSZ;
+	uint32_t state = *cursor;
+	if (state == GTCommitGraphCursorDone) return GTCommitGraphNotFound;
+
+	if (state < 2) {
+		uint32_t parent = GTCommitGraphReadUInt32(parents + state * sizeof(uint32_t));
+		if (parent == GTCommitGraphParentNone) {
+			*cursor = GTCommitGraphCursorDone;
+			return GTCommitGraphNotFound;
+		}
+
+		if (state == 0 || (parent & GTCommitGraphExtraEdges) == 0) {
+			*cursor = (state == 0 ? 1 : GTCommitGraphCursorDone);
+			return parent;
+		}
+
+		state = 2 + (parent & ~GTCommitGraphExtraEdges);
+	}
+
+	uint32_t edge = state - 2;
+	if (edge >= table->extraEdgeCount) {
+		*cursor = GTCommitGraphCursorDone;
+		return GTCommitGraphNotFound;
+	}
+
+	uint32_t value = GTCommitGraphReadUInt32(table->extraEdges + edge * sizeof(uint32_t));
+	*cursor = ((value & GTCommitGraphLastEdge) != 0 ? GTCommitGraphCursorDone : state + 1);
+	return value & ~GTCommitGraphLastEdge;
+}
+
+// Checks that the sizes add up and that every parent position is in range, so
+// the traversals never read outside the mapping.
+static BOOL GTCommitGraphTableInit(GTCommitGraphTable *table, const unsigned char *bytes, NSUInteger length) {
+	if (length < GTCommitGraphHeaderSize + GTCommitGraphFanoutSize) return NO;
+	if (memcmp(bytes, GTCommitGraphMagic, sizeof(GTCommitGraphMagic)) != 0) return NO;
+	if (GTCommitGraphReadUInt32(bytes + 4) != GTCommitGraphVersion) return NO;
+
+	uint32_t count = GTCommitGraphReadUInt32(bytes + 8);
+	uint32_t extraEdgeCount = GTCommitGraphReadUInt32(bytes + 12);
+	uint64_t expectedLength = GTCommitGraphHeaderSize + GTCommitGraphFanoutSize + (uint64_t)count * (GIT_OID_RAWSZ + GTCommitGraphEntrySize) + (uint64_t)extraEdgeCount * sizeof(uint32_t);
+	if (expectedLength != length) return NO;
+
+	table->count = count;
+	table->extraEdgeCount = extraEdgeCount;
+	table->fanout = bytes + GTCommitGraphHeaderSize;
+	table->oids = table->fanout + GTCommitGraphFanoutSize;
+	table->entries = table->oids + (size_t)count * GIT_OID_RAWSZ;
+	table->extraEdges = table->entries + (size_t)count * GTCommitGraphEntrySize;
+
+	uint32_t previous = 0;
+	for (NSUInteger i = 0; i < 256; i++) {
+		uint32_t fanout = GTCommitGraphReadUInt32(table->fanout + i * sizeof(uint32_t));
+		if (fanout < previous || fanout > count) return NO;
+		previous = fanout;
+	}
+
+	if (previous != count) return NO;
+
+	for (uint32_t i = 0; i < count; i++) {
+		uint32_t cursor = 0;
+		uint32_t parent;
+		while ((parent = GTCommitGraphNextParent(table, i, &cursor)) != GTCommitGraphNotFound) {
+			if (parent >= count) return NO;
+		}
+	}
+
+	return YES;
+}
+
+#pragma mark Heap
+
+// A max-heap of commit positions, ordered by `primary`, then `secondary`, then
+// by lowest position so that traversals are deterministic.
+typedef struct {
+	int64_t primary;
+	uint32_t secondary;
+	uint32_t index;
+} GTCommitGraphHeapItem;
+
+typedef struct {
+	GTCommitGraphHeapItem *items;
+	NSUInteger count;
+	NSUInteger capacity;
+} GTCommitGraphHeap;
+
+static inline BOOL GTCommitGraphHeapItemAbove(GTCommitGraphHeapItem a, GTCommitGraphHeapItem b) {
+	if (a.primary != b.primary) return a.primary > b.primary;
+	if (a.secondary != b.secondary) return a.secondary > b.secondary;
+	return a.index < b.index;
+}
+
+static void GTCommitGraphHeapPush(GTCommitGraphHeap *heap, GTCommitGraphHeapItem item) {
+	if (heap->count == heap->capacity) {
+		heap->capacity = MAX(heap->capacity * 2, (NSUInteger)64);
+		heap->items = reallocf(heap->items, heap->capacity * sizeof(*heap->items));
+		NSCAssert(heap->items != NULL, @"Out of memory");
+	}
+
+	NSUInteger position = heap->count++;
+	while (position > 0) {
+		NSUInteger parent = (position - 1) / 2;
+		if (!GTCommitGraphHeapItemAbove(item, heap->items[parent])) break;
+
+		heap->items[position] = heap->items[parent];
+		position = parent;
+	}
+
+	heap->items[position] = item;
+}
+
+static GTCommitGraphHeapItem GTCommitGraphHeapPop(GTCommitGraphHeap *heap) {
+	GTCommitGraphHeapItem top = heap->items[0];
+	GTCommitGraphHeapItem last = heap->items[--heap->count];
+
+	NSUInteger position = 0;
+	while (YES) {
+		NSUInteger child = position * 2 + 1;
+		if (child >= heap->count) break;
+		if (child + 1 < heap->count && GTCommitGraphHeapItemAbove(heap->items[child + 1], heap->items[child])) child++;
+		if (!GTCommitGraphHeapItemAbove(heap->items[child], last)) break;
+
+		heap->items[position] = heap->items[child];
+		position = child;
+	}
+
+	if (heap->count > 0) heap->items[position] = last;
+	return top;
+}
+
+#pragma mark Traversals
+
+// Flags for painting commits reachable from two starting points.
+typedef NS_OPTIONS(uint8_t, GTCommitGraphPaintFlags) {
+	GTCommitGraphPaintFirst = 1 << 0,
+	GTCommitGraphPaintSecond = 1 << 1,
+	GTCommitGraphPaintBoth = GTCommitGraphPaintFirst | GTCommitGraphPaintSecond,
+	GTCommitGraphPaintQueued = 1 << 2,
+};
+
+typedef struct {
+	const GTCommitGraphTable *table;
+	uint8_t *flags;
+	GTCommitGraphHeap heap;
+
+	// The number of queued commits not yet painted by both sides. Once it
+	// reaches zero, everything left is a common ancestor.
+	NSUInteger pendingCount;
+} GTCommitGraphPainter;
+
+static void GTCommitGraphPaint(GTCommitGraphPainter *painter, uint32_t index, uint8_t paint) {
+	uint8_t old = painter->flags[index];
+	uint8_t updated = old | paint;
+	if (updated == old) return;
+
+	painter->flags[index] = updated | GTCommitGraphPaintQueued;
+
+	if ((old & GTCommitGraphPaintQueued) == 0) {
+		GTCommitGraphHeapItem item = { GTCommitGraphGeneration(painter->table, index), 0, index };
+		GTCommitGraphHeapPush(&painter->heap, item);
+		if ((updated & GTCommitGraphPaintBoth) != GTCommitGraphPaintBoth) painter->pendingCount++;
+	} else if ((updated & GTCommitGraphPaintBoth) == GTCommitGraphPaintBoth) {
+		painter->pendingCount--;
+	}
+}
+
+// Pops the commit with the highest generation number and paints its parents.
+//
+// Commits are only ever reached from commits with a higher generation number,
+// so a commit's paint is final by the time it's popped.
+static uint32_t GTCommitGraphPaintNext(GTCommitGraphPainter *painter, uint8_t *paint) {
+	uint32_t index = GTCommitGraphHeapPop(&painter->heap).index;
+	*paint = painter->flags[index] & GTCommitGraphPaintBoth;
+	if (*paint != GTCommitGraphPaintBoth) painter->pendingCount--;
+
+	uint32_t cursor = 0;
+	uint32_t parent;
+	while ((parent = GTCommitGraphNextParent(painter->table, index, &cursor)) != GTCommitGraphNotFound) {
+		GTCommitGraphPaint(painter, parent, *paint);
+	}
+
+	return index;
+}
+
+static void GTCommitGraphPainterInit(GTCommitGraphPainter *painter, const GTCommitGraphTable *table, uint32_t first, uint32_t second) {
+	memset(painter, 0, sizeof(*painter));
+	painter->table = table;
+	painter->flags = calloc(table->count, sizeof(*painter->flags));
+	NSCAssert(painter->flags != NULL, @"Out of memory");
+
+	GTCommitGraphPaint(painter, first, GTCommitGraphPaintFirst);
+	GTCommitGraphPaint(painter, second, GTCommitGraphPaintSecond);
+}
+
+static void GTCommitGraphPainterFree(GTCommitGraphPainter *painter) {
+	free(painter->flags);
+	free(painter->heap.items);
+}
+
+static void GTCommitGraphAheadBehind(const GTCommitGraphTable *table, uint32_t head, uint32_t base, size_t *ahead, size_t *behind) {
+	GTCommitGraphPainter painter;
+	GTCommitGraphPainterInit(&painter, table, head, base);
+
+	size_t aheadCount = 0;
+	size_t behindCount = 0;
+	while (painter.heap.count > 0 && painter.pendingCount > 0) {
+		uint8_t paint;
+		GTCommitGraphPaintNext(&painter, &paint);
+
+		if (paint == GTCommitGraphPaintFirst) aheadCount++;
+		if (paint == GTCommitGraphPaintSecond) behindCount++;
+	}
+
+	GTCommitGraphPainterFree(&painter);
+
+	if (ahead != NULL) *ahead = aheadCount;
+	if (behind != NULL) *behind = behindCount;
+}
+
+static uint32_t GTCommitGraphMergeBase(const GTCommitGraphTable *table, uint32_t first, uint32_t second) {
+	GTCommitGraphPainter painter;
+	GTCommitGraphPainterInit(&painter, table, first, second);
+
+	// The first common commit popped has no common descendant, since any such
+	// descendant would have a higher generation and would have come first.
+	uint32_t mergeBase = GTCommitGraphNotFound;
+	while (painter.heap.count > 0) {
+		uint8_t paint;
+		uint32_t index = GTCommitGraphPaintNext(&painter, &paint);
+		if (paint == GTCommitGraphPaintBoth) {
+			mergeBase = index;
+			break;
+		}
+	}
+
+	GTCommitGraphPainterFree(&painter);
+	return mergeBase;
+}
+
+typedef NS_OPTIONS(uint8_t, GTCommitGraphWalkFlags) {
+	GTCommitGraphWalkHidden = 1 << 0,
+	GTCommitGraphWalkIncluded = 1 << 1,
+};
+
+// Marks every commit reachable from `starts` with `flag`, stopping at commits
+// already marked with `stopFlags`. If `visited` isn't NULL, newly marked
+// commits are appended to it.
+static void GTCommitGraphMarkReachable(const GTCommitGraphTable *table, uint8_t *flags, const uint32_t *starts, NSUInteger startCount, uint8_t flag, uint8_t stopFlags, NSMutableData *visited) {
+	NSMutableData *stack = [NSMutableData dataWithBytes:starts length:startCount * sizeof(uint32_t)];
+	while (stack.length > 0) {
+		uint32_t index = ((const uint32_t *)stack.bytes)[stack.length / sizeof(uint32_t) - 1];
+		stack.length -= sizeof(uint32_t);
+
+		if ((flags[index] & stopFlags) != 0) continue;
+		flags[index] |= flag;
+		[visited appendBytes:&index length:sizeof(index)];
+
+		uint32_t cursor = 0;
+		uint32_t parent;
+		while ((parent = GTCommitGraphNextParent(table, index, &cursor)) != GTCommitGraphNotFound) {
+			if ((flags[parent] & stopFlags) == 0) [stack appendBytes:&parent length:sizeof(parent)];
+		}
+	}
+}
+
+static NSData *GTCommitGraphTopologicalSort(const GTCommitGraphTable *table, const uint32_t *pushed, NSUInteger pushedCount, const uint32_t *hidden, NSUInteger hiddenCount, BOOL reverse) {
+	uint8_t *flags = calloc(table->count, sizeof(*flags));
+	NSCAssert(flags != NULL, @"Out of memory");
+
+	GTCommitGraphMarkReachable(table, flags, hidden, hiddenCount, GTCommitGraphWalkHidden, GTCommitGraphWalkHidden, nil);
+
+	NSMutableData *includedData = [NSMutableData data];
+	GTCommitGraphMarkReachable(table, flags, pushed, pushedCount, GTCommitGraphWalkIncluded, GTCommitGraphWalkHidden | GTCommitGraphWalkIncluded, includedData);
+
+	const uint32_t *included = includedData.bytes;
+	NSUInteger includedCount = includedData.length / sizeof(uint32_t);
+
+	// Count each commit's children within the walk. A commit is ready to be
+	// output once all of them have been.
+	uint32_t *childCounts = calloc(table->count, sizeof(*childCounts));
+	NSCAssert(childCounts != NULL, @"Out of memory");
+
+	for (NSUInteger i = 0; i < includedCount; i++) {
+		uint32_t cursor = 0;
+		uint32_t parent;
+		while ((parent = GTCommitGraphNextParent(table, included[i], &cursor)) != GTCommitGraphNotFound) {
+			if (flags[parent] == GTCommitGraphWalkIncluded) childCounts[parent]++;
+		}
+	}
+
+	GTCommitGraphHeap heap = { NULL, 0, 0 };
+	for (NSUInteger i = 0; i < includedCount; i++) {
+		uint32_t index = included[i];
+		if (childCounts[index] > 0) continue;
+
+		GTCommitGraphHeapItem item = { GTCommitGraphTime(table, index), GTCommitGraphGeneration(table, index), index };
+		GTCommitGraphHeapPush(&heap, item);
+	}
+
+	NSMutableData *sorted = [NSMutableData dataWithLength:includedCount * sizeof(git_oid)];
+	git_oid *output = sorted.mutableBytes;
+	NSUInteger outputCount = 0;
+
+	while (heap.count > 0) {
+		uint32_t index = GTCommitGraphHeapPop(&heap).index;
+		NSUInteger position = (reverse ? includedCount - 1 - outputCount : outputCount);
+		git_oid_cpy(&output[position], GTCommitGraphOid(table, index));
+		outputCount++;
+
+		uint32_t cursor = 0;
+		uint32_t parent;
+		while ((parent = GTCommitGraphNextParent(table, index, &cursor)) != GTCommitGraphNotFound) {
+			if (flags[parent] != GTCommitGraphWalkIncluded) continue;
+			if (--childCounts[parent] > 0) continue;
+
+			GTCommitGraphHeapItem item = { GTCommitGraphTime(table, parent), GTCommitGraphGeneration(table, parent), parent };
+			GTCommitGraphHeapPush(&heap, item);
+		}
+	}
+
+	NSCAssert(outputCount == includedCount, @"Commit graph contains a cycle");
+
+	free(heap.items);
+	free(childCounts);
+	free(flags);
+
+	return sorted;
+}
+
+#pragma mark Writing
+
+// A commit read from the object database while writing a graph.
+typedef struct {
+	git_oid oid;
+	git_oid tree;
+	int64_t time;
+	NSUInteger firstParent;
+	NSUInteger parentCount;
+} GTCommitGraphPendingCommit;
+
+static int GTCommitGraphPendingCommitCompare(const void *a, const void *b) {
+	return git_oid_cmp(&((const GTCommitGraphPendingCommit *)a)->oid, &((const GTCommitGraphPendingCommit *)b)->oid);
+}
+
+static uint32_t GTCommitGraphFindInOids(const git_oid *oids, uint32_t count, const git_oid *oid) {
+	uint32_t low = 0;
+	uint32_t high = count;
+	while (low < high) {
+		uint32_t middle = low + (high - low) / 2;
+		int comparison = git_oid_cmp(&oids[middle], oid);
+		if (comparison == 0) return middle;
+
+		if (comparison < 0) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+
+	return GTCommitGraphNotFound;
+}
+
+@interface GTCommitGraph () {
+	GTCommitGraphTable _table;
+}
+
+@property (nonatomic, readonly, strong) NSData *data;
+
+@end
+
+@implementation GTCommitGraph
+
+#pragma mark Lifecycle
+
++ (NSURL *)commitGraphURLForRepository:(GTRepository *)repository {
+	NSParameterAssert(repository != nil);
+
+	return [repository.gitDirectoryURL URLByAppendingPathComponent:@"objective-git/commit-graph" isDirectory:NO];
+}
+
++ (instancetype)commitGraphWithRepository:(GTRepository *)repository error:(NSError **)error {
+	return [[self alloc] initWithContentsOfURL:[self commitGraphURLForRepository:repository] error:error];
+}
+
+- (instancetype)init {
+	NSAssert(NO, @"Call to an unavailable initializer.");
+	return nil;
+}
+
+- (instancetype)initWithContentsOfURL:(NSURL *)fileURL error:(NSError **)error {
+	NSParameterAssert(fileURL != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_fileURL = [fileURL copy];
+	_data = [NSData dataWithContentsOfURL:fileURL options:NSDataReadingMappedIfSafe error:error];
+	if (_data == nil) return nil;
+
+	if (!GTCommitGraphTableInit(&_table, _data.bytes, _data.length)) {
+		if (error != NULL) *error = [NSError git_errorFor:GIT_ERROR description:@"%@ is not a valid commit graph.", fileURL.path];
+		return nil;
+	}
+
+	return self;
+}
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> count: %lu, fileURL: %@", NSStringFromClass(self.class), self, (unsigned long)self.count, self.fileURL];
+}
+
+#pragma mark Properties
+
+- (NSUInteger)count {
+	return _table.count;
+}
+
+#pragma mark Lookups
+
+- (uint32_t)indexOfGitOid:(const git_oid *)oid {
+	NSParameterAssert(oid != NULL);
+
+	return GTCommitGraphFind(&_table, oid);
+}
+
+- (const git_oid *)gitOidAtIndex:(uint32_t)index {
+	NSParameterAssert(index < _table.count);
+
+	return GTCommitGraphOid(&_table, index);
+}
+
+- (BOOL)containsOID:(GTOID *)OID {
+	NSParameterAssert(OID != nil);
+
+	return [self indexOfGitOid:OID.git_oid] != GTCommitGraphNotFound;
+}
+
+- (NSArray *)parentOIDsOfOID:(GTOID *)OID {
+	NSParameterAssert(OID != nil);
+
+	uint32_t index = [self indexOfGitOid:OID.git_oid];
+	if (index == GTCommitGraphNotFound) return nil;
+
+	NSMutableArray *parents = [NSMutableArray arrayWithCapacity:2];
+	uint32_t cursor = 0;
+	uint32_t parent;
+	while ((parent = GTCommitGraphNextParent(&_table, index, &cursor)) != GTCommitGraphNotFound) {
+		[parents addObject:[GTOID oidWithGitOid:GTCommitGraphOid(&_table, parent)]];
+	}
+
+	return parents;
+}
+
+- (GTOID *)treeOIDOfOID:(GTOID *)OID {
+	NSParameterAssert(OID != nil);
+
+	uint32_t index = [self indexOfGitOid:OID.git_oid];
+	if (index == GTCommitGraphNotFound) return nil;
+
+	return [GTOID oidWithGitOid:GTCommitGraphTree(&_table, index)];
+}
+
+- (NSDate *)commitDateOfOID:(GTOID *)OID {
+	NSParameterAssert(OID != nil);
+
+	uint32_t index = [self indexOfGitOid:OID.git_oid];
+	if (index == GTCommitGraphNotFound) return nil;
+
+	return [NSDate dateWithTimeIntervalSince1970:GTCommitGraphTime(&_table, index)];
+}
+
+- (NSUInteger)generationOfOID:(GTOID *)OID {
+	NSParameterAssert(OID != nil);
+
+	uint32_t index = [self indexOfGitOid:OID.git_oid];
+	if (index == GTCommitGraphNotFound) return NSNotFound;
+
+	return GTCommitGraphGeneration(&_table, index);
+}
+
+#pragma mark Traversals
+
+- (void)getAhead:(size_t *)ahead behind:(size_t *)behind ofIndex:(uint32_t)headIndex relativeToIndex:(uint32_t)baseIndex {
+	NSParameterAssert(headIndex < _table.count);
+	NSParameterAssert(baseIndex < _table.count);
+
+	GTCommitGraphAheadBehind(&_table, headIndex, baseIndex, ahead, behind);
+}
+
+- (uint32_t)mergeBaseOfIndex:(uint32_t)firstIndex andIndex:(uint32_t)secondIndex {
+	NSParameterAssert(firstIndex < _table.count);
+	NSParameterAssert(secondIndex < _table.count);
+
+	return GTCommitGraphMergeBase(&_table, firstIndex, secondIndex);
+}
+
+- (NSData *)topologicallySortedOIDsFromIndexes:(const uint32_t *)pushedIndexes count:(NSUInteger)pushedCount hidingIndexes:(const uint32_t *)hiddenIndexes count:(NSUInteger)hiddenCount reverse:(BOOL)reverse {
+	return GTCommitGraphTopologicalSort(&_table, pushedIndexes, pushedCount, hiddenIndexes, hiddenCount, reverse);
+}
+
+#pragma mark Writing
+
++ (instancetype)writeCommitGraphForRepository:(GTRepository *)repository error:(NSError **)error {
+	NSParameterAssert(repository != nil);
+
+	NSURL *URL = [self commitGraphURLForRepository:repository];
+
+	// A missing or unreadable graph just means starting from scratch.
+	GTCommitGraph *existingGraph = [[self alloc] initWithContentsOfURL:URL error:NULL];
+
+	NSMutableData *tips = [self tipOIDsOfRepository:repository error:error];
+	if (tips == nil) return nil;
+
+	NSMutableData *pendingCommits = [NSMutableData data];
+	NSMutableData *pendingParents = [NSMutableData data];
+	if (![self readCommitsReachableFromOIDs:tips inRepository:repository excludingGraph:existingGraph intoCommits:pendingCommits parents:pendingParents error:error]) return nil;
+
+	NSData *data = [self dataByMergingGraph:existingGraph withCommits:pendingCommits parents:pendingParents];
+
+	NSError *writeError = nil;
+	BOOL written = [NSFileManager.defaultManager createDirectoryAtURL:URL.URLByDeletingLastPathComponent withIntermediateDirectories:YES attributes:nil error:&writeError];
+	if (written) written = [data writeToURL:URL options:NSDataWritingAtomic error:&writeError];
+	if (!written) {
+		if (error != NULL) *error = writeError;
+		return nil;
+	}
+
+	return [[self alloc] initWithContentsOfURL:URL error:error];
+}
+
+// Returns the commits pointed to by every reference and HEAD, as packed
+// git_oids. References to anything other than commits are skipped.
++ (NSMutableData *)tipOIDsOfRepository:(GTRepository *)repository error:(NSError **)error {
+	NSMutableData *tips = [NSMutableData data];
+
+	git_object *head = NULL;
+	if (git_revparse_single(&head, repository.git_repository, "HEAD^{commit}") == GIT_OK) {
+		[tips appendBytes:git_object_id(head) length:sizeof(git_oid)];
+		git_object_free(head);
+	}
+
+	git_reference_iterator *iterator = NULL;
+	int gitError = git_reference_iterator_new(&iterator, repository.git_repository);
+	if (gitError != GIT_OK) {
+		if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to iterate references."];
+		return nil;
+	}
+
+	@onExit {
+		git_reference_iterator_free(iterator);
+	};
+
+	git_reference *reference = NULL;
+	while ((gitError = git_reference_next(&reference, iterator)) == GIT_OK) {
+		git_object *commit = NULL;
+		if (git_reference_peel(&commit, reference, GIT_OBJECT_COMMIT) == GIT_OK) {
+			[tips appendBytes:git_object_id(commit) length:sizeof(git_oid)];
+			git_object_free(commit);
+		}
+
+		git_reference_free(reference);
+	}
+
+	if (gitError != GIT_ITEROVER) {
+		if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to iterate references."];
+		return nil;
+	}
+
+	return tips;
+}
+
+// Reads every commit reachable from `tips` which isn't in `graph` into
+// `commits` (GTCommitGraphPendingCommit structs), with their parent OIDs in
+// `parents`.
++ (BOOL)readCommitsReachableFromOIDs:(NSMutableData *)tips inRepository:(GTRepository *)repository excludingGraph:(GTCommitGraph *)graph intoCommits:(NSMutableData *)commits parents:(NSMutableData *)parents error:(NSError **)error {
+	GTOIDTable seen;
+	if (!GTOIDTableInit(&seen, 1024, NO)) {
+		if (error != NULL) *error = [NSError git_errorFor:GIT_ERROR description:@"Failed to allocate memory for the commit graph."];
+		return NO;
+	}
+
+	@onExit {
+		GTOIDTableFree(&seen);
+	};
+
+	NSMutableData *stack = tips;
+	while (stack.length > 0) {
+		git_oid oid;
+		git_oid_cpy(&oid, (const git_oid *)stack.bytes + stack.length / sizeof(git_oid) - 1);
+		stack.length -= sizeof(git_oid);
+
+		if (graph != nil && [graph indexOfGitOid:&oid] != GTCommitGraphNotFound) continue;
+
+		BOOL inserted = NO;
+		if (GTOIDTableInsert(&seen, &oid, &inserted) == NSNotFound) {
+			if (error != NULL) *error = [NSError git_errorFor:GIT_ERROR description:@"Failed to allocate memory for the commit graph."];
+			return NO;
+		}
+
+		if (!inserted) continue;
+
+		git_commit *commit = NULL;
+		int gitError = git_commit_lookup(&commit, repository.git_repository, &oid);
+		if (gitError != GIT_OK) {
+			if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to look up commit %@.", [GTOID oidWithGitOid:&oid].SHA];
+			return NO;
+		}
+
+		GTCommitGraphPendingCommit pending;
+		git_oid_cpy(&pending.oid, &oid);
+		git_oid_cpy(&pending.tree, git_commit_tree_id(commit));
+		pending.time = git_commit_time(commit);
+		pending.firstParent = parents.length / sizeof(git_oid);
+		pending.parentCount = git_commit_parentcount(commit);
+		[commits appendBytes:&pending length:sizeof(pending)];
+
+		for (unsigned int i = 0; i < pending.parentCount; i++) {
+			const git_oid *parent = git_commit_parent_id(commit, i);
+			[parents appendBytes:parent length:sizeof(git_oid)];
+			[stack appendBytes:parent length:sizeof(git_oid)];
+		}
+
+		git_commit_free(commit);
+	}
+
+	return YES;
+}
+
+// Serializes the union of `graph` and the pending commits.
+//
+// Commits already in the graph keep their generation numbers, since their
+// ancestry can't have changed, so only the pending commits need numbering.
++ (NSData *)dataByMergingGraph:(GTCommitGraph *)graph withCommits:(NSMutableData *)commitsData parents:(NSData *)parentsData {
+	const GTCommitGraphTable *table = (graph != nil ? &graph->_table : NULL);
+	uint32_t existingCount = (table != NULL ? table->count : 0);
+
+	qsort(commitsData.mutableBytes, commitsData.length / sizeof(GTCommitGraphPendingCommit), sizeof(GTCommitGraphPendingCommit), GTCommitGraphPendingCommitCompare);
+	const GTCommitGraphPendingCommit *commits = commitsData.bytes;
+	uint32_t commitCount = (uint32_t)(commitsData.length / sizeof(GTCommitGraphPendingCommit));
+	const git_oid *pendingParents = parentsData.bytes;
+
+	// Merge the two sorted lists. A source below existingCount is a position
+	// in the old graph, anything else is a pending commit.
+	uint32_t count = existingCount + commitCount;
+	NSMutableData *oidsData = [NSMutableData dataWithLength:(NSUInteger)count * sizeof(git_oid)];
+	NSMutableData *sourcesData = [NSMutableData dataWithLength:(NSUInteger)count * sizeof(uint32_t)];
+	NSMutableData *remapData = [NSMutableData dataWithLength:(NSUInteger)existingCount * sizeof(uint32_t)];
+	git_oid *oids = oidsData.mutableBytes;
+	uint32_t *sources = sourcesData.mutableBytes;
+	uint32_t *remap = remapData.mutableBytes;
+
+	uint32_t i = 0;
+	uint32_t j = 0;
+	for (uint32_t position = 0; position < count; position++) {
+		BOOL takeExisting = (j == commitCount || (i < existingCount && git_oid_cmp(GTCommitGraphOid(table, i), &commits[j].oid) < 0));
+		if (takeExisting) {
+			git_oid_cpy(&oids[position], GTCommitGraphOid(table, i));
+			sources[position] = i;
+			remap[i++] = position;
+		} else {
+			git_oid_cpy(&oids[position], &commits[j].oid);
+			sources[position] = existingCount + j++;
+		}
+	}
+
+	// Resolve every commit's parents to their new positions.
+	NSMutableData *parentStartsData = [NSMutableData dataWithLength:((NSUInteger)count + 1) * sizeof(uint32_t)];
+	NSMutableData *parentIndexesData = [NSMutableData data];
+	uint32_t *parentStarts = parentStartsData.mutableBytes;
+
+	for (uint32_t position = 0; position < count; position++) {
+		parentStarts[position] = (uint32_t)(parentIndexesData.length / sizeof(uint32_t));
+
+		uint32_t source = sources[position];
+		if (source < existingCount) {
+			uint32_t cursor = 0;
+			uint32_t parent;
+			while ((parent = GTCommitGraphNextParent(table, source, &cursor)) != GTCommitGraphNotFound) {
+				uint32_t index = remap[parent];
+				[parentIndexesData appendBytes:&index length:sizeof(index)];
+			}
+		} else {
+			const GTCommitGraphPendingCommit *commit = &commits[source - existingCount];
+			for (NSUInteger k = 0; k < commit->parentCount; k++) {
+				uint32_t index = GTCommitGraphFindInOids(oids, count, &pendingParents[commit->firstParent + k]);
+				NSCAssert(index != GTCommitGraphNotFound, @"Parent of a pending commit is missing from the graph");
+				[parentIndexesData appendBytes:&index length:sizeof(index)];
+			}
+		}
+	}
+
+	parentStarts[count] = (uint32_t)(parentIndexesData.length / sizeof(uint32_t));
+	const uint32_t *parentIndexes = parentIndexesData.bytes;
+
+	// Number the pending commits, parents first.
+	NSMutableData *generationsData = [NSMutableData dataWithLength:(NSUInteger)count * sizeof(uint32_t)];
+	uint32_t *generations = generationsData.mutableBytes;
+	for (uint32_t position = 0; position < count; position++) {
+		if (sources[position] < existingCount) generations[position] = GTCommitGraphGeneration(table, sources[position]);
+	}
+
+	NSMutableData *stack = [NSMutableData data];
+	for (uint32_t position = 0; position < count; position++) {
+		if (generations[position] != 0) continue;
+
+		[stack appendBytes:&position length:sizeof(position)];
+		while (stack.length > 0) {
+			uint32_t index = ((const uint32_t *)stack.bytes)[stack.length / sizeof(uint32_t) - 1];
+			if (generations[index] != 0) {
+				stack.length -= sizeof(uint32_t);
+				continue;
+			}
+
+			uint32_t generation = 0;
+			BOOL ready = YES;
+			for (uint32_t k = parentStarts[index]; k < parentStarts[index + 1]; k++) {
+				uint32_t parent = parentIndexes[k];
+				if (generations[parent] == 0) {
+					ready = NO;
+					[stack appendBytes:&parent length:sizeof(parent)];
+				} else {
+					generation = MAX(generation, generations[parent]);
+				}
+			}
+
+			if (ready) {
+				generations[index] = generation + 1;
+				stack.length -= sizeof(uint32_t);
+			}
+		}
+	}
+
+	// Write it all out.
+	NSMutableData *data = [NSMutableData dataWithCapacity:GTCommitGraphHeaderSize + GTCommitGraphFanoutSize + (NSUInteger)count * (GIT_OID_RAWSZ + GTCommitGraphEntrySize)];
+	NSMutableData *extraEdges = [NSMutableData data];
+
+	[data appendBytes:GTCommitGraphMagic length:sizeof(GTCommitGraphMagic)];
+	GTCommitGraphAppendUInt32(data, GTCommitGraphVersion);
+	GTCommitGraphAppendUInt32(data, count);
+	NSUInteger extraEdgeCountOffset = data.length;
+	GTCommitGraphAppendUInt32(data, 0);
+
+	uint32_t fanout = 0;
+	for (NSUInteger byte = 0; byte < 256; byte++) {
+		while (fanout < count && oids[fanout].id[0] == byte) fanout++;
+		GTCommitGraphAppendUInt32(data, fanout);
+	}
+
+	[data appendBytes:oids length:(NSUInteger)count * sizeof(git_oid)];
+
+	for (uint32_t position = 0; position < count; position++) {
+		uint32_t source = sources[position];
+		if (source < existingCount) {
+			[data appendBytes:GTCommitGraphTree(table, source) length:sizeof(git_oid)];
+		} else {
+			[data appendBytes:&commits[source - existingCount].tree length:sizeof(git_oid)];
+		}
+
+		uint32_t parentCount = parentStarts[position + 1] - parentStarts[position];
+		const uint32_t *parents = parentIndexes + parentStarts[position];
+		GTCommitGraphAppendUInt32(data, parentCount > 0 ? parents[0] : GTCommitGraphParentNone);
+
+		if (parentCount <= 2) {
+			GTCommitGraphAppendUInt32(data, parentCount == 2 ? parents[1] : GTCommitGraphParentNone);
+		} else {
+			GTCommitGraphAppendUInt32(data, GTCommitGraphExtraEdges | (uint32_t)(extraEdges.length / sizeof(uint32_t)));
+			for (uint32_t k = 1; k < parentCount; k++) {
+				GTCommitGraphAppendUInt32(extraEdges, parents[k] | (k == parentCount - 1 ? GTCommitGraphLastEdge : 0));
+			}
+		}
+
+		GTCommitGraphAppendUInt32(data, generations[position]);
+
+		int64_t time = (source < existingCount ? GTCommitGraphTime(table, source) : commits[source - existingCount].time);
+		GTCommitGraphAppendInt64(data, time);
+	}
+
+	[data appendData:extraEdges];
+
+	uint32_t extraEdgeCount = CFSwapInt32HostToLittle((uint32_t)(extraEdges.length / sizeof(uint32_t)));
+	[data replaceBytesInRange:NSMakeRange(extraEdgeCountOffset, sizeof(extraEdgeCount)) withBytes:&extraEdgeCount];
+
+	return data;
+}
+
+@end
@@ -0,0 +1,51 @@
+//
+//  GTDiff+Parallel.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTDiff.h"
+
+@class GTDiffPatch;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// An NSNumber with the number of patches to generate at once.
+///
+/// Defaults to the number of active processors.
+extern NSString *const GTDiffPatchOptionsConcurrencyKey;
+
+/// An NSNumber with the most patches which may be generated ahead of the one
+/// waiting to be passed to the block. This bounds how many patches are held in
+/// memory at once.
+///
+/// Defaults to four times the concurrency.
+extern NSString *const GTDiffPatchOptionsWindowKey;
+
+@interface GTDiff (Parallel)
+
+/// Generates the patch of every delta on several threads, and passes them to
+/// the block in delta order.
+///
+/// Every worker thread opens its own handle to the receiver's repository, and
+/// builds patches from the blobs on either side of their deltas. Deltas which
+/// can't be rebuilt that way, like renames, mode changes, working directory
+/// files and diffs created with -initWithGitDiff:repository:, are generated
+/// from the receiver one at a time instead.
+///
+/// This method blocks until the enumeration has finished, and calls the block
+/// on the calling thread. The receiver must not be used elsewhere until then.
+///
+/// options - A dictionary containing any of the GTDiffPatchOptions keys, or
+///           nil to use the defaults.
+/// error   - The error if a patch couldn't be generated.
+/// block   - Called with each patch, and how long it took to generate. Setting
+///           `stop` to YES stops the enumeration. Cannot be nil.
+///
+/// Returns whether every patch up to the end or to `stop` was generated.
+- (BOOL)enumeratePatchesWithOptions:(NSDictionary * _Nullable)options error:(NSError **)error usingBlock:(void (^)(GTDiffPatch *patch, NSTimeInterval generationTime, BOOL *stop))block;
+
+@end
+
+NS_ASSUME_NONNULL_END
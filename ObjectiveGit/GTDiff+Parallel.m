@@ -0,0 +1,220 @@
+//
+//  GTDiff+Parallel.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTDiff+Parallel.h"
+#import "GTBlob.h"
+#import "GTDiff+Private.h"
+#import "GTDiffDelta+Private.h"
+#import "GTDiffPatch.h"
+#import "GTRepository+Private.h"
+
+#import "git2/diff.h"
+#import "git2/errors.h"
+#import "git2/patch.h"
+
+NSString *const GTDiffPatchOptionsConcurrencyKey = @"GTDiffPatchOptionsConcurrencyKey";
+NSString *const GTDiffPatchOptionsWindowKey = @"GTDiffPatchOptionsWindowKey";
+
+// Whether a side of a delta is a regular file whose contents are in the object
+// database.
+static BOOL GTDiffFileIsBlob(const git_diff_file *file) {
+	return file->mode == GIT_FILEMODE_BLOB && (file->flags & GIT_DIFF_FLAG_VALID_ID) != 0;
+}
+
+// Whether git_patch_from_blobs produces the same patch as the diff would for
+// the given delta. It describes both sides as regular files at one path, so
+// only plain additions, deletions and modifications qualify.
+static BOOL GTDiffDeltaCanBeGeneratedFromBlobs(const git_diff_delta *delta) {
+	switch (delta->status) {
+		case GIT_DELTA_ADDED:
+			return GTDiffFileIsBlob(&delta->new_file);
+
+		case GIT_DELTA_DELETED:
+			return GTDiffFileIsBlob(&delta->old_file);
+
+		case GIT_DELTA_MODIFIED:
+			return GTDiffFileIsBlob(&delta->old_file) && GTDiffFileIsBlob(&delta->new_file) && strcmp(delta->old_file.path, delta->new_file.path) == 0;
+
+		default:
+			return NO;
+	}
+}
+
+// A generated patch waiting to be passed to the block.
+@interface GTDiffPatchResult : NSObject
+
+@property (nonatomic, strong) GTDiffPatch *patch;
+@property (nonatomic, strong) NSError *error;
+@property (nonatomic, assign) NSTimeInterval generationTime;
+
+@end
+
+@implementation GTDiffPatchResult
+@end
+
+@implementation GTDiff (Parallel)
+
+#pragma mark Enumeration
+
+- (BOOL)enumeratePatchesWithOptions:(NSDictionary *)options error:(NSError **)error usingBlock:(void (^)(GTDiffPatch *, NSTimeInterval, BOOL *))block {
+	NSParameterAssert(block != nil);
+
+	NSUInteger deltaCount = self.deltaCount;
+	if (deltaCount == 0) return YES;
+
+	NSNumber *concurrencyNumber = options[GTDiffPatchOptionsConcurrencyKey];
+	NSUInteger concurrency = MAX((concurrencyNumber != nil ? concurrencyNumber.unsignedIntegerValue : NSProcessInfo.processInfo.activeProcessorCount), (NSUInteger)1);
+	concurrency = MIN(concurrency, deltaCount);
+
+	NSNumber *windowNumber = options[GTDiffPatchOptionsWindowKey];
+	NSUInteger window = MAX((windowNumber != nil ? windowNumber.unsignedIntegerValue : concurrency * 4), (NSUInteger)1);
+
+	NSDictionary *blobOptions = [self blobPatchOptions];
+	NSURL *gitDirectoryURL = self.repository.gitDirectoryURL;
+	NSURL *workingDirectoryURL = self.repository.fileURL;
+
+	// Everything below is guarded by `condition`.
+	NSCondition *condition = [[NSCondition alloc] init];
+	NSMutableDictionary<NSNumber *, GTDiffPatchResult *> *results = [NSMutableDictionary dictionaryWithCapacity:window];
+	__block NSUInteger nextIndex = 0;
+	__block NSUInteger deliveryIndex = 0;
+	__block BOOL stopped = NO;
+
+	NSOperationQueue *workers = [[NSOperationQueue alloc] init];
+	workers.name = @"org.libgit2.ObjectiveGit.patches";
+	workers.maxConcurrentOperationCount = (NSInteger)concurrency;
+
+	for (NSUInteger worker = 0; worker < concurrency; worker++) {
+		[workers addOperationWithBlock:^{
+			// Without a handle of its own, a worker can still generate patches
+			// from the receiver.
+			GTRepository *repository = (gitDirectoryURL != nil && blobOptions != nil ? [[GTRepository alloc] initWithGitDirectoryURL:gitDirectoryURL workingDirectoryURL:workingDirectoryURL error:NULL] : nil);
+
+			while (YES) {
+				[condition lock];
+				while (!stopped && nextIndex < deltaCount && nextIndex >= deliveryIndex + window) {
+					[condition wait];
+				}
+
+				if (stopped || nextIndex >= deltaCount) {
+					[condition unlock];
+					break;
+				}
+
+				NSUInteger index = nextIndex++;
+				[condition unlock];
+
+				GTDiffPatchResult *result = [[GTDiffPatchResult alloc] init];
+				@autoreleasepool {
+					CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+					NSError *patchError = nil;
+					result.patch = [self generatePatchForDeltaAtIndex:index inRepository:repository options:blobOptions error:&patchError];
+					result.error = patchError;
+					result.generationTime = CFAbsoluteTimeGetCurrent() - start;
+				}
+
+				[condition lock];
+				results[@(index)] = result;
+				[condition broadcast];
+				[condition unlock];
+			}
+		}];
+	}
+
+	BOOL success = YES;
+	for (NSUInteger index = 0; index < deltaCount; index++) {
+		[condition lock];
+		GTDiffPatchResult *result = nil;
+		while ((result = results[@(index)]) == nil) {
+			[condition wait];
+		}
+
+		[results removeObjectForKey:@(index)];
+		deliveryIndex = index + 1;
+		[condition broadcast];
+		[condition unlock];
+
+		if (result.patch == nil) {
+			if (error != NULL) *error = result.error;
+			success = NO;
+			break;
+		}
+
+		BOOL stop = NO;
+		@autoreleasepool {
+			block(result.patch, result.generationTime, &stop);
+		}
+		if (stop) break;
+	}
+
+	[condition lock];
+	stopped = YES;
+	[condition broadcast];
+	[condition unlock];
+
+	[workers waitUntilAllOperationsAreFinished];
+
+	return success;
+}
+
+#pragma mark Patch Generation
+
+// The options to generate patches from blobs with, or nil if the receiver's
+// options aren't known.
+//
+// Reversing already happened when the deltas were created, so it's left out.
+- (NSDictionary *)blobPatchOptions {
+	NSDictionary *creationOptions = self.creationOptions;
+	if (creationOptions == nil) return nil;
+
+	NSNumber *flags = creationOptions[GTDiffOptionsFlagsKey];
+	if ((flags.unsignedIntegerValue & GIT_DIFF_REVERSE) == 0) return creationOptions;
+
+	NSMutableDictionary *options = [creationOptions mutableCopy];
+	options[GTDiffOptionsFlagsKey] = @(flags.unsignedIntegerValue & ~(NSUInteger)GIT_DIFF_REVERSE);
+	return options;
+}
+
+- (GTDiffPatch *)generatePatchForDeltaAtIndex:(NSUInteger)index inRepository:(GTRepository *)repository options:(NSDictionary *)options error:(NSError **)error {
+	const git_diff_delta *gitDelta = git_diff_get_delta(self.git_diff, index);
+	if (repository == nil || !GTDiffDeltaCanBeGeneratedFromBlobs(gitDelta)) {
+		// Generating a patch from the diff updates the diff, and reads through
+		// the receiver's repository.
+		@synchronized (self) {
+			return [[[GTDiffDelta alloc] initWithDiff:self deltaIndex:index] generatePatch:error];
+		}
+	}
+
+	GTBlob *oldBlob = nil;
+	if (gitDelta->status != GIT_DELTA_ADDED) {
+		oldBlob = [repository lookUpObjectByGitOid:&gitDelta->old_file.id objectType:GTObjectTypeBlob error:error];
+		if (oldBlob == nil) return nil;
+	}
+
+	GTBlob *newBlob = nil;
+	if (gitDelta->status != GIT_DELTA_DELETED) {
+		newBlob = [repository lookUpObjectByGitOid:&gitDelta->new_file.id objectType:GTObjectTypeBlob error:error];
+		if (newBlob == nil) return nil;
+	}
+
+	NSString *path = @(gitDelta->new_file.path ?: gitDelta->old_file.path);
+
+	// The delta describes the receiver's delta, but its patch is built from the
+	// blobs, which it keeps alive for as long as the patch needs them.
+	GTDiff *diff = self;
+	GTDiffDelta *delta = [[GTDiffDelta alloc] initWithGitDiffDeltaBlock:^{
+		return *(git_diff_get_delta(diff.git_diff, index));
+	} patchGeneratorBlock:^(git_patch **patch) {
+		return [GTDiff handleParsedOptionsDictionary:options usingBlock:^(git_diff_options *optionsStruct) {
+			return git_patch_from_blobs(patch, oldBlob.git_blob, path.UTF8String, newBlob.git_blob, path.UTF8String, optionsStruct);
+		}];
+	}];
+
+	return [delta generatePatch:error];
+}
+
+@end
@@ -10,6 +10,13 @@
 
 @interface GTDiff ()
 
+/// The repository the diff was created in.
+@property (nonatomic, strong, readonly) GTRepository * _Nonnull repository;
+
+/// The options the receiver was created with, or nil if they aren't known, as
+/// for diffs created with -initWithGitDiff:repository:.
+@property (nonatomic, copy) NSDictionary * _Nullable creationOptions;
+
 /// Parses a dictionary of diff options into a `git_diff_options` struct, then
 /// provides a pointer to that structure to the given `block`.
 ///
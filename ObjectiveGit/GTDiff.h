@@ -60,6 +60,13 @@ extern NSString *const GTDiffOptionsMaxSizeKey;
 /// Defaults to including all files.
 extern NSString *const GTDiffOptionsPathSpecArrayKey;
 
+/// A `GTCancellationToken` which stops the diff from being computed once it's
+/// cancelled. The token is checked before each file, and the diff then fails
+/// with a `GIT_EUSER` error.
+///
+/// Defaults to nil.
+extern NSString *const GTDiffOptionsCancellationTokenKey;
+
 /// Enum for use as documented in the options dictionary with the
 /// `GTDiffOptionsFlagsKey` key.
 ///
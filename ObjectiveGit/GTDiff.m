@@ -6,8 +6,9 @@
 //  Copyright (c) 2012 GitHub, Inc. All rights reserved.
 //
 
-#import "GTDiff.h"
+#import "GTDiff+Private.h"
 
+#import "GTCancellationToken.h"
 #import "GTCommit.h"
 #import "GTRepository.h"
 #import "GTTree.h"
@@ -26,6 +27,7 @@ NSString *const GTDiffOptionsOldPrefixKey = @"GTDiffOptionsOldPrefixKey";
 NSString *const GTDiffOptionsNewPrefixKey = @"GTDiffOptionsNewPrefixKey";
 NSString *const GTDiffOptionsMaxSizeKey = @"GTDiffOptionsMaxSizeKey";
 NSString *const GTDiffOptionsPathSpecArrayKey = @"GTDiffOptionsPathSpecArrayKey";
+NSString *const GTDiffOptionsCancellationTokenKey = @"GTDiffOptionsCancellationTokenKey";
 
 NSString *const GTDiffFindOptionsFlagsKey = @"GTDiffFindOptionsFlagsKey";
 NSString *const GTDiffFindOptionsRenameThresholdKey = @"GTDiffFindOptionsRenameThresholdKey";
@@ -38,10 +40,17 @@ NSString *const GTDiffFindOptionsRenameLimitKey = @"GTDiffFindOptionsRenameLimit
 
 @property (nonatomic, assign, readonly) git_diff *git_diff;
 
-@property (nonatomic, strong, readonly) GTRepository *repository;
+// Initializes the receiver, remembering the options it was created with.
+- (instancetype)initWithGitDiff:(git_diff *)diff repository:(GTRepository *)repository creationOptions:(NSDictionary *)options;
 
 @end
 
+// Called by libgit2 before each file is diffed, so the diff can be abandoned.
+static int GTDiffProgressCallback(const git_diff *diff, const char *oldPath, const char *newPath, void *payload) {
+	GTCancellationToken *cancellationToken = (__bridge GTCancellationToken *)payload;
+	return (cancellationToken.cancelled ? GIT_EUSER : 0);
+}
+
 @implementation GTDiff
 
 + (int)handleParsedOptionsDictionary:(NSDictionary *)dictionary usingBlock:(int (^)(git_diff_options *optionsStruct))block {
@@ -74,6 +83,12 @@ NSString *const GTDiffFindOptionsRenameLimitKey = @"GTDiffFindOptionsRenameLimit
 		git_strarray_free((git_strarray *)&strArray);
 	};
 
+	GTCancellationToken *cancellationToken = dictionary[GTDiffOptionsCancellationTokenKey];
+	if (cancellationToken != nil) {
+		newOptions.progress_cb = GTDiffProgressCallback;
+		newOptions.payload = (__bridge void *)cancellationToken;
+	}
+
 	git_diff_options *optionsPtr = &newOptions;
 	if (dictionary.count < 1) optionsPtr = nil;
 
@@ -92,7 +107,7 @@ NSString *const GTDiffFindOptionsRenameLimitKey = @"GTDiffFindOptionsRenameLimit
 		return nil;
 	}
 	
-	return [[self alloc] initWithGitDiff:diff repository:repository];
+	return [[self alloc] initWithGitDiff:diff repository:repository creationOptions:options];
 }
 
 + (instancetype)diffOldTree:(GTTree *)oldTree withNewIndex:(GTIndex *)newIndex inRepository:(GTRepository *)repository options:(NSDictionary *)options error:(NSError **)error {
@@ -107,7 +122,7 @@ NSString *const GTDiffFindOptionsRenameLimitKey = @"GTDiffFindOptionsRenameLimit
 		return nil;
 	}
 	
-	return [[self alloc] initWithGitDiff:diff repository:repository];
+	return [[self alloc] initWithGitDiff:diff repository:repository creationOptions:options];
 }
 
 + (instancetype)diffOldIndex:(GTIndex *)oldIndex withNewIndex:(GTIndex *)newIndex inRepository:(GTRepository *)repository options:(NSDictionary *)options error:(NSError **)error
@@ -123,7 +138,7 @@ NSString *const GTDiffFindOptionsRenameLimitKey = @"GTDiffFindOptionsRenameLimit
 		return nil;
 	}
 	
-	return [[self alloc] initWithGitDiff:diff repository:repository];
+	return [[self alloc] initWithGitDiff:diff repository:repository creationOptions:options];
 }
 
 + (instancetype)diffIndexFromTree:(GTTree *)tree inRepository:(GTRepository *)repository options:(NSDictionary *)options error:(NSError **)error {
@@ -139,7 +154,7 @@ NSString *const GTDiffFindOptionsRenameLimitKey = @"GTDiffFindOptionsRenameLimit
 		return nil;
 	}
 	
-	return [[self alloc] initWithGitDiff:diff repository:repository];
+	return [[self alloc] initWithGitDiff:diff repository:repository creationOptions:options];
 }
 
 + (instancetype)diffIndexToWorkingDirectoryInRepository:(GTRepository *)repository options:(NSDictionary *)options error:(NSError **)error {
@@ -154,7 +169,7 @@ NSString *const GTDiffFindOptionsRenameLimitKey = @"GTDiffFindOptionsRenameLimit
 		return nil;
 	}
 	
-	return [[self alloc] initWithGitDiff:diff repository:repository];
+	return [[self alloc] initWithGitDiff:diff repository:repository creationOptions:options];
 }
 
 + (instancetype)diffWorkingDirectoryFromTree:(GTTree *)tree inRepository:(GTRepository *)repository options:(NSDictionary *)options error:(NSError **)error {
@@ -170,7 +185,7 @@ NSString *const GTDiffFindOptionsRenameLimitKey = @"GTDiffFindOptionsRenameLimit
 		return nil;
 	}
 	
-	return [[self alloc] initWithGitDiff:diff repository:repository];
+	return [[self alloc] initWithGitDiff:diff repository:repository creationOptions:options];
 }
 
 + (instancetype)diffWorkingDirectoryToHEADInRepository:(GTRepository *)repository options:(NSDictionary *)options error:(NSError **)error {
@@ -206,6 +221,15 @@ NSString *const GTDiffFindOptionsRenameLimitKey = @"GTDiffFindOptionsRenameLimit
 	return self;
 }
 
+- (instancetype)initWithGitDiff:(git_diff *)diff repository:(GTRepository *)repository creationOptions:(NSDictionary *)options {
+	self = [self initWithGitDiff:diff repository:repository];
+	if (self == nil) return nil;
+
+	_creationOptions = [options copy] ?: @{};
+
+	return self;
+}
+
 - (void)dealloc {
 	if (_git_diff != NULL) {
 		git_diff_free(_git_diff);
@@ -275,6 +299,9 @@ NSString *const GTDiffFindOptionsRenameLimitKey = @"GTDiffFindOptionsRenameLimit
 		return NO;
 	}
 
+	// The merged deltas may have been created differently.
+	if (![diff.creationOptions isEqual:self.creationOptions]) self.creationOptions = nil;
+
 	return YES;
 }
 
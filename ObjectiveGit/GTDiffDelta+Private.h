@@ -0,0 +1,24 @@
+//
+//  GTDiffDelta+Private.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTDiffDelta.h"
+
+#import "git2/patch.h"
+
+@interface GTDiffDelta ()
+
+/// Initializes the diff delta with blocks that will fulfill its contract.
+///
+/// deltaAccessor  - A block that will return the `git_diff_delta` underlying
+///                  this object. Must not be nil.
+/// patchGenerator - A block that will be used to lazily generate a patch for
+///                  the given diff delta. Must not be nil.
+///
+/// This is the designated initializer for this class.
+- (instancetype _Nonnull)initWithGitDiffDeltaBlock:(git_diff_delta (^ _Nonnull)(void))deltaAccessor patchGeneratorBlock:(int (^ _Nonnull)(git_patch * _Nullable * _Nonnull patch))patchGenerator NS_DESIGNATED_INITIALIZER;
+
+@end
@@ -6,7 +6,7 @@
 //  Copyright (c) 2012 GitHub, Inc. All rights reserved.
 //
 
-#import "GTDiffDelta.h"
+#import "GTDiffDelta+Private.h"
 
 #import "GTBlob.h"
 #import "GTDiff+Private.h"
@@ -24,16 +24,6 @@
 /// Used to generate a patch from this delta.
 @property (nonatomic, copy, readonly) int (^patchGenerator)(git_patch **patch);
 
-/// Initializes the diff delta with blocks that will fulfill its contract.
-///
-/// deltaAccessor  - A block that will return the `git_diff_delta` underlying
-///                  this object. Must not be nil.
-/// patchGenerator - A block that will be used to lazily generate a patch for
-///                  the given diff delta. Must not be nil.
-///
-/// This is the designated initializer for this class.
-- (instancetype)initWithGitDiffDeltaBlock:(git_diff_delta (^)(void))deltaAccessor patchGeneratorBlock:(int (^)(git_patch **patch))patchGenerator NS_DESIGNATED_INITIALIZER;
-
 @end
 
 @implementation GTDiffDelta
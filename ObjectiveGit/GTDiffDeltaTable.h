@@ -0,0 +1,112 @@
+//
+//  GTDiffDeltaTable.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "git2/oid.h"
+#import "GTDiffDelta.h"
+
+@class GTDiff;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The orders a GTDiffDeltaTable can be sorted in.
+///
+/// GTDiffDeltaTableOrderDelta  - The order of the deltas in the diff.
+/// GTDiffDeltaTableOrderPath   - By new path, comparing bytes like git does.
+/// GTDiffDeltaTableOrderStatus - By delta type, then by new path.
+typedef NS_ENUM(NSInteger, GTDiffDeltaTableOrder) {
+	GTDiffDeltaTableOrderDelta,
+	GTDiffDeltaTableOrderPath,
+	GTDiffDeltaTableOrderStatus,
+};
+
+/// A compact copy of the deltas of a diff.
+///
+/// Every field is kept in its own C array, and the paths share one block, so a
+/// table costs a few dozen bytes per delta instead of an object graph. Wrappers
+/// are only created when asked for with -deltaAtIndex:.
+///
+/// Rows are addressed by their index in the table's current order. Tables
+/// aren't thread safe.
+@interface GTDiffDeltaTable : NSObject
+
+/// The diff the table was copied from.
+@property (nonatomic, readonly, strong) GTDiff *diff;
+
+/// The number of rows in the table.
+@property (nonatomic, readonly, assign) NSUInteger count;
+
+/// The order the rows are currently in.
+@property (nonatomic, readonly, assign) GTDiffDeltaTableOrder order;
+
+/// Copies the deltas of a diff.
+///
+/// diff  - The diff to copy. Cannot be nil.
+/// error - The error if one occurred.
+///
+/// Returns the table, or nil if an error occurred.
++ (instancetype _Nullable)deltaTableWithDiff:(GTDiff *)diff error:(NSError **)error;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Copies the deltas of a diff, in delta order. Designated initializer.
+///
+/// Deltas are copied as they are when the table is created. Finding similar
+/// deltas or merging another diff afterwards changes the diff, but not the
+/// table, so wrappers created by -deltaAtIndex: would no longer match it.
+///
+/// diff  - The diff to copy. Cannot be nil.
+/// error - The error if one occurred.
+///
+/// Returns the initialized table, or nil if an error occurred.
+- (instancetype _Nullable)initWithDiff:(GTDiff *)diff error:(NSError **)error NS_DESIGNATED_INITIALIZER;
+
+/// Sorts the rows. Rows which compare equal stay in delta order.
+///
+/// order - The order to sort the rows in.
+- (void)sortUsingOrder:(GTDiffDeltaTableOrder)order;
+
+/// The index of the row's delta in the diff.
+- (NSUInteger)deltaIndexAtIndex:(NSUInteger)index;
+
+/// The type of the row's delta.
+- (GTDeltaType)typeAtIndex:(NSUInteger)index;
+
+/// The similarity of the row's delta, between 0 and 1.
+- (double)similarityAtIndex:(NSUInteger)index;
+
+/// The flags of the row's delta, as they were when the table was created.
+- (GTDiffFileFlag)flagsAtIndex:(NSUInteger)index;
+
+/// The path of the old file, which lives as long as the receiver.
+- (const char *)pathOfOldFileAtIndex:(NSUInteger)index NS_RETURNS_INNER_POINTER;
+
+/// The path of the new file, which lives as long as the receiver.
+- (const char *)pathOfNewFileAtIndex:(NSUInteger)index NS_RETURNS_INNER_POINTER;
+
+/// The OID of the old file, which lives as long as the receiver.
+- (const git_oid *)OIDOfOldFileAtIndex:(NSUInteger)index;
+
+/// The OID of the new file, which lives as long as the receiver.
+- (const git_oid *)OIDOfNewFileAtIndex:(NSUInteger)index;
+
+/// The mode of the old file.
+- (mode_t)modeOfOldFileAtIndex:(NSUInteger)index;
+
+/// The mode of the new file.
+- (mode_t)modeOfNewFileAtIndex:(NSUInteger)index;
+
+/// Creates a delta wrapping the row's delta in the diff.
+///
+/// index - The index of the row. Must be less than `count`.
+///
+/// Returns the delta, or nil if an error occurred.
+- (GTDiffDelta * _Nullable)deltaAtIndex:(NSUInteger)index;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,227 @@
+//
+//  GTDiffDeltaTable.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTDiffDeltaTable.h"
+#import "GTDiff.h"
+#import "NSError+Git.h"
+
+#import "git2/errors.h"
+
+@interface GTDiffDeltaTable () {
+	// The columns, indexed by delta index.
+	uint8_t *_statuses;
+	uint16_t *_similarities;
+	uint32_t *_flags;
+	uint16_t *_oldModes;
+	uint16_t *_newModes;
+	git_oid *_oldOIDs;
+	git_oid *_newOIDs;
+	uint32_t *_oldPathOffsets;
+	uint32_t *_newPathOffsets;
+
+	// Every path, NUL terminated.
+	char *_paths;
+
+	// The delta index of each row, in the current order.
+	uint32_t *_rows;
+}
+
+@property (nonatomic, readwrite, assign) GTDiffDeltaTableOrder order;
+
+@end
+
+@implementation GTDiffDeltaTable
+
+#pragma mark Lifecycle
+
++ (instancetype)deltaTableWithDiff:(GTDiff *)diff error:(NSError **)error {
+	return [[self alloc] initWithDiff:diff error:error];
+}
+
+- (instancetype)init {
+	NSAssert(NO, @"Call to an unavailable initializer.");
+	return nil;
+}
+
+- (instancetype)initWithDiff:(GTDiff *)diff error:(NSError **)error {
+	NSParameterAssert(diff != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_diff = diff;
+
+	git_diff *gitDiff = diff.git_diff;
+	size_t count = git_diff_num_deltas(gitDiff);
+
+	// Most deltas have the same path on both sides, which is then only stored
+	// once.
+	size_t pathsLength = 0;
+	for (size_t idx = 0; idx < count; idx++) {
+		const git_diff_delta *delta = git_diff_get_delta(gitDiff, idx);
+		pathsLength += strlen(delta->old_file.path) + 1;
+		if (strcmp(delta->old_file.path, delta->new_file.path) != 0) pathsLength += strlen(delta->new_file.path) + 1;
+	}
+
+	if (count > UINT32_MAX || pathsLength > UINT32_MAX) {
+		if (error != NULL) *error = [NSError git_errorFor:GIT_ERROR description:@"The diff is too large for a delta table"];
+		return nil;
+	}
+
+	size_t allocationCount = MAX(count, (size_t)1);
+	_statuses = malloc(allocationCount * sizeof(*_statuses));
+	_similarities = malloc(allocationCount * sizeof(*_similarities));
+	_flags = malloc(allocationCount * sizeof(*_flags));
+	_oldModes = malloc(allocationCount * sizeof(*_oldModes));
+	_newModes = malloc(allocationCount * sizeof(*_newModes));
+	_oldOIDs = malloc(allocationCount * sizeof(*_oldOIDs));
+	_newOIDs = malloc(allocationCount * sizeof(*_newOIDs));
+	_oldPathOffsets = malloc(allocationCount * sizeof(*_oldPathOffsets));
+	_newPathOffsets = malloc(allocationCount * sizeof(*_newPathOffsets));
+	_rows = malloc(allocationCount * sizeof(*_rows));
+	_paths = malloc(MAX(pathsLength, (size_t)1));
+
+	if (_statuses == NULL || _similarities == NULL || _flags == NULL || _oldModes == NULL || _newModes == NULL || _oldOIDs == NULL || _newOIDs == NULL || _oldPathOffsets == NULL || _newPathOffsets == NULL || _rows == NULL || _paths == NULL) {
+		if (error != NULL) *error = [NSError git_errorFor:GIT_ERROR description:@"Failed to allocate the delta table"];
+		return nil;
+	}
+
+	uint32_t pathOffset = 0;
+	for (size_t idx = 0; idx < count; idx++) {
+		const git_diff_delta *delta = git_diff_get_delta(gitDiff, idx);
+
+		_statuses[idx] = (uint8_t)delta->status;
+		_similarities[idx] = delta->similarity;
+		_flags[idx] = delta->flags;
+		_oldModes[idx] = delta->old_file.mode;
+		_newModes[idx] = delta->new_file.mode;
+		git_oid_cpy(&_oldOIDs[idx], &delta->old_file.id);
+		git_oid_cpy(&_newOIDs[idx], &delta->new_file.id);
+		_rows[idx] = (uint32_t)idx;
+
+		size_t oldPathLength = strlen(delta->old_file.path) + 1;
+		memcpy(_paths + pathOffset, delta->old_file.path, oldPathLength);
+		_oldPathOffsets[idx] = pathOffset;
+		_newPathOffsets[idx] = pathOffset;
+		pathOffset += oldPathLength;
+
+		if (strcmp(delta->old_file.path, delta->new_file.path) != 0) {
+			size_t newPathLength = strlen(delta->new_file.path) + 1;
+			memcpy(_paths + pathOffset, delta->new_file.path, newPathLength);
+			_newPathOffsets[idx] = pathOffset;
+			pathOffset += newPathLength;
+		}
+	}
+
+	_count = count;
+	_order = GTDiffDeltaTableOrderDelta;
+
+	return self;
+}
+
+- (void)dealloc {
+	free(_statuses);
+	free(_similarities);
+	free(_flags);
+	free(_oldModes);
+	free(_newModes);
+	free(_oldOIDs);
+	free(_newOIDs);
+	free(_oldPathOffsets);
+	free(_newPathOffsets);
+	free(_rows);
+	free(_paths);
+}
+
+#pragma mark Sorting
+
+- (void)sortUsingOrder:(GTDiffDeltaTableOrder)order {
+	if (_count > 1) {
+		const uint8_t *statuses = _statuses;
+		const uint32_t *newPathOffsets = _newPathOffsets;
+		const char *paths = _paths;
+
+		// Comparing delta indexes last keeps the sort stable.
+		qsort_b(_rows, _count, sizeof(*_rows), ^(const void *a, const void *b) {
+			uint32_t left = *(const uint32_t *)a;
+			uint32_t right = *(const uint32_t *)b;
+
+			if (order == GTDiffDeltaTableOrderStatus && statuses[left] != statuses[right]) {
+				return (statuses[left] < statuses[right] ? -1 : 1);
+			}
+
+			if (order != GTDiffDeltaTableOrderDelta) {
+				int result = strcmp(paths + newPathOffsets[left], paths + newPathOffsets[right]);
+				if (result != 0) return result;
+			}
+
+			return (left < right ? -1 : (left > right ? 1 : 0));
+		});
+	}
+
+	self.order = order;
+}
+
+#pragma mark Rows
+
+// Returns the delta index of the row at `index`.
+- (uint32_t)rowAtIndex:(NSUInteger)index {
+	NSParameterAssert(index < _count);
+	return _rows[index];
+}
+
+- (NSUInteger)deltaIndexAtIndex:(NSUInteger)index {
+	return [self rowAtIndex:index];
+}
+
+- (GTDeltaType)typeAtIndex:(NSUInteger)index {
+	return (GTDeltaType)_statuses[[self rowAtIndex:index]];
+}
+
+- (double)similarityAtIndex:(NSUInteger)index {
+	return (double)(_similarities[[self rowAtIndex:index]] / 100.0);
+}
+
+- (GTDiffFileFlag)flagsAtIndex:(NSUInteger)index {
+	return (GTDiffFileFlag)_flags[[self rowAtIndex:index]];
+}
+
+- (const char *)pathOfOldFileAtIndex:(NSUInteger)index {
+	return _paths + _oldPathOffsets[[self rowAtIndex:index]];
+}
+
+- (const char *)pathOfNewFileAtIndex:(NSUInteger)index {
+	return _paths + _newPathOffsets[[self rowAtIndex:index]];
+}
+
+- (const git_oid *)OIDOfOldFileAtIndex:(NSUInteger)index {
+	return &_oldOIDs[[self rowAtIndex:index]];
+}
+
+- (const git_oid *)OIDOfNewFileAtIndex:(NSUInteger)index {
+	return &_newOIDs[[self rowAtIndex:index]];
+}
+
+- (mode_t)modeOfOldFileAtIndex:(NSUInteger)index {
+	return _oldModes[[self rowAtIndex:index]];
+}
+
+- (mode_t)modeOfNewFileAtIndex:(NSUInteger)index {
+	return _newModes[[self rowAtIndex:index]];
+}
+
+- (GTDiffDelta *)deltaAtIndex:(NSUInteger)index {
+	return [[GTDiffDelta alloc] initWithDiff:self.diff deltaIndex:[self rowAtIndex:index]];
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p>{ count: %lu, order: %ld }", self.class, self, (unsigned long)self.count, (long)self.order];
+}
+
+@end
@@ -7,8 +7,8 @@
 //
 
 #import <Foundation/Foundation.h>
+#import "GTDiffLine.h"
 
-@class GTDiffLine;
 @class GTDiffPatch;
 
 NS_ASSUME_NONNULL_BEGIN
@@ -59,6 +59,23 @@ NS_ASSUME_NONNULL_BEGIN
 /// be set in `error`).
 - (BOOL)enumerateLinesInHunk:(NSError **)error usingBlock:(void (^)(GTDiffLine *line, BOOL *stop))block;
 
+/// Performs the given block on each line in the hunk, without creating objects
+/// or copying content.
+///
+/// Each span points into the patch the hunk came from, which the receiver keeps
+/// alive. The content stays valid for as long as the receiver or that patch.
+///
+/// Note that this method blocks during the enumeration.
+///
+/// error - A pointer to an NSError that will be set if one occurs.
+/// block - A block to execute on each line. Setting `stop` to `YES` will
+///         immediately stop the enumeration and return from the method. Must
+///         not be nil.
+///
+/// Return YES if the enumeration was successful, NO otherwise (and an error will
+/// be set in `error`).
+- (BOOL)enumerateLineSpansWithError:(NSError **)error usingBlock:(void (^)(GTDiffLineSpan span, BOOL *stop))block;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -61,6 +61,15 @@
 - (BOOL)enumerateLinesInHunk:(NSError **)error usingBlock:(void (^)(GTDiffLine *line, BOOL *stop))block {
 	NSParameterAssert(block != nil);
 
+	return [self enumerateLineSpansWithError:error usingBlock:^(GTDiffLineSpan span, BOOL *stop) {
+		GTDiffLine *line = [[GTDiffLine alloc] initWithLineSpan:span];
+		block(line, stop);
+	}];
+}
+
+- (BOOL)enumerateLineSpansWithError:(NSError **)error usingBlock:(void (^)(GTDiffLineSpan span, BOOL *stop))block {
+	NSParameterAssert(block != nil);
+
 	for (NSUInteger idx = 0; idx < self.lineCount; idx ++) {
 		const git_diff_line *gitLine;
 		int result = git_patch_get_line_in_hunk(&gitLine, self.patch.git_patch, self.hunkIndex, idx);
@@ -69,10 +78,18 @@
 			if (error) *error = [NSError git_errorFor:result description:@"Extracting line from hunk failed"];
 			return NO;
 		}
-		GTDiffLine *line = [[GTDiffLine alloc] initWithGitLine:gitLine];
+
+		GTDiffLineSpan span = {
+			.origin = gitLine->origin,
+			.oldLineNumber = gitLine->old_lineno,
+			.newLineNumber = gitLine->new_lineno,
+			.lineCount = gitLine->num_lines,
+			.content = gitLine->content,
+			.contentLength = gitLine->content_len,
+		};
 
 		BOOL stop = NO;
-		block(line, &stop);
+		block(span, &stop);
 		if (stop) break;
 	}
 	return YES;
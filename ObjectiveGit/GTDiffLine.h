@@ -23,6 +23,26 @@ typedef NS_ENUM(char, GTDiffLineOrigin) {
 
 NS_ASSUME_NONNULL_BEGIN
 
+/// A line in a diff hunk, pointing into the content of the patch it came from.
+///
+/// origin        - The origin of the line.
+/// oldLineNumber - The line number in the left side of the diff, or -1 if the
+///                 line is an addition.
+/// newLineNumber - The line number in the right side of the diff, or -1 if the
+///                 line is a deletion.
+/// lineCount     - The number of newlines in the content.
+/// content       - The content of the line, including its newline. It isn't
+///                 NUL terminated, and is only valid as long as the patch.
+/// contentLength - The length of the content, in bytes.
+typedef struct {
+	GTDiffLineOrigin origin;
+	NSInteger oldLineNumber;
+	NSInteger newLineNumber;
+	NSInteger lineCount;
+	const char *content;
+	NSUInteger contentLength;
+} GTDiffLineSpan;
+
 /// Represents an individual line in a diff hunk.
 @interface GTDiffLine : NSObject
 
@@ -47,12 +67,19 @@ NS_ASSUME_NONNULL_BEGIN
 
 - (instancetype)init NS_UNAVAILABLE;
 
-/// Designated initialiser.
+/// Initializes the receiver with a copy of the given line.
 ///
 /// line - The diff line to wrap. May not be NULL.
 ///
 /// Returns a diff line, or nil if an error occurs.
-- (instancetype _Nullable)initWithGitLine:(const git_diff_line *)line NS_DESIGNATED_INITIALIZER;
+- (instancetype _Nullable)initWithGitLine:(const git_diff_line *)line;
+
+/// Designated initialiser.
+///
+/// span - The line to copy. Its content is decoded into a string.
+///
+/// Returns a diff line, or nil if an error occurs.
+- (instancetype _Nullable)initWithLineSpan:(GTDiffLineSpan)span NS_DESIGNATED_INITIALIZER;
 
 @end
 
@@ -16,10 +16,23 @@
 }
 
 - (instancetype)initWithGitLine:(const git_diff_line *)line {
+	NSParameterAssert(line != NULL);
+
+	return [self initWithLineSpan:(GTDiffLineSpan){
+		.origin = line->origin,
+		.oldLineNumber = line->old_lineno,
+		.newLineNumber = line->new_lineno,
+		.lineCount = line->num_lines,
+		.content = line->content,
+		.contentLength = line->content_len,
+	}];
+}
+
+- (instancetype)initWithLineSpan:(GTDiffLineSpan)span {
 	self = [super init];
 	if (self == nil) return nil;
 
-	NSData *lineData = [[NSData alloc] initWithBytesNoCopy:(void *)line->content length:line->content_len freeWhenDone:NO];
+	NSData *lineData = [[NSData alloc] initWithBytesNoCopy:(void *)span.content length:span.contentLength freeWhenDone:NO];
 
 	NSArray *encodings = @[
 		@(NSUTF8StringEncoding),
@@ -39,10 +52,10 @@
 	}];
 
 	_content = [string stringByTrimmingCharactersInSet:NSCharacterSet.newlineCharacterSet];
-	_oldLineNumber = line->old_lineno;
-	_newLineNumber = line->new_lineno;
-	_origin = line->origin;
-	_lineCount = line->num_lines;
+	_oldLineNumber = span.oldLineNumber;
+	_newLineNumber = span.newLineNumber;
+	_origin = span.origin;
+	_lineCount = span.lineCount;
 	
 	return self;
 }
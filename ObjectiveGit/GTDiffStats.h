@@ -0,0 +1,126 @@
+//
+//  GTDiffStats.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "git2/diff.h"
+
+@class GTCommit;
+@class GTDiff;
+@class GTRepository;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The formats stats can be printed in.
+///
+/// See diff.h for documentation of each individual format.
+typedef NS_OPTIONS(NSUInteger, GTDiffStatsFormat) {
+	GTDiffStatsFormatNone = GIT_DIFF_STATS_NONE,
+	GTDiffStatsFormatFull = GIT_DIFF_STATS_FULL,
+	GTDiffStatsFormatShort = GIT_DIFF_STATS_SHORT,
+	GTDiffStatsFormatNumber = GIT_DIFF_STATS_NUMBER,
+	GTDiffStatsFormatIncludeSummary = GIT_DIFF_STATS_INCLUDE_SUMMARY,
+};
+
+/// The line counts of a single file in a diff.
+///
+/// path       - The file's new path, which is also its path if it was deleted.
+///              It's owned by the GTDiffStats it came from.
+/// insertions - The number of added lines. Always 0 for binary files.
+/// deletions  - The number of deleted lines. Always 0 for binary files.
+/// binary     - Whether the file was treated as binary.
+typedef struct {
+	const char *path;
+	NSUInteger insertions;
+	NSUInteger deletions;
+	BOOL binary;
+} GTDiffFileStats;
+
+/// The number of files and lines changed by a diff.
+///
+/// Stats are counted straight from libgit2's patches, without creating a
+/// GTDiffPatch for every delta.
+@interface GTDiffStats : NSObject
+
+/// The diff the stats were counted from, or nil for stats counted by
+/// +statsForCommitPairs:inRepository:options:concurrency:error:, which don't
+/// keep their diffs.
+@property (nonatomic, readonly, strong) GTDiff * _Nullable diff;
+
+/// The number of files changed.
+@property (nonatomic, readonly, assign) NSUInteger filesChanged;
+
+/// The number of added lines across every file.
+@property (nonatomic, readonly, assign) NSUInteger insertions;
+
+/// The number of deleted lines across every file.
+@property (nonatomic, readonly, assign) NSUInteger deletions;
+
+/// The stats of each file, in delta order. There are `filesChanged` of them,
+/// and they live as long as the receiver.
+@property (nonatomic, readonly, assign) const GTDiffFileStats *fileStats NS_RETURNS_INNER_POINTER;
+
+/// Counts the stats of every commit pair at once.
+///
+/// Each worker opens its own handle to the repository. Repositories without a
+/// git directory on disk are counted one pair at a time.
+///
+/// Only the counts are kept, so the stats can't be printed with
+/// -formattedStatsWithFormat:width:error:.
+///
+/// pairs       - An array of two element arrays, each holding the old commit
+///               and the new commit to diff. The old commit may be NSNull to
+///               diff against an empty tree. Cannot be nil.
+/// repository  - The repository the commits are in. Cannot be nil.
+/// options     - The options to create the diffs with, as for
+///               +[GTDiff diffOldTree:withNewTree:inRepository:options:error:].
+///               May be nil.
+/// concurrency - The most pairs to count at once, or 0 for the number of
+///               active processors.
+/// error       - The error if one occurred.
+///
+/// Returns the stats of each pair, in the same order, or nil if any pair
+/// couldn't be counted.
++ (NSArray<GTDiffStats *> * _Nullable)statsForCommitPairs:(NSArray<NSArray *> *)pairs inRepository:(GTRepository *)repository options:(NSDictionary * _Nullable)options concurrency:(NSUInteger)concurrency error:(NSError **)error;
+
+/// Counts the stats of a diff.
+///
+/// diff  - The diff to count. Cannot be nil.
+/// error - The error if one occurred.
+///
+/// Returns the stats, or nil if an error occurred.
++ (instancetype _Nullable)statsWithDiff:(GTDiff *)diff error:(NSError **)error;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Counts the stats of a diff. Designated initializer.
+///
+/// This generates the patch of every delta, so it blocks for as long as that
+/// takes.
+///
+/// diff  - The diff to count. Cannot be nil.
+/// error - The error if one occurred.
+///
+/// Returns the initialized stats, or nil if an error occurred.
+- (instancetype _Nullable)initWithDiff:(GTDiff *)diff error:(NSError **)error NS_DESIGNATED_INITIALIZER;
+
+/// Prints the stats the way git does.
+///
+/// The receiver's diff is counted again by git_diff_get_stats, so it shouldn't
+/// have been changed since the receiver was created. Fails if the receiver
+/// has no diff.
+///
+/// format - The format to print in.
+/// width  - The width to lay out the full format for, like `git diff --stat`
+///          in a terminal that wide.
+/// error  - The error if one occurred.
+///
+/// Returns the printed stats, or nil if an error occurred.
+- (NSString * _Nullable)formattedStatsWithFormat:(GTDiffStatsFormat)format width:(NSUInteger)width error:(NSError **)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,252 @@
+//
+//  GTDiffStats.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTDiffStats.h"
+#import "GTCommit.h"
+#import "GTDiff.h"
+#import "GTOID.h"
+#import "GTRepository.h"
+#import "NSError+Git.h"
+
+#import "git2/buffer.h"
+#import "git2/errors.h"
+#import "git2/patch.h"
+
+@interface GTDiffStats () {
+	GTDiffFileStats *_fileStats;
+	char *_paths;
+}
+
+@property (nonatomic, readwrite, strong) GTDiff *diff;
+
+@end
+
+@implementation GTDiffStats
+
+#pragma mark Lifecycle
+
++ (instancetype)statsWithDiff:(GTDiff *)diff error:(NSError **)error {
+	return [[self alloc] initWithDiff:diff error:error];
+}
+
+- (instancetype)init {
+	NSAssert(NO, @"Call to an unavailable initializer.");
+	return nil;
+}
+
+- (instancetype)initWithDiff:(GTDiff *)diff error:(NSError **)error {
+	NSParameterAssert(diff != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_diff = diff;
+
+	git_diff *gitDiff = diff.git_diff;
+	size_t count = git_diff_num_deltas(gitDiff);
+
+	// Every path is copied into one block, so the stats don't depend on the
+	// diff staying as it is.
+	size_t pathsLength = 0;
+	for (size_t idx = 0; idx < count; idx++) {
+		pathsLength += strlen(git_diff_get_delta(gitDiff, idx)->new_file.path) + 1;
+	}
+
+	_fileStats = calloc(MAX(count, (size_t)1), sizeof(*_fileStats));
+	_paths = malloc(MAX(pathsLength, (size_t)1));
+	if (_fileStats == NULL || _paths == NULL) {
+		if (error != NULL) *error = [NSError git_errorFor:GIT_ERROR description:@"Failed to allocate the diff stats"];
+		return nil;
+	}
+
+	char *path = _paths;
+	for (size_t idx = 0; idx < count; idx++) {
+		git_patch *patch = NULL;
+		int gitError = git_patch_from_diff(&patch, gitDiff, idx);
+		if (gitError != GIT_OK) {
+			if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to generate patch"];
+			return nil;
+		}
+
+		// The delta is only complete once its patch has been generated, since
+		// that's when binary files are detected.
+		const git_diff_delta *delta = git_diff_get_delta(gitDiff, idx);
+		GTDiffFileStats *stats = &_fileStats[idx];
+
+		size_t pathLength = strlen(delta->new_file.path) + 1;
+		memcpy(path, delta->new_file.path, pathLength);
+		stats->path = path;
+		path += pathLength;
+
+		stats->binary = (delta->flags & GIT_DIFF_FLAG_BINARY) != 0;
+
+		if (patch != NULL) {
+			size_t insertions = 0;
+			size_t deletions = 0;
+			git_patch_line_stats(NULL, &insertions, &deletions, patch);
+			git_patch_free(patch);
+
+			stats->insertions = insertions;
+			stats->deletions = deletions;
+			_insertions += insertions;
+			_deletions += deletions;
+		}
+	}
+
+	_filesChanged = count;
+
+	return self;
+}
+
+- (void)dealloc {
+	free(_fileStats);
+	free(_paths);
+}
+
+#pragma mark Properties
+
+- (const GTDiffFileStats *)fileStats {
+	return _fileStats;
+}
+
+#pragma mark Formatting
+
+- (NSString *)formattedStatsWithFormat:(GTDiffStatsFormat)format width:(NSUInteger)width error:(NSError **)error {
+	if (self.diff == nil) {
+		if (error != NULL) *error = [NSError git_errorFor:GIT_ERROR description:@"The diff stats were counted without keeping their diff"];
+		return nil;
+	}
+
+	git_diff_stats *stats = NULL;
+	int gitError = git_diff_get_stats(&stats, self.diff.git_diff);
+	if (gitError != GIT_OK) {
+		if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to compute the diff stats"];
+		return nil;
+	}
+
+	git_buf buf = GIT_BUF_INIT_CONST(0, NULL);
+	gitError = git_diff_stats_to_buf(&buf, stats, (git_diff_stats_format_t)format, width);
+	git_diff_stats_free(stats);
+
+	if (gitError != GIT_OK) {
+		git_buf_dispose(&buf);
+		if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to print the diff stats"];
+		return nil;
+	}
+
+	NSString *formattedStats = [[NSString alloc] initWithBytes:buf.ptr length:buf.size encoding:NSUTF8StringEncoding];
+	git_buf_dispose(&buf);
+
+	return formattedStats;
+}
+
+#pragma mark Commit Pairs
+
++ (NSArray *)statsForCommitPairs:(NSArray<NSArray *> *)pairs inRepository:(GTRepository *)repository options:(NSDictionary *)options concurrency:(NSUInteger)concurrency error:(NSError **)error {
+	NSParameterAssert(pairs != nil);
+	NSParameterAssert(repository != nil);
+
+	NSUInteger count = pairs.count;
+	if (count == 0) return @[];
+
+	// Commits can't be used on other threads, so only their OIDs are.
+	NSMutableArray *OIDPairs = [NSMutableArray arrayWithCapacity:count];
+	for (NSArray *pair in pairs) {
+		NSParameterAssert(pair.count == 2);
+
+		id oldOID = (pair[0] == NSNull.null ? NSNull.null : [(GTCommit *)pair[0] OID]);
+		[OIDPairs addObject:@[ oldOID, [(GTCommit *)pair[1] OID] ]];
+	}
+
+	NSURL *gitDirectoryURL = repository.gitDirectoryURL;
+	NSURL *workingDirectoryURL = repository.fileURL;
+	if (concurrency == 0) concurrency = NSProcessInfo.processInfo.activeProcessorCount;
+	if (gitDirectoryURL == nil) concurrency = 1;
+	concurrency = MIN(MAX(concurrency, (NSUInteger)1), count);
+
+	// Everything below is guarded by `results`.
+	NSMutableArray *results = [NSMutableArray arrayWithCapacity:count];
+	for (NSUInteger idx = 0; idx < count; idx++) {
+		[results addObject:NSNull.null];
+	}
+	__block NSUInteger nextIndex = 0;
+	__block NSError *firstError = nil;
+
+	NSOperationQueue *workers = [[NSOperationQueue alloc] init];
+	workers.name = @"org.libgit2.ObjectiveGit.diffStats";
+	workers.maxConcurrentOperationCount = (NSInteger)concurrency;
+
+	for (NSUInteger worker = 0; worker < concurrency; worker++) {
+		[workers addOperationWithBlock:^{
+			NSError *openError = nil;
+			GTRepository *workerRepository = (gitDirectoryURL != nil ? [[GTRepository alloc] initWithGitDirectoryURL:gitDirectoryURL workingDirectoryURL:workingDirectoryURL error:&openError] : repository);
+			if (workerRepository == nil) {
+				@synchronized (results) {
+					if (firstError == nil) firstError = openError;
+				}
+				return;
+			}
+
+			BOOL done = NO;
+			while (!done) {
+				NSUInteger index = 0;
+				@synchronized (results) {
+					done = (firstError != nil || nextIndex >= count);
+					index = nextIndex++;
+				}
+				if (done) break;
+
+				@autoreleasepool {
+					NSError *pairError = nil;
+					GTDiffStats *stats = [self statsForOIDPair:OIDPairs[index] inRepository:workerRepository options:options error:&pairError];
+
+					@synchronized (results) {
+						if (stats != nil) {
+							results[index] = stats;
+						} else if (firstError == nil) {
+							firstError = pairError ?: [NSError git_errorFor:GIT_ERROR description:@"Failed to count the diff stats"];
+						}
+					}
+				}
+			}
+		}];
+	}
+
+	[workers waitUntilAllOperationsAreFinished];
+
+	if (firstError != nil) {
+		if (error != NULL) *error = firstError;
+		return nil;
+	}
+
+	return [results copy];
+}
+
++ (instancetype)statsForOIDPair:(NSArray *)OIDPair inRepository:(GTRepository *)repository options:(NSDictionary *)options error:(NSError **)error {
+	GTTree *oldTree = nil;
+	if (OIDPair[0] != NSNull.null) {
+		GTCommit *oldCommit = [repository lookUpObjectByOID:OIDPair[0] objectType:GTObjectTypeCommit error:error];
+		if (oldCommit == nil) return nil;
+
+		oldTree = oldCommit.tree;
+	}
+
+	GTCommit *newCommit = [repository lookUpObjectByOID:OIDPair[1] objectType:GTObjectTypeCommit error:error];
+	if (newCommit == nil) return nil;
+
+	GTDiff *diff = [GTDiff diffOldTree:oldTree withNewTree:newCommit.tree inRepository:repository options:options error:error];
+	if (diff == nil) return nil;
+
+	// Keeping every diff, and the worker's repository with it, would hold
+	// on to far more than the counts.
+	GTDiffStats *stats = [[self alloc] initWithDiff:diff error:error];
+	stats.diff = nil;
+
+	return stats;
+}
+
+@end
@@ -0,0 +1,99 @@
+//
+//  GTDiffWriter.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@class GTDiff;
+@class GTDiffPatch;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The textual formats a GTDiffWriter can write a diff in.
+///
+/// GTDiffWriterFormatPatch       - A unified diff, like `git diff`.
+/// GTDiffWriterFormatPatchHeader - Only the file headers of a unified diff.
+/// GTDiffWriterFormatRaw         - Like `git diff --raw`.
+/// GTDiffWriterFormatNameOnly    - Like `git diff --name-only`.
+/// GTDiffWriterFormatNameStatus  - Like `git diff --name-status`.
+/// GTDiffWriterFormatStat        - Like `git diff --stat`.
+typedef NS_ENUM(NSInteger, GTDiffWriterFormat) {
+	GTDiffWriterFormatPatch,
+	GTDiffWriterFormatPatchHeader,
+	GTDiffWriterFormatRaw,
+	GTDiffWriterFormatNameOnly,
+	GTDiffWriterFormatNameStatus,
+	GTDiffWriterFormatStat,
+};
+
+/// The size of the buffer writers use by default.
+extern const NSUInteger GTDiffWriterDefaultBufferSize;
+
+/// Writes diffs as text, a line at a time, through a fixed size buffer.
+///
+/// Patches are generated as they're written and freed straight after, so
+/// writing a diff takes the same memory no matter how large it is. The
+/// destination sees the output in chunks of at most `bufferSize` bytes.
+///
+/// Writers aren't thread safe.
+@interface GTDiffWriter : NSObject
+
+/// The size of the buffer, and the most bytes passed to the destination at
+/// once.
+@property (nonatomic, readonly, assign) NSUInteger bufferSize;
+
+/// The total number of bytes passed to the destination.
+@property (nonatomic, readonly, assign) unsigned long long bytesWritten;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Initializes the receiver to write to a file descriptor, with the default
+/// buffer size.
+///
+/// fileDescriptor - The file descriptor to write to. It's neither closed nor
+///                  repositioned by the receiver.
+- (instancetype)initWithFileDescriptor:(int)fileDescriptor;
+
+/// Initializes the receiver to write to a stream, with the default buffer
+/// size.
+///
+/// outputStream - The stream to write to, which must be open. Writes block
+///                until the stream has accepted every byte. Cannot be nil.
+- (instancetype)initWithOutputStream:(NSOutputStream *)outputStream;
+
+/// Initializes the receiver to pass its output to a block. Designated
+/// initializer.
+///
+/// bufferSize   - The size of the buffer. Must be greater than 0.
+/// chunkHandler - Called with every full buffer, and with the rest of the
+///                output once a diff has been written. The bytes are only
+///                valid during the call. Return NO and set `error` to stop
+///                writing. Cannot be nil.
+- (instancetype)initWithBufferSize:(NSUInteger)bufferSize chunkHandler:(BOOL (^)(const void *bytes, NSUInteger length, NSError **error))chunkHandler NS_DESIGNATED_INITIALIZER;
+
+/// Writes a whole diff.
+///
+/// Stat output is built in memory, since its columns depend on every file,
+/// but it's only a line per file.
+///
+/// diff   - The diff to write. Cannot be nil.
+/// format - The format to write the diff in.
+/// error  - The error if one occurred.
+///
+/// Returns whether the whole diff was written.
+- (BOOL)writeDiff:(GTDiff *)diff format:(GTDiffWriterFormat)format error:(NSError **)error;
+
+/// Writes a single patch as a unified diff.
+///
+/// patch - The patch to write. Cannot be nil.
+/// error - The error if one occurred.
+///
+/// Returns whether the whole patch was written.
+- (BOOL)writePatch:(GTDiffPatch *)patch error:(NSError **)error;
+
+@end
+
+NS_ASSUME_NONNULL_END
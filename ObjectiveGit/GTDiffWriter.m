@@ -0,0 +1,223 @@
+//
+//  GTDiffWriter.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTDiffWriter.h"
+#import "GTDiff.h"
+#import "GTDiffPatch.h"
+#import "NSError+Git.h"
+
+#import "git2/buffer.h"
+#import "git2/diff.h"
+#import "git2/errors.h"
+#import "git2/patch.h"
+
+#import <errno.h>
+#import <unistd.h>
+
+const NSUInteger GTDiffWriterDefaultBufferSize = 64 * 1024;
+
+// The width stat output is laid out for, like git outside a terminal.
+static const size_t GTDiffWriterStatWidth = 80;
+
+@interface GTDiffWriter () {
+	char *_buffer;
+	NSUInteger _bufferLength;
+}
+
+@property (nonatomic, readonly, copy) BOOL (^chunkHandler)(const void *bytes, NSUInteger length, NSError **error);
+
+@property (nonatomic, readwrite, assign) unsigned long long bytesWritten;
+
+// The error which stopped the current write, if the destination failed.
+@property (nonatomic, strong) NSError *destinationError;
+
+@end
+
+@implementation GTDiffWriter
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	NSAssert(NO, @"Call to an unavailable initializer.");
+	return nil;
+}
+
+- (instancetype)initWithFileDescriptor:(int)fileDescriptor {
+	return [self initWithBufferSize:GTDiffWriterDefaultBufferSize chunkHandler:^(const void *bytes, NSUInteger length, NSError **error) {
+		while (length > 0) {
+			ssize_t written = write(fileDescriptor, bytes, length);
+			if (written < 0) {
+				if (errno == EINTR) continue;
+
+				if (error != NULL) *error = [NSError errorWithDomain:NSPOSIXErrorDomain code:errno userInfo:nil];
+				return NO;
+			}
+
+			bytes = (const char *)bytes + written;
+			length -= (NSUInteger)written;
+		}
+
+		return YES;
+	}];
+}
+
+- (instancetype)initWithOutputStream:(NSOutputStream *)outputStream {
+	NSParameterAssert(outputStream != nil);
+
+	return [self initWithBufferSize:GTDiffWriterDefaultBufferSize chunkHandler:^(const void *bytes, NSUInteger length, NSError **error) {
+		while (length > 0) {
+			NSInteger written = [outputStream write:bytes maxLength:length];
+			if (written <= 0) {
+				if (error != NULL) *error = outputStream.streamError ?: [NSError git_errorFor:GIT_ERROR description:@"The output stream is full"];
+				return NO;
+			}
+
+			bytes = (const uint8_t *)bytes + written;
+			length -= (NSUInteger)written;
+		}
+
+		return YES;
+	}];
+}
+
+- (instancetype)initWithBufferSize:(NSUInteger)bufferSize chunkHandler:(BOOL (^)(const void *, NSUInteger, NSError **))chunkHandler {
+	NSParameterAssert(bufferSize > 0);
+	NSParameterAssert(chunkHandler != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_bufferSize = bufferSize;
+	_chunkHandler = [chunkHandler copy];
+	_buffer = malloc(bufferSize);
+	if (_buffer == NULL) return nil;
+
+	return self;
+}
+
+- (void)dealloc {
+	free(_buffer);
+}
+
+#pragma mark Buffering
+
+// Passes the buffered bytes to the destination.
+- (BOOL)flush {
+	if (_bufferLength == 0) return YES;
+
+	NSError *error = nil;
+	NSUInteger length = _bufferLength;
+	_bufferLength = 0;
+	if (!self.chunkHandler(_buffer, length, &error)) {
+		self.destinationError = error ?: [NSError git_errorFor:GIT_ERROR description:@"Failed to write the diff"];
+		return NO;
+	}
+
+	self.bytesWritten += length;
+	return YES;
+}
+
+- (BOOL)appendBytes:(const char *)bytes length:(size_t)length {
+	while (length > 0) {
+		if (_bufferLength == _bufferSize && ![self flush]) return NO;
+
+		size_t count = MIN(length, (size_t)(_bufferSize - _bufferLength));
+		memcpy(_buffer + _bufferLength, bytes, count);
+		_bufferLength += count;
+		bytes += count;
+		length -= count;
+	}
+
+	return YES;
+}
+
+// Appends a line the way git_diff_to_buf and git_patch_to_buf do: content
+// lines get their origin prepended, everything else is written as is.
+static int GTDiffWriterLineCallback(const git_diff_delta *delta, const git_diff_hunk *hunk, const git_diff_line *line, void *payload) {
+	GTDiffWriter *writer = (__bridge GTDiffWriter *)payload;
+
+	if (line->origin == GIT_DIFF_LINE_CONTEXT || line->origin == GIT_DIFF_LINE_ADDITION || line->origin == GIT_DIFF_LINE_DELETION) {
+		if (![writer appendBytes:&line->origin length:1]) return GIT_EUSER;
+	}
+
+	return ([writer appendBytes:line->content length:line->content_len] ? GIT_OK : GIT_EUSER);
+}
+
+// Finishes a write, flushing whatever is left if `gitError` is fine.
+- (BOOL)finishWritingWithGitError:(int)gitError description:(NSString *)description error:(NSError **)error {
+	if (gitError == GIT_OK && [self flush]) return YES;
+
+	// Whatever didn't make it to the destination is dropped, so the next
+	// write starts clean.
+	_bufferLength = 0;
+
+	if (error != NULL) *error = self.destinationError ?: [NSError git_errorFor:gitError description:@"%@", description];
+	self.destinationError = nil;
+	return NO;
+}
+
+#pragma mark Writing
+
+- (BOOL)writeDiff:(GTDiff *)diff format:(GTDiffWriterFormat)format error:(NSError **)error {
+	NSParameterAssert(diff != nil);
+
+	if (format == GTDiffWriterFormatStat) return [self writeStatOfDiff:diff error:error];
+
+	git_diff_format_t gitFormat = GIT_DIFF_FORMAT_PATCH;
+	switch (format) {
+		case GTDiffWriterFormatPatch:
+			gitFormat = GIT_DIFF_FORMAT_PATCH;
+			break;
+
+		case GTDiffWriterFormatPatchHeader:
+			gitFormat = GIT_DIFF_FORMAT_PATCH_HEADER;
+			break;
+
+		case GTDiffWriterFormatRaw:
+			gitFormat = GIT_DIFF_FORMAT_RAW;
+			break;
+
+		case GTDiffWriterFormatNameOnly:
+			gitFormat = GIT_DIFF_FORMAT_NAME_ONLY;
+			break;
+
+		case GTDiffWriterFormatNameStatus:
+			gitFormat = GIT_DIFF_FORMAT_NAME_STATUS;
+			break;
+
+		default:
+			NSAssert(NO, @"Unknown diff writer format %ld", (long)format);
+			break;
+	}
+
+	int gitError = git_diff_print(diff.git_diff, gitFormat, GTDiffWriterLineCallback, (__bridge void *)self);
+	return [self finishWritingWithGitError:gitError description:@"Failed to write the diff" error:error];
+}
+
+- (BOOL)writeStatOfDiff:(GTDiff *)diff error:(NSError **)error {
+	git_diff_stats *stats = NULL;
+	int gitError = git_diff_get_stats(&stats, diff.git_diff);
+	if (gitError != GIT_OK) return [self finishWritingWithGitError:gitError description:@"Failed to compute the diff stats" error:error];
+
+	git_buf buf = GIT_BUF_INIT_CONST(0, NULL);
+	gitError = git_diff_stats_to_buf(&buf, stats, GIT_DIFF_STATS_FULL | GIT_DIFF_STATS_INCLUDE_SUMMARY, GTDiffWriterStatWidth);
+	git_diff_stats_free(stats);
+
+	if (gitError == GIT_OK && ![self appendBytes:buf.ptr length:buf.size]) gitError = GIT_EUSER;
+	git_buf_dispose(&buf);
+
+	return [self finishWritingWithGitError:gitError description:@"Failed to write the diff stats" error:error];
+}
+
+- (BOOL)writePatch:(GTDiffPatch *)patch error:(NSError **)error {
+	NSParameterAssert(patch != nil);
+
+	int gitError = git_patch_print(patch.git_patch, GTDiffWriterLineCallback, (__bridge void *)self);
+	return [self finishWritingWithGitError:gitError description:@"Failed to write the patch" error:error];
+}
+
+@end
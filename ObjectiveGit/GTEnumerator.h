@@ -46,12 +46,33 @@ typedef NS_OPTIONS(unsigned int, GTEnumeratorOptions) {
 	GTEnumeratorOptionsReverse = GIT_SORT_REVERSE,
 };
 
+/// Options for path-limited enumeration.
+///
+/// GTEnumeratorPathOptionsNone            - Return every commit which changed
+///                                          the paths relative to at least one
+///                                          of its parents, like
+///                                          `git log --full-history -- <paths>`.
+/// GTEnumeratorPathOptionsSimplifyHistory - When a merge left the paths
+///                                          unchanged from one of its parents,
+///                                          skip the merge and only follow that
+///                                          parent, like `git log -- <paths>`.
+typedef NS_OPTIONS(NSUInteger, GTEnumeratorPathOptions) {
+	GTEnumeratorPathOptionsNone = 0,
+	GTEnumeratorPathOptionsSimplifyHistory = 1 << 0,
+};
+
 @class GTRepository;
 @class GTCommit;
+@class GTCommitFilter;
+@class GTOIDSet;
 
 NS_ASSUME_NONNULL_BEGIN
 
 /// Enumerates the commits in a repository.
+///
+/// Topologically sorted walks are served from the repository's `commitGraph`
+/// when every pushed and hidden commit is in it, without reading any commits.
+/// Such walks may order unrelated commits differently than libgit2 would.
 @interface GTEnumerator : NSEnumerator
 
 /// The repository being enumerated.
@@ -62,9 +83,43 @@ NS_ASSUME_NONNULL_BEGIN
 /// To set new options, use -resetWithOptions:.
 @property (nonatomic, assign, readonly) GTEnumeratorOptions options;
 
+/// The paths enumeration is limited to, or nil if it isn't.
+///
+/// To set new paths, use -limitToPaths:options:.
+@property (nonatomic, copy, readonly) NSArray<NSString *> * _Nullable limitingPaths;
+
+/// The options used for path-limited enumeration.
+@property (nonatomic, assign, readonly) GTEnumeratorPathOptions pathOptions;
+
+/// The number of threads used to check whether commits changed the
+/// `limitingPaths`. Commits are still returned in walk order.
+///
+/// Every thread besides the first opens its own handle on the repository. If
+/// that isn't possible, as for repositories without a git directory on disk,
+/// paths are checked on one thread.
+///
+/// Defaults to 1.
+@property (nonatomic, assign) NSUInteger pathCheckConcurrency;
+
+/// Whether GTCommits are returned without being parsed, as by
+/// -[GTRepository lookUpLazyCommitByOID:error:]. This suits listings which only
+/// show a few properties of each commit.
+///
+/// Defaults to NO.
+@property (nonatomic, assign) BOOL returnsLazyCommits;
+
+/// Only commits matching this filter are returned, or every commit if nil.
+///
+/// The filter is evaluated on each commit's raw object, so commits which don't
+/// match are never parsed. It's applied after any `limitingPaths`.
+@property (nonatomic, copy) GTCommitFilter * _Nullable commitFilter;
+
 - (instancetype)init NS_UNAVAILABLE;
 
 /// The underlying `git_revwalk` from libgit2.
+///
+/// Once this has been called, the receiver no longer uses the commit graph,
+/// since commits may be pushed onto the revwalk directly.
 - (git_revwalk *)git_revwalk __attribute__((objc_returns_inner_pointer));
 
 /// Initializes the receiver to enumerate the commits in the given repository. Designated initializer.
@@ -144,6 +199,25 @@ NS_ASSUME_NONNULL_BEGIN
 /// replacing the receiver's `options`.
 - (void)resetWithOptions:(GTEnumeratorOptions)options;
 
+/// Limits enumeration to the commits which changed any of the given paths,
+/// like `git log -- <paths>`.
+///
+/// A commit is checked by comparing the OIDs of the trees along each path with
+/// those in its parents, so only the trees on the path are read, and nothing
+/// is diffed.
+///
+/// Simplifying history needs children to be walked before their parents, so
+/// the commits are walked with GTEnumeratorOptionsTopologicalSort added to
+/// `options`. A reversed walk is then only returned once it's complete.
+///
+/// The limit applies until it's replaced, including across
+/// -resetWithOptions:. Call this before enumeration starts.
+///
+/// paths   - The paths to limit enumeration to, relative to the root of the
+///           repository, or nil to stop limiting enumeration. Cannot be empty.
+/// options - How to treat merges. Ignored if `paths` is nil.
+- (void)limitToPaths:(NSArray<NSString *> * _Nullable)paths options:(GTEnumeratorPathOptions)options;
+
 /// Enumerates all marked commits, completely exhausting the receiver.
 ///
 /// error - If not NULL, set to any error that occurs during traversal.
@@ -171,6 +245,28 @@ NS_ASSUME_NONNULL_BEGIN
 /// Returns nil if an error occurs or the receiver is exhausted.
 - (GTCommit * _Nullable)nextObjectWithSuccess:(BOOL * _Nullable)success error:(NSError **)error;
 
+/// Gets the OIDs of the next commits without creating any objects.
+///
+/// buffer   - The buffer to write the OIDs to. It must have room for at least
+///            `maxCount` OIDs. Cannot be NULL.
+/// maxCount - The most OIDs to write.
+/// error    - If not NULL, set to any error that occurs during traversal.
+///
+/// Returns the number of OIDs written to `buffer`, which is less than
+/// `maxCount` only once the receiver is exhausted, or `NSNotFound` if an error
+/// occurs. OIDs written before an error are lost.
+- (NSUInteger)nextOIDs:(git_oid *)buffer maxCount:(NSUInteger)maxCount error:(NSError **)error;
+
+/// Gets the OIDs of the next commits as packed `git_oid` structs.
+///
+/// maxCount - The most OIDs to return. Use `NSUIntegerMax` to exhaust the
+///            receiver.
+/// error    - If not NULL, set to any error that occurs during traversal.
+///
+/// Returns data holding `length / sizeof(git_oid)` OIDs, which is empty once
+/// the receiver is exhausted, or nil if an error occurs.
+- (NSData * _Nullable)nextOIDDataWithMaxCount:(NSUInteger)maxCount error:(NSError **)error;
+
 /// Counts the number of commits that were not enumerated, completely exhausting
 /// the receiver.
 ///
@@ -179,6 +275,15 @@ NS_ASSUME_NONNULL_BEGIN
 /// Returns the number of commits remaining, or `NSNotFound` if an error occurs.
 - (NSUInteger)countRemainingObjects:(NSError **)error;
 
+/// Adds the OIDs of the commits that were not enumerated to a set, completely
+/// exhausting the receiver. No objects are created during the walk.
+///
+/// set   - The set to add the commit OIDs to. Cannot be nil.
+/// error - If not NULL, set to any error that occurs during traversal.
+///
+/// Returns whether the traversal was successful.
+- (BOOL)addRemainingOIDsToSet:(GTOIDSet *)set error:(NSError **)error;
+
 @end
 
 NS_ASSUME_NONNULL_END
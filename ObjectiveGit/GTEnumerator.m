@@ -29,18 +29,95 @@
 
 #import "GTEnumerator.h"
 #import "GTCommit.h"
+#import "GTCommitFilter.h"
+#import "GTCommitGraph+Private.h"
 #import "NSError+Git.h"
 #import "NSString+Git.h"
 #import "GTRepository.h"
 #import "GTRepository+Private.h"
 #import "GTOID.h"
+#import "GTOIDSet.h"
 
+#import "git2/commit.h"
 #import "git2/errors.h"
+#import "git2/object.h"
+#import "git2/odb.h"
+#import "git2/refs.h"
+#import "git2/repository.h"
+#import "git2/tree.h"
 
-@interface GTEnumerator ()
+// The number of commits checked at once per thread in path-limited walks.
+static const NSUInteger GTEnumeratorPathCheckBatchSize = 64;
+
+// Whether a commit changed the limiting paths, relative to each of its parents.
+typedef struct {
+	git_oid oid;
+	int error;
+	unsigned int parentCount;
+
+	// The number of parents the paths are unchanged from. A root commit counts
+	// as unchanged from the empty tree if none of the paths exist.
+	unsigned int unchangedCount;
+
+	// The first parent the paths are unchanged from, if any.
+	git_oid unchangedParentOID;
+} GTEnumeratorPathCheck;
+
+@interface GTEnumerator () {
+	// The object database `commitFilter` reads commits from, while walking.
+	git_odb *_filterODB;
+}
 
 @property (nonatomic, assign, readonly) git_revwalk *walk;
 @property (nonatomic, assign, readwrite) GTEnumeratorOptions options;
+@property (nonatomic, copy, readwrite) NSArray<NSString *> *limitingPaths;
+@property (nonatomic, assign, readwrite) GTEnumeratorPathOptions pathOptions;
+
+// The components of each of `limitingPaths`, as NUL-terminated strings
+// followed by an empty string.
+@property (nonatomic, copy) NSArray<NSData *> *pathComponents;
+
+// The sorting of the revwalk or commit graph for the current walk. This adds
+// topological sorting to `options` when simplifying path-limited history.
+@property (nonatomic, assign) GTEnumeratorOptions sourceOptions;
+
+// The commits pushed and hidden since the walk was last reset, as packed
+// git_oids, so that the walk can be replayed on the repository's commit graph.
+@property (nonatomic, strong, readonly) NSMutableData *pushedOIDs;
+@property (nonatomic, strong, readonly) NSMutableData *hiddenOIDs;
+
+// Whether `pushedOIDs` and `hiddenOIDs` fully describe the walk. This is
+// cleared until the next reset if a reference is pushed while there's no
+// commit graph to record it for, and for good once the revwalk is handed out.
+@property (nonatomic, assign) BOOL walkIsRecorded;
+
+// Whether the caller has been given the revwalk, and may push onto it.
+@property (nonatomic, assign) BOOL walkHandedOut;
+
+// Whether enumeration has started since the walk was last reset.
+@property (nonatomic, assign) BOOL walking;
+
+// The commits to return, when the walk is being served by the commit graph.
+@property (nonatomic, strong) NSData *graphOIDs;
+@property (nonatomic, assign) NSUInteger graphOIDIndex;
+
+// The commits which changed the limiting paths and haven't been returned yet.
+@property (nonatomic, strong) NSMutableData *pathOIDs;
+@property (nonatomic, assign) NSUInteger pathOIDIndex;
+
+// Whether the revwalk or commit graph has run out of commits to check.
+@property (nonatomic, assign) BOOL sourceExhausted;
+
+// The repository handle each path checking thread uses, opened the first time
+// they're needed. The first is `repository`, which is otherwise unused while
+// the threads run.
+@property (nonatomic, copy) NSArray<GTRepository *> *pathCheckRepositories;
+
+// When simplifying history, the commits reached through a followed parent, and
+// those with any child walked so far. A commit in the latter but not the
+// former was only reachable through merges which weren't followed.
+@property (nonatomic, strong) GTOIDSet *followedOIDs;
+@property (nonatomic, strong) GTOIDSet *childOIDs;
 
 @end
 
@@ -54,6 +131,9 @@
 }
 
 - (git_revwalk *)git_revwalk {
+	// The caller may push directly onto the revwalk, which we can't replay.
+	self.walkHandedOut = YES;
+	self.walkIsRecorded = NO;
 	return self.walk;
 }
 
@@ -65,6 +145,11 @@
 
 	_repository = repo;
 	_options = GTEnumeratorOptionsNone;
+	_pathCheckConcurrency = 1;
+	_pathOIDs = [NSMutableData data];
+	_pushedOIDs = [NSMutableData data];
+	_hiddenOIDs = [NSMutableData data];
+	_walkIsRecorded = YES;
 
 	int gitError = git_revwalk_new(&_walk, self.repository.git_repository);
 	if (gitError != GIT_OK) {
@@ -80,6 +165,8 @@
 		git_revwalk_free(_walk);
 		_walk = NULL;
 	}
+
+	git_odb_free(_filterODB);
 }
 
 #pragma mark Pushing and Hiding
@@ -95,39 +182,42 @@
 		if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to push SHA %@ onto rev walker.", sha];
 		return NO;
 	}
-	
+
+	[self.pushedOIDs appendBytes:oid.git_oid length:sizeof(git_oid)];
 	return YES;
 }
 
 - (BOOL)pushGlob:(NSString *)refGlob error:(NSError **)error {
 	NSParameterAssert(refGlob != nil);
 
-	int gitError = git_revwalk_push_glob(self.walk, refGlob.UTF8String);
+	int gitError = [self addGlob:refGlob hidden:NO];
 	if (gitError != GIT_OK) {
 		if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to push glob %@ onto rev walker.", refGlob];
 		return NO;
 	}
-	
+
 	return YES;
 }
 
 - (BOOL)pushHEAD:(NSError **)error {
-	int gitError = git_revwalk_push_head(self.walk);
+	int gitError = [self addReferenceName:@"HEAD" hidden:NO];
 	if (gitError != GIT_OK) {
 		if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to push HEAD onto rev walker."];
 		return NO;
 	}
+
 	return YES;
 }
 
 - (BOOL)pushReferenceName:(NSString *)refName error:(NSError **)error {
 	NSParameterAssert(refName != nil);
 
-	int gitError = git_revwalk_push_ref(self.walk, refName.UTF8String);
+	int gitError = [self addReferenceName:refName hidden:NO];
 	if (gitError != 0) {
 		if (error) *error = [NSError git_errorFor:gitError description:@"Failed to push reference %@", refName];
 		return NO;
 	}
+
 	return YES;
 }
 
@@ -143,56 +233,561 @@
 		return NO;
 	}
 
+	[self.hiddenOIDs appendBytes:oid.git_oid length:sizeof(git_oid)];
 	return YES;
 }
 
 - (BOOL)hideGlob:(NSString *)refGlob error:(NSError **)error {
 	NSParameterAssert(refGlob != nil);
 
-	int gitError = git_revwalk_hide_glob(self.walk, refGlob.UTF8String);
+	int gitError = [self addGlob:refGlob hidden:YES];
 	if (gitError != GIT_OK) {
 		if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to hide glob %@ in rev walker.", refGlob];
 		return NO;
 	}
-	
+
 	return YES;
 }
 
 - (BOOL)hideHEAD:(NSError **)error {
-	int gitError = git_revwalk_hide_head(self.walk);
+	int gitError = [self addReferenceName:@"HEAD" hidden:YES];
 	if (gitError != GIT_OK) {
 		if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to hide HEAD onto rev walker."];
 		return NO;
 	}
+
 	return YES;
 }
 
 - (BOOL)hideReferenceName:(NSString *)refName error:(NSError **)error {
 	NSParameterAssert(refName != nil);
 
-	int gitError = git_revwalk_hide_ref(self.walk, refName.UTF8String);
+	int gitError = [self addReferenceName:refName hidden:YES];
 	if (gitError != 0) {
 		if (error) *error = [NSError git_errorFor:gitError description:@"Failed to hide reference %@", refName];
 		return NO;
 	}
+
 	return YES;
 }
 
+#pragma mark Recording
+
+// Whether pushes should be recorded, because the walk may be served by the
+// repository's commit graph.
+- (BOOL)recordsWalk {
+	return self.walkIsRecorded && self.repository.commitGraph != nil;
+}
+
+// Resolves a reference to the commit it peels to, the way the revwalk does.
+static int GTEnumeratorPeelReference(git_oid *oid, git_repository *repo, const char *name) {
+	git_oid target;
+	int gitError = git_reference_name_to_id(&target, repo, name);
+	if (gitError != GIT_OK) return gitError;
+
+	git_object *object = NULL;
+	git_object *commit = NULL;
+	gitError = git_object_lookup(&object, repo, &target, GIT_OBJECT_ANY);
+	if (gitError == GIT_OK) gitError = git_object_peel(&commit, object, GIT_OBJECT_COMMIT);
+	if (gitError == GIT_OK) git_oid_cpy(oid, git_object_id(commit));
+
+	git_object_free(commit);
+	git_object_free(object);
+	return gitError;
+}
+
+// Pushes or hides the commit `oid`, and records it.
+- (int)addGitOid:(const git_oid *)oid hidden:(BOOL)hidden {
+	int gitError = (hidden ? git_revwalk_hide(self.walk, oid) : git_revwalk_push(self.walk, oid));
+	if (gitError == GIT_OK) [(hidden ? self.hiddenOIDs : self.pushedOIDs) appendBytes:oid length:sizeof(git_oid)];
+
+	return gitError;
+}
+
+// Pushes or hides a reference.
+//
+// While the walk is recorded, the reference is resolved once and that commit
+// is both given to the revwalk and recorded, so the two can't disagree.
+// Otherwise the revwalk resolves it, and the walk is no longer recorded.
+- (int)addReferenceName:(NSString *)refName hidden:(BOOL)hidden {
+	if (!self.recordsWalk) {
+		self.walkIsRecorded = NO;
+		return (hidden ? git_revwalk_hide_ref(self.walk, refName.UTF8String) : git_revwalk_push_ref(self.walk, refName.UTF8String));
+	}
+
+	git_oid oid;
+	int gitError = GTEnumeratorPeelReference(&oid, self.repository.git_repository, refName.UTF8String);
+	if (gitError != GIT_OK) return gitError;
+
+	return [self addGitOid:&oid hidden:hidden];
+}
+
+static int GTEnumeratorRecordGlobMatch(const char *name, void *payload) {
+	[(__bridge NSMutableArray *)payload addObject:@(name)];
+	return 0;
+}
+
+// Pushes or hides the references matched by a glob, like
+// -addReferenceName:hidden:.
+//
+// The glob is normalized the same way as git_revwalk_push_glob, and references
+// which don't peel to commits are skipped like the revwalk skips them.
+- (int)addGlob:(NSString *)refGlob hidden:(BOOL)hidden {
+	if (!self.recordsWalk) {
+		self.walkIsRecorded = NO;
+		return (hidden ? git_revwalk_hide_glob(self.walk, refGlob.UTF8String) : git_revwalk_push_glob(self.walk, refGlob.UTF8String));
+	}
+
+	NSString *glob = ([refGlob hasPrefix:@"refs/"] ? refGlob : [@"refs/" stringByAppendingString:refGlob]);
+	if ([refGlob rangeOfCharacterFromSet:[NSCharacterSet characterSetWithCharactersInString:@"?*["]].location == NSNotFound) {
+		glob = [glob stringByAppendingString:@"/*"];
+	}
+
+	NSMutableArray *names = [NSMutableArray array];
+	int gitError = git_reference_foreach_glob(self.repository.git_repository, glob.UTF8String, GTEnumeratorRecordGlobMatch, (__bridge void *)names);
+	if (gitError != GIT_OK) return gitError;
+
+	for (NSString *name in names) {
+		git_oid oid;
+		if (GTEnumeratorPeelReference(&oid, self.repository.git_repository, name.UTF8String) != GIT_OK) continue;
+
+		gitError = [self addGitOid:&oid hidden:hidden];
+		if (gitError != GIT_OK) return gitError;
+	}
+
+	return GIT_OK;
+}
+
 #pragma mark Resetting
 
+// Forgets everything pushed and hidden, like git_revwalk_reset.
+- (void)resetRecordedWalk {
+	self.pushedOIDs.length = 0;
+	self.hiddenOIDs.length = 0;
+	self.graphOIDs = nil;
+	self.graphOIDIndex = 0;
+	self.pathOIDs.length = 0;
+	self.pathOIDIndex = 0;
+	self.sourceExhausted = NO;
+	self.followedOIDs = nil;
+	self.childOIDs = nil;
+	self.walking = NO;
+	self.walkIsRecorded = !self.walkHandedOut;
+
+	git_odb_free(_filterODB);
+	_filterODB = NULL;
+
+	if (self.sourceOptions != self.options) {
+		git_revwalk_sorting(self.walk, self.options);
+		self.sourceOptions = self.options;
+	}
+}
+
 - (void)resetWithOptions:(GTEnumeratorOptions)options {
 	self.options = options;
 
+	// A walk served by the commit graph never started the revwalk, which would
+	// otherwise keep its pushed commits, so reset it explicitly.
+	if (self.walking) {
+		git_revwalk_reset(self.walk);
+		[self resetRecordedWalk];
+	}
+
 	// This will also reset the walker.
 	git_revwalk_sorting(self.walk, self.options);
+	self.sourceOptions = self.options;
+}
+
+- (void)limitToPaths:(NSArray *)paths options:(GTEnumeratorPathOptions)options {
+	NSParameterAssert(paths == nil || paths.count > 0);
+	NSAssert(!self.walking, @"Paths must be limited before enumeration starts.");
+
+	if (paths == nil) {
+		self.limitingPaths = nil;
+		self.pathComponents = nil;
+		self.pathOptions = GTEnumeratorPathOptionsNone;
+		return;
+	}
+
+	NSMutableArray *pathComponents = [NSMutableArray arrayWithCapacity:paths.count];
+	for (NSString *path in paths) {
+		NSMutableData *components = [NSMutableData data];
+		for (NSString *component in [path componentsSeparatedByString:@"/"]) {
+			if (component.length == 0 || [component isEqualToString:@"."]) continue;
+
+			const char *name = component.UTF8String;
+			[components appendBytes:name length:strlen(name) + 1];
+		}
+
+		[components appendBytes:"" length:1];
+		[pathComponents addObject:components];
+	}
+
+	self.limitingPaths = paths;
+	self.pathComponents = pathComponents;
+	self.pathOptions = options;
 }
 
 #pragma mark Enumerating
 
+// Returns the topologically sorted walk from the repository's commit graph, or
+// nil if the walk isn't topologically sorted or isn't covered by the graph.
+- (NSData *)commitGraphOIDs {
+	if ((self.sourceOptions & GTEnumeratorOptionsTopologicalSort) == 0 || !self.walkIsRecorded) return nil;
+
+	GTCommitGraph *graph = self.repository.commitGraph;
+	if (graph == nil) return nil;
+
+	NSData *pushedIndexes = [self indexesOfOIDs:self.pushedOIDs inCommitGraph:graph];
+	NSData *hiddenIndexes = [self indexesOfOIDs:self.hiddenOIDs inCommitGraph:graph];
+	if (pushedIndexes == nil || hiddenIndexes == nil) return nil;
+
+	BOOL reverse = (self.sourceOptions & GTEnumeratorOptionsReverse) != 0;
+	return [graph topologicallySortedOIDsFromIndexes:pushedIndexes.bytes count:pushedIndexes.length / sizeof(uint32_t) hidingIndexes:hiddenIndexes.bytes count:hiddenIndexes.length / sizeof(uint32_t) reverse:reverse];
+}
+
+- (NSData *)indexesOfOIDs:(NSData *)OIDs inCommitGraph:(GTCommitGraph *)graph {
+	const git_oid *oids = OIDs.bytes;
+	NSUInteger count = OIDs.length / sizeof(git_oid);
+
+	NSMutableData *indexes = [NSMutableData dataWithLength:count * sizeof(uint32_t)];
+	uint32_t *output = indexes.mutableBytes;
+	for (NSUInteger i = 0; i < count; i++) {
+		output[i] = [graph indexOfGitOid:&oids[i]];
+		if (output[i] == GTCommitGraphNotFound) return nil;
+	}
+
+	return indexes;
+}
+
+- (BOOL)simplifiesPathHistory {
+	return self.pathComponents != nil && (self.pathOptions & GTEnumeratorPathOptionsSimplifyHistory) != 0;
+}
+
+- (void)startWalk {
+	self.walking = YES;
+
+	if (self.simplifiesPathHistory) {
+		// Whether a commit's parents are followed is decided when the commit is
+		// walked, so every child has to be walked before its parents.
+		GTEnumeratorOptions sourceOptions = (self.options | GTEnumeratorOptionsTopologicalSort) & ~GTEnumeratorOptionsReverse;
+		if (sourceOptions != self.sourceOptions) {
+			// The revwalk hasn't started, so this keeps what was pushed.
+			git_revwalk_sorting(self.walk, sourceOptions);
+			self.sourceOptions = sourceOptions;
+		}
+
+		self.followedOIDs = [[GTOIDSet alloc] init];
+		self.childOIDs = [[GTOIDSet alloc] init];
+	}
+
+	self.graphOIDs = [self commitGraphOIDs];
+}
+
+// Gets the next commit from the commit graph if it covers the walk, or from
+// the revwalk otherwise, ignoring any limiting paths.
+- (int)nextSourceGitOid:(git_oid *)oid {
+	if (self.graphOIDs != nil) {
+		if (self.graphOIDIndex < self.graphOIDs.length / sizeof(git_oid)) {
+			git_oid_cpy(oid, (const git_oid *)self.graphOIDs.bytes + self.graphOIDIndex++);
+			return GIT_OK;
+		}
+
+		git_revwalk_reset(self.walk);
+		return GIT_ITEROVER;
+	}
+
+	return git_revwalk_next(oid, self.walk);
+}
+
+// Gets the next commit. Everything that advances the walk goes through here.
+- (int)nextGitOid:(git_oid *)oid {
+	if (!self.walking) [self startWalk];
+
+	GTCommitFilter *filter = self.commitFilter;
+
+	int gitError;
+	BOOL matches = YES;
+	do {
+		gitError = (self.pathComponents != nil ? [self nextPathLimitedGitOid:oid] : [self nextSourceGitOid:oid]);
+		if (gitError == GIT_OK && filter != nil) gitError = [self filter:filter matchesGitOid:oid matches:&matches];
+	} while (gitError == GIT_OK && !matches);
+
+	// The revwalk resets itself once it's exhausted.
+	if (gitError == GIT_ITEROVER) [self resetRecordedWalk];
+
+	return gitError;
+}
+
+// Reads the raw commit from the object database and matches it against
+// `filter`.
+- (int)filter:(GTCommitFilter *)filter matchesGitOid:(const git_oid *)oid matches:(BOOL *)matches {
+	if (_filterODB == NULL) {
+		int gitError = git_repository_odb(&_filterODB, self.repository.git_repository);
+		if (gitError != GIT_OK) return gitError;
+	}
+
+	git_odb_object *object = NULL;
+	int gitError = git_odb_read(&object, _filterODB, oid);
+	if (gitError != GIT_OK) return gitError;
+
+	*matches = [filter matchesCommitBytes:git_odb_object_data(object) length:git_odb_object_size(object)];
+	git_odb_object_free(object);
+
+	return GIT_OK;
+}
+
+#pragma mark Path Limiting
+
+// Replaces `oid` with the OID of the entry named `name` in the tree it
+// identifies, or clears `found` if there's no such entry.
+static int GTEnumeratorDescendPath(bool *found, git_oid *oid, git_filemode_t *mode, git_repository *repo, const char *name) {
+	if (!*found) return GIT_OK;
+	if (*mode != GIT_FILEMODE_TREE) {
+		*found = false;
+		return GIT_OK;
+	}
+
+	git_tree *tree = NULL;
+	int gitError = git_tree_lookup(&tree, repo, oid);
+	if (gitError != GIT_OK) return gitError;
+
+	const git_tree_entry *entry = git_tree_entry_byname(tree, name);
+	if (entry != NULL) {
+		git_oid_cpy(oid, git_tree_entry_id(entry));
+		*mode = git_tree_entry_filemode(entry);
+	} else {
+		*found = false;
+	}
+
+	git_tree_free(tree);
+	return GIT_OK;
+}
+
+// Compares the entries at one path in two trees, stopping as soon as the trees
+// along the path have the same OID. `parentTree` is NULL for the empty tree.
+static int GTEnumeratorPathChanged(bool *changed, git_repository *repo, const git_oid *tree, const git_oid *parentTree, const char *components) {
+	bool found = true;
+	bool parentFound = (parentTree != NULL);
+	git_oid oid = *tree;
+	git_oid parentOID = {{ 0 }};
+	if (parentFound) parentOID = *parentTree;
+	git_filemode_t mode = GIT_FILEMODE_TREE;
+	git_filemode_t parentMode = GIT_FILEMODE_TREE;
+
+	for (const char *name = components; *name != '\0'; name += strlen(name) + 1) {
+		if (!found && !parentFound) break;
+		if (found && parentFound && mode == parentMode && git_oid_equal(&oid, &parentOID)) break;
+
+		int gitError = GTEnumeratorDescendPath(&found, &oid, &mode, repo, name);
+		if (gitError == GIT_OK) gitError = GTEnumeratorDescendPath(&parentFound, &parentOID, &parentMode, repo, name);
+		if (gitError != GIT_OK) return gitError;
+	}
+
+	*changed = (found != parentFound) || (found && (mode != parentMode || !git_oid_equal(&oid, &parentOID)));
+	return GIT_OK;
+}
+
+static int GTEnumeratorPathsChanged(bool *changed, git_repository *repo, const git_oid *tree, const git_oid *parentTree, const char * const *paths, size_t pathCount) {
+	*changed = false;
+	if (parentTree != NULL && git_oid_equal(tree, parentTree)) return GIT_OK;
+
+	for (size_t i = 0; i < pathCount && !*changed; i++) {
+		int gitError = GTEnumeratorPathChanged(changed, repo, tree, parentTree, paths[i]);
+		if (gitError != GIT_OK) return gitError;
+	}
+
+	return GIT_OK;
+}
+
+// Fills in `check` for the commit it identifies. Safe to call from any thread
+// which has `repo` to itself.
+static void GTEnumeratorCheckPaths(GTEnumeratorPathCheck *check, git_repository *repo, const char * const *paths, size_t pathCount) {
+	check->parentCount = 0;
+	check->unchangedCount = 0;
+
+	git_commit *commit = NULL;
+	check->error = git_commit_lookup(&commit, repo, &check->oid);
+	if (check->error != GIT_OK) return;
+
+	const git_oid *tree = git_commit_tree_id(commit);
+	check->parentCount = git_commit_parentcount(commit);
+
+	bool changed = false;
+	if (check->parentCount == 0) {
+		check->error = GTEnumeratorPathsChanged(&changed, repo, tree, NULL, paths, pathCount);
+		if (check->error == GIT_OK && !changed) check->unchangedCount = 1;
+	}
+
+	for (unsigned int i = 0; i < check->parentCount && check->error == GIT_OK; i++) {
+		git_commit *parent = NULL;
+		check->error = git_commit_parent(&parent, commit, i);
+		if (check->error != GIT_OK) break;
+
+		check->error = GTEnumeratorPathsChanged(&changed, repo, tree, git_commit_tree_id(parent), paths, pathCount);
+		if (check->error == GIT_OK && !changed && check->unchangedCount++ == 0) {
+			git_oid_cpy(&check->unchangedParentOID, git_commit_id(parent));
+		}
+
+		git_commit_free(parent);
+	}
+
+	git_commit_free(commit);
+}
+
+- (int)nextPathLimitedGitOid:(git_oid *)oid {
+	// Simplified history is walked children first, so it has to be complete
+	// before it can be reversed.
+	BOOL reverseWhenComplete = self.sourceOptions != self.options && (self.options & GTEnumeratorOptionsReverse) != 0;
+
+	while (self.pathOIDIndex >= self.pathOIDs.length / sizeof(git_oid)) {
+		if (self.sourceExhausted) return GIT_ITEROVER;
+
+		self.pathOIDs.length = 0;
+		self.pathOIDIndex = 0;
+
+		do {
+			int gitError = [self checkNextPaths];
+			if (gitError != GIT_OK) return gitError;
+		} while (reverseWhenComplete && !self.sourceExhausted);
+
+		if (reverseWhenComplete) {
+			git_oid *oids = self.pathOIDs.mutableBytes;
+			NSUInteger count = self.pathOIDs.length / sizeof(git_oid);
+			for (NSUInteger i = 0; i < count / 2; i++) {
+				git_oid swap = oids[i];
+				oids[i] = oids[count - i - 1];
+				oids[count - i - 1] = swap;
+			}
+		}
+	}
+
+	git_oid_cpy(oid, (const git_oid *)self.pathOIDs.bytes + self.pathOIDIndex++);
+	return GIT_OK;
+}
+
+// Checks the next batch of commits from the revwalk or commit graph, and
+// appends those which changed the limiting paths to `pathOIDs`.
+- (int)checkNextPaths {
+	NSUInteger concurrency = MAX(self.pathCheckConcurrency, (NSUInteger)1);
+	NSUInteger batchSize = GTEnumeratorPathCheckBatchSize * concurrency;
+
+	NSMutableData *checkData = [NSMutableData dataWithLength:batchSize * sizeof(GTEnumeratorPathCheck)];
+	GTEnumeratorPathCheck *checks = checkData.mutableBytes;
+
+	NSUInteger count = 0;
+	while (count < batchSize) {
+		int gitError = [self nextSourceGitOid:&checks[count].oid];
+		if (gitError == GIT_ITEROVER) {
+			self.sourceExhausted = YES;
+			break;
+		}
+		if (gitError != GIT_OK) return gitError;
+
+		count++;
+	}
+
+	NSArray *pathComponents = self.pathComponents;
+	NSMutableData *pathData = [NSMutableData dataWithLength:pathComponents.count * sizeof(const char *)];
+	const char **paths = pathData.mutableBytes;
+	for (NSUInteger i = 0; i < pathComponents.count; i++) {
+		paths[i] = [pathComponents[i] bytes];
+	}
+
+	size_t pathCount = pathComponents.count;
+	git_repository *repo = self.repository.git_repository;
+	NSArray *repositories = (concurrency > 1 && count > GTEnumeratorPathCheckBatchSize ? [self pathCheckRepositoriesWithCount:concurrency] : nil);
+	if (repositories != nil) {
+		// Each thread takes every `concurrency`th commit, so the threads share
+		// the work evenly even if the batch is cut short.
+		dispatch_apply(concurrency, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t thread) {
+			git_repository *threadRepo = [repositories[thread] git_repository];
+			for (NSUInteger i = thread; i < count; i += concurrency) {
+				GTEnumeratorCheckPaths(&checks[i], threadRepo, paths, pathCount);
+			}
+		});
+	} else {
+		for (NSUInteger i = 0; i < count; i++) {
+			GTEnumeratorCheckPaths(&checks[i], repo, paths, pathCount);
+		}
+	}
+
+	for (NSUInteger i = 0; i < count; i++) {
+		if (checks[i].error != GIT_OK) return checks[i].error;
+
+		BOOL changed;
+		if (self.simplifiesPathHistory) {
+			int gitError = [self simplifyPathCheck:&checks[i] changed:&changed];
+			if (gitError != GIT_OK) return gitError;
+		} else {
+			changed = checks[i].unchangedCount < MAX(checks[i].parentCount, 1U);
+		}
+
+		if (changed) [self.pathOIDs appendBytes:&checks[i].oid length:sizeof(git_oid)];
+	}
+
+	return GIT_OK;
+}
+
+// Returns a repository handle for each of `count` path checking threads, or nil
+// if they can't be opened and the paths should be checked on this thread.
+- (NSArray<GTRepository *> *)pathCheckRepositoriesWithCount:(NSUInteger)count {
+	if (self.pathCheckRepositories.count == count) return self.pathCheckRepositories;
+
+	NSURL *gitDirectoryURL = self.repository.gitDirectoryURL;
+	if (gitDirectoryURL == nil) return nil;
+
+	NSMutableArray *repositories = [NSMutableArray arrayWithObject:self.repository];
+	for (NSUInteger i = 1; i < count; i++) {
+		GTRepository *repository = (i < self.pathCheckRepositories.count ? self.pathCheckRepositories[i] : [[GTRepository alloc] initWithGitDirectoryURL:gitDirectoryURL workingDirectoryURL:self.repository.fileURL error:NULL]);
+		if (repository == nil) return nil;
+
+		[repositories addObject:repository];
+	}
+
+	self.pathCheckRepositories = repositories;
+	return repositories;
+}
+
+// Decides whether the checked commit is returned, and which of its parents
+// are followed, when simplifying history. Every child of a commit has been
+// walked before it.
+- (int)simplifyPathCheck:(const GTEnumeratorPathCheck *)check changed:(BOOL *)changed {
+	// A commit without any walked children is one of the tips.
+	BOOL reached = [self.followedOIDs removeGitOid:&check->oid] || ![self.childOIDs containsGitOid:&check->oid];
+	[self.childOIDs removeGitOid:&check->oid];
+
+	*changed = reached && check->unchangedCount == 0;
+
+	BOOL followsOneParent = (check->unchangedCount > 0 && check->parentCount > 0);
+	if (reached && followsOneParent && ![self.followedOIDs addGitOid:&check->unchangedParentOID added:NULL]) {
+		git_error_set_oom();
+		return GIT_ERROR;
+	}
+
+	git_commit *commit = NULL;
+	int gitError = git_commit_lookup(&commit, self.repository.git_repository, &check->oid);
+	if (gitError != GIT_OK) return gitError;
+
+	for (unsigned int i = 0; i < check->parentCount; i++) {
+		const git_oid *parentOID = git_commit_parent_id(commit, i);
+		BOOL success = [self.childOIDs addGitOid:parentOID added:NULL];
+		if (success && reached && !followsOneParent) success = [self.followedOIDs addGitOid:parentOID added:NULL];
+		if (!success) {
+			git_commit_free(commit);
+			git_error_set_oom();
+			return GIT_ERROR;
+		}
+	}
+
+	git_commit_free(commit);
+	return GIT_OK;
+}
+
 - (GTOID *)nextOIDWithSuccess:(BOOL *)success error:(NSError **)error {
 	git_oid oid;
 
-	int gitError = git_revwalk_next(&oid, self.walk);
+	int gitError = [self nextGitOid:&oid];
 	if (gitError == GIT_ITEROVER) {
 		if (success != NULL) *success = YES;
 		return nil;
@@ -204,7 +799,7 @@
 	}
 
 	if (success != NULL) *success = YES;
-	return [GTOID oidWithGitOid:&oid];
+	return [self.repository OIDWithGitOid:&oid];
 }
 
 - (GTCommit *)nextObjectWithSuccess:(BOOL *)success error:(NSError **)error {
@@ -216,7 +811,13 @@
 	}
 	
 	// Ignore error if we can't lookup object and just return nil.
-	GTCommit *commit = [self.repository lookUpObjectByOID:oid objectType:GTObjectTypeCommit error:error];
+	GTCommit *commit;
+	if (self.returnsLazyCommits) {
+		commit = [self.repository lookUpLazyCommitByOID:oid error:error];
+	} else {
+		commit = [self.repository lookUpObjectByOID:oid objectType:GTObjectTypeCommit error:error];
+	}
+
 	if (success != NULL) *success = (commit != nil);
 	return commit;
 }
@@ -238,13 +839,53 @@
 	return array;
 }
 
+- (NSUInteger)nextOIDs:(git_oid *)buffer maxCount:(NSUInteger)maxCount error:(NSError **)error {
+	NSParameterAssert(buffer != NULL || maxCount == 0);
+
+	NSUInteger count = 0;
+	while (count < maxCount) {
+		int gitError = [self nextGitOid:&buffer[count]];
+		if (gitError == GIT_ITEROVER) break;
+		if (gitError != GIT_OK) {
+			if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to get next SHA with rev walker."];
+			return NSNotFound;
+		}
+
+		count++;
+	}
+
+	return count;
+}
+
+- (NSData *)nextOIDDataWithMaxCount:(NSUInteger)maxCount error:(NSError **)error {
+	// Grow in chunks, since the number of remaining commits isn't known.
+	static const NSUInteger chunkCount = 4096;
+
+	NSMutableData *data = [NSMutableData data];
+	NSUInteger count = 0;
+	while (count < maxCount) {
+		NSUInteger wanted = MIN(chunkCount, maxCount - count);
+		data.length = (count + wanted) * sizeof(git_oid);
+
+		git_oid *buffer = (git_oid *)data.mutableBytes + count;
+		NSUInteger written = [self nextOIDs:buffer maxCount:wanted error:error];
+		if (written == NSNotFound) return nil;
+
+		count += written;
+		if (written < wanted) break;
+	}
+
+	data.length = count * sizeof(git_oid);
+	return data;
+}
+
 - (NSUInteger)countRemainingObjects:(NSError **)error {
 	git_oid oid;
 
 	int gitError;
 	NSUInteger count = 0;
 
-	while ((gitError = git_revwalk_next(&oid, self.walk)) == GIT_OK) {
+	while ((gitError = [self nextGitOid:&oid]) == GIT_OK) {
 		count++;
 	}
 
@@ -256,6 +897,26 @@
 	}
 }
 
+- (BOOL)addRemainingOIDsToSet:(GTOIDSet *)set error:(NSError **)error {
+	NSParameterAssert(set != nil);
+
+	git_oid oid;
+	int gitError;
+	while ((gitError = [self nextGitOid:&oid]) == GIT_OK) {
+		if (![set addGitOid:&oid added:NULL]) {
+			if (error != NULL) *error = [NSError git_errorFor:GIT_ERROR description:@"Failed to grow the set for the walked commits"];
+			return NO;
+		}
+	}
+
+	if (gitError != GIT_ITEROVER) {
+		if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to get next SHA with rev walker."];
+		return NO;
+	}
+
+	return YES;
+}
+
 #pragma mark NSEnumerator
 
 - (NSArray *)allObjects {
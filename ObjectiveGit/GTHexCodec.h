@@ -0,0 +1,34 @@
+//
+//  GTHexCodec.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "git2/oid.h"
+
+// Hex encoding and decoding of object IDs.
+//
+// These use SSE2 or NEON where available and fall back to a lookup table
+// otherwise. Unlike git_oid_fmt and git_oid_fromstr, nothing here touches
+// libgit2's thread-local error state, which keeps batch conversions cheap.
+
+// Writes the 40 lowercase hex characters of `oid` to `out`. No NUL terminator
+// is written.
+void GTHexEncodeOid(const git_oid *oid, char *out);
+
+// Writes the hex characters of `count` OIDs back to back into `out`, which
+// must be able to hold `count * GIT_OID_HEXSZ` bytes.
+void GTHexEncodeOids(const git_oid *oids, size_t count, char *out);
+
+// Parses exactly 40 hex characters, in either case, from `hex` into `out`.
+//
+// Returns whether all 40 characters were valid hex digits. `out` is undefined
+// if they weren't.
+BOOL GTHexDecodeOid(const char *hex, git_oid *out);
+
+// The portable implementations, exposed for comparison with the vectorized
+// ones.
+void GTHexEncodeOidScalar(const git_oid *oid, char *out);
+BOOL GTHexDecodeOidScalar(const char *hex, git_oid *out);
@@ -0,0 +1,174 @@
+//
+//  GTHexCodec.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTHexCodec.h"
+
+#if defined(__SSE2__)
+#import <emmintrin.h>
+#define GT_HEX_SSE2 1
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#import <arm_neon.h>
+#define GT_HEX_NEON 1
+#endif
+
+static const char GTHexDigits[16] = "0123456789abcdef";
+
+#pragma mark Scalar
+
+static inline void GTHexEncodeBytesScalar(const unsigned char *bytes, size_t length, char *out) {
+	for (size_t i = 0; i < length; i++) {
+		out[i * 2] = GTHexDigits[bytes[i] >> 4];
+		out[i * 2 + 1] = GTHexDigits[bytes[i] & 0x0f];
+	}
+}
+
+static inline int GTHexValue(char c) {
+	if (c >= '0' && c <= '9') return c - '0';
+
+	c |= 0x20;
+	if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+
+	return -1;
+}
+
+static inline BOOL GTHexDecodeBytesScalar(const char *hex, size_t length, unsigned char *out) {
+	for (size_t i = 0; i < length; i++) {
+		int high = GTHexValue(hex[i * 2]);
+		int low = GTHexValue(hex[i * 2 + 1]);
+		if (high < 0 || low < 0) return NO;
+
+		out[i] = (unsigned char)((high << 4) | low);
+	}
+
+	return YES;
+}
+
+void GTHexEncodeOidScalar(const git_oid *oid, char *out) {
+	GTHexEncodeBytesScalar(oid->id, GIT_OID_RAWSZ, out);
+}
+
+BOOL GTHexDecodeOidScalar(const char *hex, git_oid *out) {
+	return GTHexDecodeBytesScalar(hex, GIT_OID_RAWSZ, out->id);
+}
+
+#pragma mark SSE2
+
+#if GT_HEX_SSE2
+
+// Turns nibbles into their ASCII hex digits.
+static inline __m128i GTHexDigitsSSE2(__m128i nibbles) {
+	__m128i letterOffset = _mm_and_si128(_mm_cmpgt_epi8(nibbles, _mm_set1_epi8(9)), _mm_set1_epi8('a' - '0' - 10));
+	return _mm_add_epi8(_mm_add_epi8(nibbles, _mm_set1_epi8('0')), letterOffset);
+}
+
+// Turns ASCII hex digits into nibbles, clearing lanes of `valid` which don't
+// hold a hex digit.
+static inline __m128i GTHexValuesSSE2(__m128i chars, __m128i *valid) {
+	__m128i digits = _mm_sub_epi8(chars, _mm_set1_epi8('0'));
+	__m128i letters = _mm_sub_epi8(_mm_or_si128(chars, _mm_set1_epi8(0x20)), _mm_set1_epi8('a'));
+
+	// SSE2 has no unsigned byte comparison, but min(x, n) == x is x <= n.
+	__m128i isDigit = _mm_cmpeq_epi8(_mm_min_epu8(digits, _mm_set1_epi8(9)), digits);
+	__m128i isLetter = _mm_cmpeq_epi8(_mm_min_epu8(letters, _mm_set1_epi8(5)), letters);
+	*valid = _mm_and_si128(*valid, _mm_or_si128(isDigit, isLetter));
+
+	__m128i letterValues = _mm_add_epi8(letters, _mm_set1_epi8(10));
+	return _mm_or_si128(_mm_and_si128(isDigit, digits), _mm_and_si128(isLetter, letterValues));
+}
+
+// Combines pairs of nibbles into bytes. Each 16-bit lane holds the high nibble
+// in its low byte and the low nibble in its high byte, and the result is left
+// in the low byte of the lane.
+static inline __m128i GTHexPackSSE2(__m128i values) {
+	__m128i high = _mm_and_si128(_mm_slli_epi16(values, 4), _mm_set1_epi16(0x00f0));
+	__m128i low = _mm_srli_epi16(values, 8);
+	return _mm_or_si128(high, low);
+}
+
+void GTHexEncodeOid(const git_oid *oid, char *out) {
+	__m128i bytes = _mm_loadu_si128((const __m128i *)oid->id);
+	__m128i mask = _mm_set1_epi8(0x0f);
+	__m128i high = _mm_and_si128(_mm_srli_epi16(bytes, 4), mask);
+	__m128i low = _mm_and_si128(bytes, mask);
+
+	_mm_storeu_si128((__m128i *)out, GTHexDigitsSSE2(_mm_unpacklo_epi8(high, low)));
+	_mm_storeu_si128((__m128i *)(out + 16), GTHexDigitsSSE2(_mm_unpackhi_epi8(high, low)));
+	GTHexEncodeBytesScalar(oid->id + 16, GIT_OID_RAWSZ - 16, out + 32);
+}
+
+BOOL GTHexDecodeOid(const char *hex, git_oid *out) {
+	__m128i valid = _mm_set1_epi8((char)0xff);
+	__m128i first = GTHexValuesSSE2(_mm_loadu_si128((const __m128i *)hex), &valid);
+	__m128i second = GTHexValuesSSE2(_mm_loadu_si128((const __m128i *)(hex + 16)), &valid);
+	if (_mm_movemask_epi8(valid) != 0xffff) return NO;
+
+	_mm_storeu_si128((__m128i *)out->id, _mm_packus_epi16(GTHexPackSSE2(first), GTHexPackSSE2(second)));
+	return GTHexDecodeBytesScalar(hex + 32, GIT_OID_RAWSZ - 16, out->id + 16);
+}
+
+#pragma mark NEON
+
+#elif GT_HEX_NEON
+
+// Turns ASCII hex digits into nibbles, clearing lanes of `valid` which don't
+// hold a hex digit.
+static inline uint8x16_t GTHexValuesNEON(uint8x16_t chars, uint8x16_t *valid) {
+	uint8x16_t digits = vsubq_u8(chars, vdupq_n_u8('0'));
+	uint8x16_t letters = vsubq_u8(vorrq_u8(chars, vdupq_n_u8(0x20)), vdupq_n_u8('a'));
+
+	uint8x16_t isDigit = vcleq_u8(digits, vdupq_n_u8(9));
+	uint8x16_t isLetter = vcleq_u8(letters, vdupq_n_u8(5));
+	*valid = vandq_u8(*valid, vorrq_u8(isDigit, isLetter));
+
+	return vbslq_u8(isDigit, digits, vaddq_u8(letters, vdupq_n_u8(10)));
+}
+
+void GTHexEncodeOid(const git_oid *oid, char *out) {
+	uint8x16_t table = vld1q_u8((const uint8_t *)GTHexDigits);
+	uint8x16_t bytes = vld1q_u8(oid->id);
+
+	uint8x16x2_t chars;
+	chars.val[0] = vqtbl1q_u8(table, vshrq_n_u8(bytes, 4));
+	chars.val[1] = vqtbl1q_u8(table, vandq_u8(bytes, vdupq_n_u8(0x0f)));
+
+	// vst2 interleaves the high and low digits of each byte.
+	vst2q_u8((uint8_t *)out, chars);
+	GTHexEncodeBytesScalar(oid->id + 16, GIT_OID_RAWSZ - 16, out + 32);
+}
+
+BOOL GTHexDecodeOid(const char *hex, git_oid *out) {
+	// vld2 splits the characters into high (even) and low (odd) digits.
+	uint8x16x2_t chars = vld2q_u8((const uint8_t *)hex);
+
+	uint8x16_t valid = vdupq_n_u8(0xff);
+	uint8x16_t high = GTHexValuesNEON(chars.val[0], &valid);
+	uint8x16_t low = GTHexValuesNEON(chars.val[1], &valid);
+	if (vminvq_u8(valid) != 0xff) return NO;
+
+	vst1q_u8(out->id, vsliq_n_u8(low, high, 4));
+	return GTHexDecodeBytesScalar(hex + 32, GIT_OID_RAWSZ - 16, out->id + 16);
+}
+
+#pragma mark Fallback
+
+#else
+
+void GTHexEncodeOid(const git_oid *oid, char *out) {
+	GTHexEncodeOidScalar(oid, out);
+}
+
+BOOL GTHexDecodeOid(const char *hex, git_oid *out) {
+	return GTHexDecodeOidScalar(hex, out);
+}
+
+#endif
+
+void GTHexEncodeOids(const git_oid *oids, size_t count, char *out) {
+	for (size_t i = 0; i < count; i++) {
+		GTHexEncodeOid(&oids[i], out + i * GIT_OID_HEXSZ);
+	}
+}
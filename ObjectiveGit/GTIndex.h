@@ -31,6 +31,7 @@
 #include "git2/types.h"
 
 @class GTIndexEntry;
+@class GTOIDSet;
 @class GTRepository;
 @class GTTree;
 
@@ -118,6 +119,16 @@ NS_ASSUME_NONNULL_BEGIN
 /// Returns a new GTIndexEntry, or nil if an error occurred.
 - (GTIndexEntry * _Nullable)entryWithPath:(NSString *)path error:(NSError **)error;
 
+/// Adds the object IDs of all the entries in the index to a set, without
+/// creating any GTIndexEntry objects.
+///
+/// set   - The set to add the object IDs to. Cannot be nil.
+/// error - The error if one occurred.
+///
+/// Returns whether every object ID was added, which will only be NO if the set
+/// couldn't grow to hold them.
+- (BOOL)addEntryOIDsToSet:(GTOIDSet *)set error:(NSError **)error;
+
 /// Add an entry to the index.
 ///
 /// Note that this *cannot* add submodules. See -[GTSubmodule addToIndex:].
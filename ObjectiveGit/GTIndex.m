@@ -33,6 +33,7 @@
 #import "GTConfiguration.h"
 #import "GTIndexEntry.h"
 #import "GTOID.h"
+#import "GTOIDSet.h"
 #import "GTRepository+Private.h"
 #import "GTRepository.h"
 #import "GTTree.h"
@@ -286,6 +287,21 @@ typedef BOOL (^GTIndexPathspecMatchedBlock)(NSString *matchedPathspec, NSString
 	return entries;
 }
 
+- (BOOL)addEntryOIDsToSet:(GTOIDSet *)set error:(NSError **)error {
+	NSParameterAssert(set != nil);
+
+	size_t count = git_index_entrycount(self.git_index);
+	for (size_t i = 0; i < count; i++) {
+		const git_index_entry *entry = git_index_get_byindex(self.git_index, i);
+		if (entry == NULL || [set addGitOid:&entry->id added:NULL]) continue;
+
+		if (error != NULL) *error = [NSError git_errorFor:GIT_ERROR description:@"Failed to grow the set for the index entries"];
+		return NO;
+	}
+
+	return YES;
+}
+
 #pragma mark Conflicts
 
 - (BOOL)hasConflicts {
@@ -77,6 +77,51 @@ NS_ASSUME_NONNULL_BEGIN
 
 @end
 
+@interface GTOID (GTBatchConversion)
+
+/// Converts many SHAs to OIDs at once.
+///
+/// This is considerably faster than calling -initWithSHA:error: in a loop, as
+/// the SHAs are decoded without intermediate C strings.
+///
+/// SHAs  - The SHAs to convert. Each must be exactly 40 hex characters long.
+///         Cannot be nil.
+/// error - If not NULL, set to an error describing the first SHA which
+///         couldn't be converted.
+///
+/// Returns the OIDs in the same order as `SHAs`, or nil if any of the SHAs
+/// couldn't be converted.
++ (NSArray<GTOID *> * _Nullable)OIDsWithSHAStrings:(NSArray<NSString *> *)SHAs error:(NSError **)error;
+
+/// Returns the SHAs of the given OIDs written back to back, without
+/// separators, as `OIDs.count * GIT_OID_HEXSZ` bytes of lowercase hex.
+///
+/// OIDs - The OIDs to format. Cannot be nil.
++ (NSData *)SHADataWithOIDs:(NSArray<GTOID *> *)OIDs;
+
+/// Writes the SHAs of raw object IDs back to back, without separators or a NUL
+/// terminator, into a caller-owned buffer.
+///
+/// buffer - The buffer to write to. Must be at least `count * GIT_OID_HEXSZ`
+///          bytes long.
+/// oids   - The object IDs to format. Cannot be NULL unless `count` is 0.
+/// count  - The number of object IDs in `oids`.
++ (void)getSHAs:(char *)buffer fromGitOids:(const git_oid *)oids count:(NSUInteger)count;
+
+/// Parses SHAs written back to back, as produced by +SHADataWithOIDs:, into a
+/// caller-owned array of raw object IDs.
+///
+/// oids  - The array to write to. Must be able to hold
+///         `data.length / GIT_OID_HEXSZ` object IDs.
+/// data  - The hex data to parse. Its length must be a multiple of
+///         GIT_OID_HEXSZ. Cannot be nil.
+/// error - If not NULL, set to any error that occurs.
+///
+/// Returns whether all the SHAs could be parsed.
++ (BOOL)getGitOids:(git_oid *)oids fromSHAData:(NSData *)data error:(NSError **)error;
+
+@end
+
 @interface GTOID (GTObjectDatabase)
 
 /// Calculates an OID by hashing the passed data and object type.
@@ -7,6 +7,7 @@
 //
 
 #import "GTOID.h"
+#import "GTHexCodec.h"
 #import "NSError+Git.h"
 
 #import "git2/errors.h"
@@ -27,10 +28,10 @@
 }
 
 - (NSString *)SHA {
-	char *SHA = git_oid_tostr_s(self.git_oid);
-	NSString *str = [[NSString alloc] initWithBytes:SHA
-                                             length:GIT_OID_HEXSZ
-                                           encoding:NSUTF8StringEncoding];
+	char SHA[GIT_OID_HEXSZ];
+	GTHexEncodeOid(self.git_oid, SHA);
+
+	NSString *str = [[NSString alloc] initWithBytes:SHA length:GIT_OID_HEXSZ encoding:NSASCIIStringEncoding];
 	NSAssert(str != nil, @"Failed to create SHA string");
 	return str;
 }
@@ -108,9 +109,11 @@
 }
 
 - (NSUInteger)hash {
-	// Hash the raw OID.
-	NSData *data = [[NSData alloc] initWithBytesNoCopy:_git_oid.id length:GIT_OID_RAWSZ freeWhenDone:NO];
-	return data.hash;
+	// Object IDs are already uniformly distributed, so the leading bytes make
+	// a perfectly good hash without allocating anything.
+	NSUInteger hash;
+	memcpy(&hash, _git_oid.id, sizeof(hash));
+	return hash;
 }
 
 - (BOOL)isEqual:(GTOID *)object {
@@ -127,6 +130,71 @@
 
 @end
 
+@implementation GTOID (GTBatchConversion)
+
++ (NSArray *)OIDsWithSHAStrings:(NSArray *)SHAs error:(NSError **)error {
+	NSParameterAssert(SHAs != nil);
+
+	NSMutableArray *OIDs = [NSMutableArray arrayWithCapacity:SHAs.count];
+	for (NSString *SHA in SHAs) {
+		char buffer[GIT_OID_HEXSZ];
+		NSUInteger usedLength = 0;
+		git_oid oid;
+
+		BOOL copied = (SHA.length == GIT_OID_HEXSZ && [SHA getBytes:buffer maxLength:sizeof(buffer) usedLength:&usedLength encoding:NSASCIIStringEncoding options:0 range:NSMakeRange(0, GIT_OID_HEXSZ) remainingRange:NULL]);
+		if (!copied || usedLength != GIT_OID_HEXSZ || !GTHexDecodeOid(buffer, &oid)) {
+			if (error != NULL) *error = [NSError git_errorFor:GIT_ERROR description:@"Failed to convert string '%@' to object id", SHA];
+			return nil;
+		}
+
+		[OIDs addObject:[[self alloc] initWithGitOid:&oid]];
+	}
+
+	return OIDs;
+}
+
++ (NSData *)SHADataWithOIDs:(NSArray *)OIDs {
+	NSParameterAssert(OIDs != nil);
+
+	NSMutableData *data = [NSMutableData dataWithLength:OIDs.count * GIT_OID_HEXSZ];
+	char *bytes = data.mutableBytes;
+	for (GTOID *OID in OIDs) {
+		GTHexEncodeOid(OID.git_oid, bytes);
+		bytes += GIT_OID_HEXSZ;
+	}
+
+	return data;
+}
+
++ (void)getSHAs:(char *)buffer fromGitOids:(const git_oid *)oids count:(NSUInteger)count {
+	NSParameterAssert(buffer != NULL || count == 0);
+	NSParameterAssert(oids != NULL || count == 0);
+
+	GTHexEncodeOids(oids, count, buffer);
+}
+
++ (BOOL)getGitOids:(git_oid *)oids fromSHAData:(NSData *)data error:(NSError **)error {
+	NSParameterAssert(data != nil);
+
+	if (data.length % GIT_OID_HEXSZ != 0) {
+		if (error != NULL) *error = [NSError git_errorFor:GIT_ERROR description:@"SHA data of length %lu is not a whole number of object ids", (unsigned long)data.length];
+		return NO;
+	}
+
+	const char *bytes = data.bytes;
+	NSUInteger count = data.length / GIT_OID_HEXSZ;
+	for (NSUInteger i = 0; i < count; i++) {
+		if (!GTHexDecodeOid(bytes + i * GIT_OID_HEXSZ, &oids[i])) {
+			if (error != NULL) *error = [NSError git_errorFor:GIT_ERROR description:@"Failed to convert SHA at index %lu to object id", (unsigned long)i];
+			return NO;
+		}
+	}
+
+	return YES;
+}
+
+@end
+
 @implementation GTOID (GTObjectDatabase)
 
 + (instancetype)OIDByHashingData:(NSData *)data type:(GTObjectType)type error:(NSError **)error {
@@ -0,0 +1,76 @@
+//
+//  GTOIDAbbreviationIndex.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "git2/oid.h"
+
+@class GTObjectDatabase;
+@class GTOID;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A sorted snapshot of every object ID in an object database, used to find
+/// the shortest unambiguous abbreviation of many OIDs at once.
+///
+/// The index is built by reading pack indexes and loose object directories
+/// directly, including those of alternate object databases. Calling -refresh:
+/// merges in packs which appeared since the index was built, and rescans the
+/// loose objects.
+///
+/// This class is not thread safe.
+@interface GTOIDAbbreviationIndex : NSObject
+
+/// The object database the receiver indexes.
+@property (nonatomic, readonly, strong) GTObjectDatabase *objectDatabase;
+
+/// The number of distinct object IDs in the index.
+@property (nonatomic, readonly, assign) NSUInteger count;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Builds an index of all the objects in the given database. Designated
+/// initializer.
+///
+/// objectDatabase - The object database to index. Cannot be nil.
+/// error          - The error if one occurred.
+///
+/// Returns the initialized index, or nil if an error occurred.
+- (instancetype _Nullable)initWithObjectDatabase:(GTObjectDatabase *)objectDatabase error:(NSError **)error NS_DESIGNATED_INITIALIZER;
+
+/// Brings the index up to date with the object database.
+///
+/// Packs which have appeared since the last refresh are merged into the index,
+/// without rereading the packs which were already indexed. If any indexed pack
+/// has disappeared (e.g., after a repack), the index is rebuilt from scratch.
+/// Loose objects are always rescanned.
+///
+/// error - The error if one occurred.
+///
+/// Returns whether the refresh succeeded.
+- (BOOL)refresh:(NSError **)error;
+
+/// Returns the number of hex characters needed to unambiguously identify the
+/// given object ID among the indexed objects.
+///
+/// oid           - The object ID to abbreviate. It does not need to be in the
+///                 index. Cannot be NULL.
+/// minimumLength - The shortest length to return, e.g. 7 to match git's
+///                 default. Lengths above GIT_OID_HEXSZ are clamped.
+- (NSUInteger)uniquePrefixLengthForGitOid:(const git_oid *)oid minimumLength:(NSUInteger)minimumLength;
+
+/// Returns the shortest unambiguous abbreviations of the given OIDs.
+///
+/// OIDs          - The OIDs to abbreviate. Cannot be nil.
+/// minimumLength - The shortest abbreviation to return, e.g. 7 to match git's
+///                 default.
+///
+/// Returns the abbreviated SHAs in the same order as `OIDs`.
+- (NSArray<NSString *> *)uniqueSHAPrefixesForOIDs:(NSArray<GTOID *> *)OIDs minimumLength:(NSUInteger)minimumLength;
+
+@end
+
+NS_ASSUME_NONNULL_END
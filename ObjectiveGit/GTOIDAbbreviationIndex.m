@@ -0,0 +1,360 @@
+//
+//  GTOIDAbbreviationIndex.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTOIDAbbreviationIndex.h"
+#import "GTObjectDatabase.h"
+#import "GTOID.h"
+#import "GTRepository.h"
+#import "GTHexCodec.h"
+#import "NSError+Git.h"
+#import "EXTScope.h"
+
+#import "git2/buffer.h"
+#import "git2/errors.h"
+#import "git2/repository.h"
+
+// The pack index header and fanout table. Version 1 indexes have no header.
+static const unsigned char GTPackIndexMagic[4] = { 0xff, 't', 'O', 'c' };
+static const NSUInteger GTPackIndexHeaderSize = 8;
+static const NSUInteger GTPackIndexFanoutSize = 256 * sizeof(uint32_t);
+static const NSUInteger GTPackIndexV1EntrySize = sizeof(uint32_t) + GIT_OID_RAWSZ;
+
+static int GTOIDAbbreviationCompare(const void *a, const void *b) {
+	return git_oid_cmp(a, b);
+}
+
+// Sorts the OIDs in place and drops duplicates, returning the new count.
+static NSUInteger GTOIDAbbreviationSortUnique(git_oid *oids, NSUInteger count) {
+	if (count < 2) return count;
+
+	qsort(oids, count, sizeof(git_oid), GTOIDAbbreviationCompare);
+
+	NSUInteger unique = 1;
+	for (NSUInteger i = 1; i < count; i++) {
+		if (git_oid_equal(&oids[i], &oids[unique - 1])) continue;
+		oids[unique++] = oids[i];
+	}
+
+	return unique;
+}
+
+// Returns the number of leading hex digits the two OIDs have in common.
+static inline NSUInteger GTOIDCommonHexPrefixLength(const git_oid *a, const git_oid *b) {
+	for (NSUInteger i = 0; i < GIT_OID_RAWSZ; i++) {
+		unsigned char difference = a->id[i] ^ b->id[i];
+		if (difference == 0) continue;
+
+		return i * 2 + ((difference & 0xf0) == 0 ? 1 : 0);
+	}
+
+	return GIT_OID_HEXSZ;
+}
+
+// Returns the longest hex prefix `oid` shares with any OID in the sorted array
+// other than itself.
+static NSUInteger GTOIDLongestSharedPrefix(const git_oid *oid, const git_oid *oids, NSUInteger count) {
+	NSUInteger low = 0;
+	NSUInteger high = count;
+	while (low < high) {
+		NSUInteger middle = low + (high - low) / 2;
+		if (git_oid_cmp(&oids[middle], oid) < 0) {
+			low = middle + 1;
+		} else {
+			high = middle;
+		}
+	}
+
+	// Only the neighbours in sort order can share the longest prefix.
+	NSUInteger longest = 0;
+	if (low > 0) longest = GTOIDCommonHexPrefixLength(oid, &oids[low - 1]);
+
+	NSUInteger next = low;
+	if (next < count && git_oid_equal(&oids[next], oid)) next++;
+	if (next < count) longest = MAX(longest, GTOIDCommonHexPrefixLength(oid, &oids[next]));
+
+	return longest;
+}
+
+@interface GTOIDAbbreviationIndex ()
+
+// The object directories to index: the repository's own, then its alternates.
+@property (nonatomic, copy) NSArray<NSString *> *objectDirectoryPaths;
+
+// The sorted, unique OIDs of every indexed pack.
+@property (nonatomic, strong) NSMutableData *packedOIDs;
+
+// The sorted, unique OIDs of the loose objects found by the last refresh.
+@property (nonatomic, strong) NSMutableData *looseOIDs;
+
+// The paths of the pack indexes merged into `packedOIDs`.
+@property (nonatomic, strong) NSMutableSet<NSString *> *indexedPackPaths;
+
+@end
+
+@implementation GTOIDAbbreviationIndex
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	NSAssert(NO, @"Call to an unavailable initializer.");
+	return nil;
+}
+
+- (instancetype)initWithObjectDatabase:(GTObjectDatabase *)objectDatabase error:(NSError **)error {
+	NSParameterAssert(objectDatabase != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_objectDatabase = objectDatabase;
+
+	git_buf path = GIT_BUF_INIT_CONST(0, NULL);
+	int gitError = git_repository_item_path(&path, objectDatabase.repository.git_repository, GIT_REPOSITORY_ITEM_OBJECTS);
+	@onExit {
+		git_buf_dispose(&path);
+	};
+
+	if (gitError != GIT_OK) {
+		if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to find the objects directory."];
+		return nil;
+	}
+
+	NSString *objectsPath = [[NSFileManager defaultManager] stringWithFileSystemRepresentation:path.ptr length:path.size];
+	_objectDirectoryPaths = [@[ objectsPath ] arrayByAddingObjectsFromArray:[self.class alternatePathsForObjectDirectory:objectsPath]];
+
+	if (![self rebuild:error]) return nil;
+
+	return self;
+}
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> count: %lu, objectDatabase: %@", NSStringFromClass(self.class), self, (unsigned long)self.count, self.objectDatabase];
+}
+
+#pragma mark Properties
+
+- (NSUInteger)count {
+	NSUInteger packedCount = self.packedOIDs.length / sizeof(git_oid);
+	NSUInteger looseCount = self.looseOIDs.length / sizeof(git_oid);
+	if (looseCount == 0) return packedCount;
+
+	// Objects are rarely both loose and packed, so count the overlap directly
+	// rather than keeping a merged copy around.
+	const git_oid *packed = self.packedOIDs.bytes;
+	const git_oid *loose = self.looseOIDs.bytes;
+	NSUInteger duplicates = 0;
+	NSUInteger i = 0;
+	NSUInteger j = 0;
+	while (i < packedCount && j < looseCount) {
+		int comparison = git_oid_cmp(&packed[i], &loose[j]);
+		if (comparison == 0) duplicates++;
+		if (comparison <= 0) i++;
+		if (comparison >= 0) j++;
+	}
+
+	return packedCount + looseCount - duplicates;
+}
+
+#pragma mark Refreshing
+
+- (BOOL)rebuild:(NSError **)error {
+	self.packedOIDs = [NSMutableData data];
+	self.indexedPackPaths = [NSMutableSet set];
+
+	return [self refresh:error];
+}
+
+- (BOOL)refresh:(NSError **)error {
+	NSMutableSet *packPaths = [NSMutableSet set];
+	for (NSString *objectsPath in self.objectDirectoryPaths) {
+		[packPaths unionSet:[self.class packIndexPathsInObjectDirectory:objectsPath]];
+	}
+
+	// Objects in a pack which went away have usually moved into a new one, but
+	// we can't tell which, so start over rather than keep stale entries.
+	if (![self.indexedPackPaths isSubsetOfSet:packPaths]) return [self rebuild:error];
+
+	NSMutableSet *newPackPaths = [packPaths mutableCopy];
+	[newPackPaths minusSet:self.indexedPackPaths];
+
+	for (NSString *packPath in newPackPaths) {
+		if (![self mergePackIndexAtPath:packPath error:error]) return NO;
+		[self.indexedPackPaths addObject:packPath];
+	}
+
+	NSMutableData *looseOIDs = [NSMutableData data];
+	for (NSString *objectsPath in self.objectDirectoryPaths) {
+		[self.class appendLooseOIDsInObjectDirectory:objectsPath toData:looseOIDs];
+	}
+
+	NSUInteger looseCount = GTOIDAbbreviationSortUnique(looseOIDs.mutableBytes, looseOIDs.length / sizeof(git_oid));
+	looseOIDs.length = looseCount * sizeof(git_oid);
+	self.looseOIDs = looseOIDs;
+
+	return YES;
+}
+
+- (BOOL)mergePackIndexAtPath:(NSString *)path error:(NSError **)error {
+	NSData *data = [NSData dataWithContentsOfFile:path options:NSDataReadingMappedIfSafe error:error];
+	if (data == nil) return NO;
+
+	const unsigned char *bytes = data.bytes;
+	NSUInteger length = data.length;
+
+	BOOL hasHeader = length >= GTPackIndexHeaderSize && memcmp(bytes, GTPackIndexMagic, sizeof(GTPackIndexMagic)) == 0;
+	NSUInteger fanoutOffset = hasHeader ? GTPackIndexHeaderSize : 0;
+	if (hasHeader) {
+		uint32_t version;
+		memcpy(&version, bytes + sizeof(GTPackIndexMagic), sizeof(version));
+		if (CFSwapInt32BigToHost(version) != 2) {
+			if (error != NULL) *error = [NSError git_errorFor:GIT_ERROR description:@"Unsupported pack index version in %@", path];
+			return NO;
+		}
+	}
+
+	if (length < fanoutOffset + GTPackIndexFanoutSize) {
+		if (error != NULL) *error = [NSError git_errorFor:GIT_ERROR description:@"Truncated pack index %@", path];
+		return NO;
+	}
+
+	// The last fanout entry is the number of objects in the pack.
+	uint32_t objectCount;
+	memcpy(&objectCount, bytes + fanoutOffset + GTPackIndexFanoutSize - sizeof(objectCount), sizeof(objectCount));
+	objectCount = CFSwapInt32BigToHost(objectCount);
+
+	NSUInteger entriesOffset = fanoutOffset + GTPackIndexFanoutSize;
+	NSUInteger entrySize = hasHeader ? GIT_OID_RAWSZ : GTPackIndexV1EntrySize;
+	NSUInteger oidOffset = hasHeader ? 0 : sizeof(uint32_t);
+	if ((length - entriesOffset) / entrySize < objectCount) {
+		if (error != NULL) *error = [NSError git_errorFor:GIT_ERROR description:@"Truncated pack index %@", path];
+		return NO;
+	}
+
+	// Pack indexes are already sorted, so merge the two runs in one pass.
+	NSUInteger existingCount = self.packedOIDs.length / sizeof(git_oid);
+	const git_oid *existing = self.packedOIDs.bytes;
+	NSMutableData *merged = [NSMutableData dataWithLength:(existingCount + objectCount) * sizeof(git_oid)];
+	git_oid *output = merged.mutableBytes;
+
+	NSUInteger count = 0;
+	NSUInteger i = 0;
+	NSUInteger j = 0;
+	while (i < existingCount || j < objectCount) {
+		const git_oid *packed = (const git_oid *)(bytes + entriesOffset + j * entrySize + oidOffset);
+
+		int comparison;
+		if (i == existingCount) {
+			comparison = 1;
+		} else if (j == objectCount) {
+			comparison = -1;
+		} else {
+			comparison = git_oid_cmp(&existing[i], packed);
+		}
+
+		if (comparison <= 0) {
+			git_oid_cpy(&output[count], &existing[i++]);
+			if (comparison == 0) j++;
+		} else {
+			git_oid_cpy(&output[count], packed);
+			j++;
+		}
+
+		count++;
+	}
+
+	merged.length = count * sizeof(git_oid);
+	self.packedOIDs = merged;
+
+	return YES;
+}
+
++ (NSSet<NSString *> *)packIndexPathsInObjectDirectory:(NSString *)objectsPath {
+	NSString *packPath = [objectsPath stringByAppendingPathComponent:@"pack"];
+	NSArray *fileNames = [[NSFileManager defaultManager] contentsOfDirectoryAtPath:packPath error:NULL];
+
+	NSMutableSet *paths = [NSMutableSet set];
+	for (NSString *fileName in fileNames) {
+		if (![fileName.pathExtension isEqualToString:@"idx"]) continue;
+		[paths addObject:[packPath stringByAppendingPathComponent:fileName]];
+	}
+
+	return paths;
+}
+
++ (void)appendLooseOIDsInObjectDirectory:(NSString *)objectsPath toData:(NSMutableData *)data {
+	NSFileManager *fileManager = [NSFileManager defaultManager];
+
+	// Loose objects live at objects/xx/yyyy..., where xx is the first byte of
+	// the SHA and yyyy... the remaining 38 digits.
+	char SHA[GIT_OID_HEXSZ];
+	for (unsigned int byte = 0; byte <= 0xff; byte++) {
+		NSString *fanoutName = [NSString stringWithFormat:@"%02x", byte];
+		NSArray *fileNames = [fileManager contentsOfDirectoryAtPath:[objectsPath stringByAppendingPathComponent:fanoutName] error:NULL];
+		if (fileNames.count == 0) continue;
+
+		[fanoutName getBytes:SHA maxLength:2 usedLength:NULL encoding:NSASCIIStringEncoding options:0 range:NSMakeRange(0, 2) remainingRange:NULL];
+		for (NSString *fileName in fileNames) {
+			if (fileName.length != GIT_OID_HEXSZ - 2) continue;
+
+			BOOL copied = [fileName getBytes:SHA + 2 maxLength:GIT_OID_HEXSZ - 2 usedLength:NULL encoding:NSASCIIStringEncoding options:0 range:NSMakeRange(0, fileName.length) remainingRange:NULL];
+			if (!copied) continue;
+
+			git_oid oid;
+			if (!GTHexDecodeOid(SHA, &oid)) continue;
+
+			[data appendBytes:&oid length:sizeof(oid)];
+		}
+	}
+}
+
++ (NSArray<NSString *> *)alternatePathsForObjectDirectory:(NSString *)objectsPath {
+	NSString *alternatesPath = [objectsPath stringByAppendingPathComponent:@"info/alternates"];
+	NSString *contents = [NSString stringWithContentsOfFile:alternatesPath encoding:NSUTF8StringEncoding error:NULL];
+	if (contents == nil) return @[];
+
+	// Only the first level of alternates is followed, which covers the common
+	// case of `git clone --shared` and `--reference`.
+	NSMutableArray *paths = [NSMutableArray array];
+	for (NSString *line in [contents componentsSeparatedByCharactersInSet:NSCharacterSet.newlineCharacterSet]) {
+		NSString *path = [line stringByTrimmingCharactersInSet:NSCharacterSet.whitespaceCharacterSet];
+		if (path.length == 0 || [path hasPrefix:@"#"]) continue;
+
+		if (!path.isAbsolutePath) path = [objectsPath stringByAppendingPathComponent:path];
+		[paths addObject:path.stringByStandardizingPath];
+	}
+
+	return paths;
+}
+
+#pragma mark Abbreviating
+
+- (NSUInteger)uniquePrefixLengthForGitOid:(const git_oid *)oid minimumLength:(NSUInteger)minimumLength {
+	NSParameterAssert(oid != NULL);
+
+	NSUInteger shared = GTOIDLongestSharedPrefix(oid, self.packedOIDs.bytes, self.packedOIDs.length / sizeof(git_oid));
+	if (self.looseOIDs.length > 0) {
+		shared = MAX(shared, GTOIDLongestSharedPrefix(oid, self.looseOIDs.bytes, self.looseOIDs.length / sizeof(git_oid)));
+	}
+
+	return MIN(MAX(shared + 1, minimumLength), (NSUInteger)GIT_OID_HEXSZ);
+}
+
+- (NSArray<NSString *> *)uniqueSHAPrefixesForOIDs:(NSArray<GTOID *> *)OIDs minimumLength:(NSUInteger)minimumLength {
+	NSParameterAssert(OIDs != nil);
+
+	NSMutableArray *prefixes = [NSMutableArray arrayWithCapacity:OIDs.count];
+	char SHA[GIT_OID_HEXSZ];
+	for (GTOID *OID in OIDs) {
+		NSUInteger length = [self uniquePrefixLengthForGitOid:OID.git_oid minimumLength:minimumLength];
+		GTHexEncodeOid(OID.git_oid, SHA);
+		[prefixes addObject:[[NSString alloc] initWithBytes:SHA length:length encoding:NSASCIIStringEncoding]];
+	}
+
+	return prefixes;
+}
+
+@end
@@ -0,0 +1,94 @@
+//
+//  GTOIDMap.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "git2/oid.h"
+
+@class GTOID;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A map from object IDs to integers which stores raw git_oids inline.
+///
+/// Values are plain NSUIntegers, which is enough for counters, generation
+/// numbers or indexes into a caller-owned array, and keeps reads and writes
+/// free of object allocations.
+///
+/// This class is not thread safe.
+@interface GTOIDMap : NSObject <NSCopying>
+
+/// The number of object IDs in the map.
+@property (nonatomic, readonly, assign) NSUInteger count;
+
+/// Initializes an empty map. Equivalent to -initWithCapacity: with 0.
+- (instancetype)init;
+
+/// Initializes an empty map. Designated initializer.
+///
+/// capacity - The number of object IDs the map should be able to hold without
+///            growing.
+///
+/// Returns the initialized map.
+- (instancetype)initWithCapacity:(NSUInteger)capacity NS_DESIGNATED_INITIALIZER;
+
+/// Sets the value for the given object ID, replacing any existing value.
+///
+/// value - The value to store. Cannot be NSNotFound.
+/// oid   - The object ID to store the value for. Cannot be NULL.
+///
+/// Returns whether the value was stored, which will only be NO if the map
+/// couldn't grow to hold it.
+- (BOOL)setValue:(NSUInteger)value forGitOid:(const git_oid *)oid;
+
+/// Sets the value for the given object ID, replacing any existing value.
+///
+/// value - The value to store. Cannot be NSNotFound.
+/// OID   - The object ID to store the value for. Cannot be nil.
+///
+/// Returns whether the value was stored, which will only be NO if the map
+/// couldn't grow to hold it.
+- (BOOL)setValue:(NSUInteger)value forOID:(GTOID *)OID;
+
+/// Returns the value for the given object ID, or NSNotFound if the object ID
+/// isn't in the map.
+///
+/// oid - The object ID to look up. Cannot be NULL.
+- (NSUInteger)valueForGitOid:(const git_oid *)oid;
+
+/// Returns the value for the given object ID, or NSNotFound if the object ID
+/// isn't in the map.
+///
+/// OID - The object ID to look up. Cannot be nil.
+- (NSUInteger)valueForOID:(GTOID *)OID;
+
+/// Whether the given object ID is in the map.
+///
+/// oid - The object ID to test. Cannot be NULL.
+- (BOOL)containsGitOid:(const git_oid *)oid;
+
+/// Removes the given object ID and its value from the map.
+///
+/// oid - The object ID to remove. Cannot be NULL.
+///
+/// Returns whether the object ID was in the map.
+- (BOOL)removeGitOid:(const git_oid *)oid;
+
+/// Removes all the object IDs, but keeps the memory allocated for reuse.
+- (void)removeAllOIDs;
+
+/// Enumerates the object IDs and values in the map, in no particular order.
+///
+/// The map must not be mutated during enumeration.
+///
+/// block - The block to call for each entry. The git_oid is only valid for the
+///         duration of the call. Setting `stop` to YES will stop enumeration.
+///         Cannot be nil.
+- (void)enumerateGitOidsAndValuesUsingBlock:(void (^)(const git_oid *oid, NSUInteger value, BOOL *stop))block;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,122 @@
+//
+//  GTOIDMap.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTOIDMap.h"
+#import "GTOID.h"
+#import "GTOIDTable.h"
+
+@interface GTOIDMap () {
+	GTOIDTable _table;
+}
+
+@end
+
+@implementation GTOIDMap
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	return [self initWithCapacity:0];
+}
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity {
+	self = [super init];
+	if (self == nil) return nil;
+
+	if (!GTOIDTableInit(&_table, capacity, YES)) return nil;
+
+	return self;
+}
+
+- (void)dealloc {
+	GTOIDTableFree(&_table);
+}
+
+#pragma mark Properties
+
+- (NSUInteger)count {
+	return _table.count;
+}
+
+#pragma mark Mutation
+
+- (BOOL)setValue:(NSUInteger)value forGitOid:(const git_oid *)oid {
+	NSParameterAssert(oid != NULL);
+	NSParameterAssert(value != NSNotFound);
+
+	NSUInteger slot = GTOIDTableInsert(&_table, oid, NULL);
+	if (slot == NSNotFound) return NO;
+
+	_table.values[slot] = value;
+	return YES;
+}
+
+- (BOOL)setValue:(NSUInteger)value forOID:(GTOID *)OID {
+	NSParameterAssert(OID != nil);
+	return [self setValue:value forGitOid:OID.git_oid];
+}
+
+- (BOOL)removeGitOid:(const git_oid *)oid {
+	NSParameterAssert(oid != NULL);
+	return GTOIDTableRemove(&_table, oid);
+}
+
+- (void)removeAllOIDs {
+	GTOIDTableRemoveAll(&_table);
+}
+
+#pragma mark Querying
+
+- (NSUInteger)valueForGitOid:(const git_oid *)oid {
+	NSParameterAssert(oid != NULL);
+
+	NSUInteger slot = GTOIDTableFind(&_table, oid);
+	if (slot == NSNotFound) return NSNotFound;
+
+	return _table.values[slot];
+}
+
+- (NSUInteger)valueForOID:(GTOID *)OID {
+	NSParameterAssert(OID != nil);
+	return [self valueForGitOid:OID.git_oid];
+}
+
+- (BOOL)containsGitOid:(const git_oid *)oid {
+	NSParameterAssert(oid != NULL);
+	return GTOIDTableFind(&_table, oid) != NSNotFound;
+}
+
+- (void)enumerateGitOidsAndValuesUsingBlock:(void (^)(const git_oid *oid, NSUInteger value, BOOL *stop))block {
+	NSParameterAssert(block != nil);
+
+	BOOL stop = NO;
+	for (NSUInteger i = 0; i < _table.capacity && !stop; i++) {
+		if (!_table.occupied[i]) continue;
+		block(&_table.keys[i], _table.values[i], &stop);
+	}
+}
+
+#pragma mark NSCopying
+
+- (id)copyWithZone:(NSZone *)zone {
+	GTOIDMap *copy = [[self.class allocWithZone:zone] initWithCapacity:self.count];
+	__block BOOL copied = (copy != nil);
+	[self enumerateGitOidsAndValuesUsingBlock:^(const git_oid *oid, NSUInteger value, BOOL *stop) {
+		copied = [copy setValue:value forGitOid:oid];
+		*stop = !copied;
+	}];
+
+	return (copied ? copy : nil);
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> count: %lu", self.class, self, (unsigned long)self.count];
+}
+
+@end
@@ -0,0 +1,69 @@
+//
+//  GTOIDPool.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "git2/oid.h"
+
+@class GTOID;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// An interning table which hands out one canonical GTOID per object ID.
+///
+/// OIDs are kept in two generations. Lookups hit either generation, and hits in
+/// the older generation are promoted. Once the current generation holds
+/// `generationCapacity` OIDs, the older generation is dropped and the current
+/// one takes its place, so the pool never holds more than twice that many OIDs
+/// no matter how long it lives.
+///
+/// This class is thread safe.
+@interface GTOIDPool : NSObject
+
+/// The maximum number of OIDs held in each generation.
+@property (nonatomic, readonly, assign) NSUInteger generationCapacity;
+
+/// The number of OIDs currently held by the pool.
+@property (readonly, assign) NSUInteger count;
+
+/// The number of lookups which returned an already interned OID.
+@property (readonly, assign) NSUInteger hitCount;
+
+/// The number of lookups which had to create a new OID.
+@property (readonly, assign) NSUInteger missCount;
+
+/// The number of OIDs dropped from the pool by generation changes.
+@property (readonly, assign) NSUInteger evictionCount;
+
+/// Initializes the receiver with a generation capacity of 65536.
+- (instancetype)init;
+
+/// Initializes the receiver. Designated initializer.
+///
+/// generationCapacity - The maximum number of OIDs to hold in each generation.
+///                      Must be greater than 0.
+///
+/// Returns the initialized receiver.
+- (instancetype)initWithGenerationCapacity:(NSUInteger)generationCapacity NS_DESIGNATED_INITIALIZER;
+
+/// Returns the canonical OID for the given git_oid, creating it if needed.
+///
+/// oid - The object ID to intern. Cannot be NULL.
+- (GTOID *)OIDWithGitOid:(const git_oid *)oid;
+
+/// Starts a new generation, dropping every OID which hasn't been looked up
+/// since the previous call.
+- (void)advanceGeneration;
+
+/// Drops all the interned OIDs. Statistics are left untouched.
+- (void)removeAllOIDs;
+
+/// Resets the hit, miss and eviction counts to zero.
+- (void)resetStatistics;
+
+@end
+
+NS_ASSUME_NONNULL_END
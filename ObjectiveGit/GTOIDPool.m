@@ -0,0 +1,183 @@
+//
+//  GTOIDPool.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTOIDPool.h"
+#import "GTOID.h"
+#import "GTOIDTable.h"
+
+#import <pthread.h>
+
+static const NSUInteger GTOIDPoolDefaultGenerationCapacity = 65536;
+
+// The dictionaries are keyed by the git_oid stored inside each GTOID value,
+// which lets lookups probe with a bare git_oid pointer. The key lives exactly
+// as long as its value, so keys don't need to be retained.
+static CFHashCode GTOIDPoolKeyHash(const void *key) {
+	return (CFHashCode)GTOIDTableHash(key);
+}
+
+static Boolean GTOIDPoolKeyEqual(const void *first, const void *second) {
+	return git_oid_equal(first, second) != 0;
+}
+
+static const CFDictionaryKeyCallBacks GTOIDPoolKeyCallBacks = {
+	.version = 0,
+	.hash = GTOIDPoolKeyHash,
+	.equal = GTOIDPoolKeyEqual,
+};
+
+@interface GTOIDPool () {
+	pthread_mutex_t _lock;
+
+	CFMutableDictionaryRef _currentGeneration;
+	CFMutableDictionaryRef _previousGeneration;
+
+	NSUInteger _hitCount;
+	NSUInteger _missCount;
+	NSUInteger _evictionCount;
+}
+
+@end
+
+@implementation GTOIDPool
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	return [self initWithGenerationCapacity:GTOIDPoolDefaultGenerationCapacity];
+}
+
+- (instancetype)initWithGenerationCapacity:(NSUInteger)generationCapacity {
+	NSParameterAssert(generationCapacity > 0);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_generationCapacity = generationCapacity;
+	_currentGeneration = CFDictionaryCreateMutable(kCFAllocatorDefault, 0, &GTOIDPoolKeyCallBacks, &kCFTypeDictionaryValueCallBacks);
+	_previousGeneration = CFDictionaryCreateMutable(kCFAllocatorDefault, 0, &GTOIDPoolKeyCallBacks, &kCFTypeDictionaryValueCallBacks);
+	pthread_mutex_init(&_lock, NULL);
+
+	return self;
+}
+
+- (void)dealloc {
+	CFRelease(_currentGeneration);
+	CFRelease(_previousGeneration);
+	pthread_mutex_destroy(&_lock);
+}
+
+#pragma mark Properties
+
+- (NSUInteger)count {
+	pthread_mutex_lock(&_lock);
+	NSUInteger count = (NSUInteger)(CFDictionaryGetCount(_currentGeneration) + CFDictionaryGetCount(_previousGeneration));
+	pthread_mutex_unlock(&_lock);
+
+	return count;
+}
+
+- (NSUInteger)hitCount {
+	pthread_mutex_lock(&_lock);
+	NSUInteger count = _hitCount;
+	pthread_mutex_unlock(&_lock);
+
+	return count;
+}
+
+- (NSUInteger)missCount {
+	pthread_mutex_lock(&_lock);
+	NSUInteger count = _missCount;
+	pthread_mutex_unlock(&_lock);
+
+	return count;
+}
+
+- (NSUInteger)evictionCount {
+	pthread_mutex_lock(&_lock);
+	NSUInteger count = _evictionCount;
+	pthread_mutex_unlock(&_lock);
+
+	return count;
+}
+
+#pragma mark Interning
+
+// Must be called with the lock held.
+- (void)unlockedAdvanceGeneration {
+	_evictionCount += (NSUInteger)CFDictionaryGetCount(_previousGeneration);
+
+	CFMutableDictionaryRef dropped = _previousGeneration;
+	CFDictionaryRemoveAllValues(dropped);
+
+	_previousGeneration = _currentGeneration;
+	_currentGeneration = dropped;
+}
+
+// Must be called with the lock held.
+- (void)unlockedAddOID:(GTOID *)OID {
+	if ((NSUInteger)CFDictionaryGetCount(_currentGeneration) >= self.generationCapacity) {
+		[self unlockedAdvanceGeneration];
+	}
+
+	CFDictionarySetValue(_currentGeneration, OID.git_oid, (__bridge const void *)OID);
+}
+
+- (GTOID *)OIDWithGitOid:(const git_oid *)oid {
+	NSParameterAssert(oid != NULL);
+
+	pthread_mutex_lock(&_lock);
+
+	GTOID *OID = (__bridge GTOID *)CFDictionaryGetValue(_currentGeneration, oid);
+	if (OID != nil) {
+		_hitCount++;
+	} else {
+		OID = (__bridge GTOID *)CFDictionaryGetValue(_previousGeneration, oid);
+		if (OID != nil) {
+			_hitCount++;
+			CFDictionaryRemoveValue(_previousGeneration, OID.git_oid);
+		} else {
+			_missCount++;
+			OID = [[GTOID alloc] initWithGitOid:oid];
+		}
+
+		[self unlockedAddOID:OID];
+	}
+
+	pthread_mutex_unlock(&_lock);
+
+	return OID;
+}
+
+- (void)advanceGeneration {
+	pthread_mutex_lock(&_lock);
+	[self unlockedAdvanceGeneration];
+	pthread_mutex_unlock(&_lock);
+}
+
+- (void)removeAllOIDs {
+	pthread_mutex_lock(&_lock);
+	CFDictionaryRemoveAllValues(_currentGeneration);
+	CFDictionaryRemoveAllValues(_previousGeneration);
+	pthread_mutex_unlock(&_lock);
+}
+
+- (void)resetStatistics {
+	pthread_mutex_lock(&_lock);
+	_hitCount = 0;
+	_missCount = 0;
+	_evictionCount = 0;
+	pthread_mutex_unlock(&_lock);
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> count: %lu, hits: %lu, misses: %lu, evictions: %lu", self.class, self, (unsigned long)self.count, (unsigned long)self.hitCount, (unsigned long)self.missCount, (unsigned long)self.evictionCount];
+}
+
+@end
@@ -0,0 +1,115 @@
+//
+//  GTOIDSet.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "git2/oid.h"
+
+@class GTOID;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A set of object IDs which stores raw git_oids inline.
+///
+/// Unlike an NSSet of GTOIDs, adding and testing membership by git_oid never
+/// allocates objects, which makes it suitable for deduplicating millions of
+/// IDs during reachability walks.
+///
+/// This class is not thread safe.
+@interface GTOIDSet : NSObject <NSCopying>
+
+/// The number of object IDs in the set.
+@property (nonatomic, readonly, assign) NSUInteger count;
+
+/// Initializes an empty set. Equivalent to -initWithCapacity: with 0.
+- (instancetype)init;
+
+/// Initializes an empty set. Designated initializer.
+///
+/// capacity - The number of object IDs the set should be able to hold without
+///            growing.
+///
+/// Returns the initialized set.
+- (instancetype)initWithCapacity:(NSUInteger)capacity NS_DESIGNATED_INITIALIZER;
+
+/// Adds the given object ID to the set.
+///
+/// oid   - The object ID to add. Cannot be NULL.
+/// added - If not NULL, set to whether the object ID was added, which will be
+///         NO if it was already in the set.
+///
+/// Returns whether the object ID is in the set, which will only be NO if the
+/// set couldn't grow to hold it.
+- (BOOL)addGitOid:(const git_oid *)oid added:(BOOL * _Nullable)added;
+
+/// Adds the given object ID to the set.
+///
+/// oid - The object ID to add. Cannot be NULL.
+///
+/// Returns whether the object ID was added, which will be NO if it was already
+/// in the set, or if the set couldn't grow to hold it. Use
+/// -addGitOid:added: to tell these apart.
+- (BOOL)addGitOid:(const git_oid *)oid;
+
+/// Adds the given object ID to the set.
+///
+/// OID - The object ID to add. Cannot be nil.
+///
+/// Returns whether the object ID was added, which will be NO if it was already
+/// in the set, or if the set couldn't grow to hold it. Use
+/// -addGitOid:added: to tell these apart.
+- (BOOL)addOID:(GTOID *)OID;
+
+/// Adds all the object IDs of another set to the receiver.
+///
+/// set - The set to merge into the receiver. Cannot be nil.
+///
+/// Returns whether every object ID was added, which will only be NO if the
+/// receiver couldn't grow to hold them.
+- (BOOL)unionSet:(GTOIDSet *)set;
+
+/// Removes the given object ID from the set.
+///
+/// oid - The object ID to remove. Cannot be NULL.
+///
+/// Returns whether the object ID was in the set.
+- (BOOL)removeGitOid:(const git_oid *)oid;
+
+/// Removes the given object ID from the set.
+///
+/// OID - The object ID to remove. Cannot be nil.
+///
+/// Returns whether the object ID was in the set.
+- (BOOL)removeOID:(GTOID *)OID;
+
+/// Removes all the object IDs, but keeps the memory allocated for reuse.
+- (void)removeAllOIDs;
+
+/// Whether the given object ID is in the set.
+///
+/// oid - The object ID to test. Cannot be NULL.
+- (BOOL)containsGitOid:(const git_oid *)oid;
+
+/// Whether the given object ID is in the set.
+///
+/// OID - The object ID to test. Cannot be nil.
+- (BOOL)containsOID:(GTOID *)OID;
+
+/// Enumerates the object IDs in the set, in no particular order.
+///
+/// The set must not be mutated during enumeration.
+///
+/// block - The block to call for each object ID. The git_oid is only valid
+///         for the duration of the call. Setting `stop` to YES will stop
+///         enumeration. Cannot be nil.
+- (void)enumerateGitOidsUsingBlock:(void (^)(const git_oid *oid, BOOL *stop))block;
+
+/// Returns all the object IDs in the set as GTOIDs, in no particular order.
+- (NSArray<GTOID *> *)allOIDs;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,138 @@
+//
+//  GTOIDSet.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTOIDSet.h"
+#import "GTOID.h"
+#import "GTOIDTable.h"
+
+@interface GTOIDSet () {
+	GTOIDTable _table;
+}
+
+@end
+
+@implementation GTOIDSet
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	return [self initWithCapacity:0];
+}
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity {
+	self = [super init];
+	if (self == nil) return nil;
+
+	if (!GTOIDTableInit(&_table, capacity, NO)) return nil;
+
+	return self;
+}
+
+- (void)dealloc {
+	GTOIDTableFree(&_table);
+}
+
+#pragma mark Properties
+
+- (NSUInteger)count {
+	return _table.count;
+}
+
+#pragma mark Mutation
+
+- (BOOL)addGitOid:(const git_oid *)oid added:(BOOL *)added {
+	NSParameterAssert(oid != NULL);
+
+	BOOL inserted = NO;
+	NSUInteger slot = GTOIDTableInsert(&_table, oid, &inserted);
+	if (slot == NSNotFound) return NO;
+
+	if (added != NULL) *added = inserted;
+	return YES;
+}
+
+- (BOOL)addGitOid:(const git_oid *)oid {
+	BOOL added = NO;
+	return [self addGitOid:oid added:&added] && added;
+}
+
+- (BOOL)addOID:(GTOID *)OID {
+	NSParameterAssert(OID != nil);
+	return [self addGitOid:OID.git_oid];
+}
+
+- (BOOL)unionSet:(GTOIDSet *)set {
+	NSParameterAssert(set != nil);
+
+	__block BOOL success = YES;
+	[set enumerateGitOidsUsingBlock:^(const git_oid *oid, BOOL *stop) {
+		success = [self addGitOid:oid added:NULL];
+		*stop = !success;
+	}];
+
+	return success;
+}
+
+- (BOOL)removeGitOid:(const git_oid *)oid {
+	NSParameterAssert(oid != NULL);
+	return GTOIDTableRemove(&_table, oid);
+}
+
+- (BOOL)removeOID:(GTOID *)OID {
+	NSParameterAssert(OID != nil);
+	return [self removeGitOid:OID.git_oid];
+}
+
+- (void)removeAllOIDs {
+	GTOIDTableRemoveAll(&_table);
+}
+
+#pragma mark Querying
+
+- (BOOL)containsGitOid:(const git_oid *)oid {
+	NSParameterAssert(oid != NULL);
+	return GTOIDTableFind(&_table, oid) != NSNotFound;
+}
+
+- (BOOL)containsOID:(GTOID *)OID {
+	NSParameterAssert(OID != nil);
+	return [self containsGitOid:OID.git_oid];
+}
+
+- (void)enumerateGitOidsUsingBlock:(void (^)(const git_oid *oid, BOOL *stop))block {
+	NSParameterAssert(block != nil);
+
+	BOOL stop = NO;
+	for (NSUInteger i = 0; i < _table.capacity && !stop; i++) {
+		if (!_table.occupied[i]) continue;
+		block(&_table.keys[i], &stop);
+	}
+}
+
+- (NSArray *)allOIDs {
+	NSMutableArray *OIDs = [NSMutableArray arrayWithCapacity:self.count];
+	[self enumerateGitOidsUsingBlock:^(const git_oid *oid, BOOL *stop) {
+		[OIDs addObject:[GTOID oidWithGitOid:oid]];
+	}];
+
+	return OIDs;
+}
+
+#pragma mark NSCopying
+
+- (id)copyWithZone:(NSZone *)zone {
+	GTOIDSet *copy = [[self.class allocWithZone:zone] initWithCapacity:self.count];
+	return ([copy unionSet:self] ? copy : nil);
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> count: %lu", self.class, self, (unsigned long)self.count];
+}
+
+@end
@@ -0,0 +1,63 @@
+//
+//  GTOIDTable.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "git2/oid.h"
+
+// An open addressing hash table keyed by raw git_oids, shared by GTOIDSet and
+// GTOIDMap. Keys are stored inline and collisions are resolved with linear
+// probing, so lookups and insertions never allocate ObjC objects.
+//
+// keys     - The key slots. Has `capacity` elements.
+// values   - The value slots, or NULL if the table only stores keys.
+// occupied - Whether each slot holds a key. Has `capacity` elements.
+// capacity - The number of slots. Always a power of two.
+// count    - The number of keys currently stored.
+typedef struct {
+	git_oid *keys;
+	NSUInteger *values;
+	uint8_t *occupied;
+	NSUInteger capacity;
+	NSUInteger count;
+} GTOIDTable;
+
+// Sets up `table` to hold at least `capacity` keys without growing.
+//
+// Returns whether the slots could be allocated.
+BOOL GTOIDTableInit(GTOIDTable *table, NSUInteger capacity, BOOL storesValues);
+
+// Frees the slots owned by `table`.
+void GTOIDTableFree(GTOIDTable *table);
+
+// Removes every key from `table` while keeping its capacity.
+void GTOIDTableRemoveAll(GTOIDTable *table);
+
+// Finds the slot holding `oid`.
+//
+// Returns the slot index, or NSNotFound if `oid` is not in the table.
+NSUInteger GTOIDTableFind(const GTOIDTable *table, const git_oid *oid);
+
+// Finds or creates the slot for `oid`, growing the table if needed.
+//
+// inserted - If not NULL, set to whether a new slot was created.
+//
+// Returns the slot index, or NSNotFound if the table could not grow.
+NSUInteger GTOIDTableInsert(GTOIDTable *table, const git_oid *oid, BOOL *inserted);
+
+// Removes `oid` from `table`.
+//
+// Returns whether `oid` was in the table.
+BOOL GTOIDTableRemove(GTOIDTable *table, const git_oid *oid);
+
+// The hash used for the table, which is simply the first bytes of the OID.
+// Object IDs are already uniformly distributed, so there is nothing to gain
+// by mixing them further.
+static inline NSUInteger GTOIDTableHash(const git_oid *oid) {
+	NSUInteger hash;
+	memcpy(&hash, oid->id, sizeof(hash));
+	return hash;
+}
@@ -0,0 +1,153 @@
+//
+//  GTOIDTable.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTOIDTable.h"
+
+// Grow once the table is more than 70% full.
+static const NSUInteger GTOIDTableMaxLoadNumerator = 7;
+static const NSUInteger GTOIDTableMaxLoadDenominator = 10;
+
+static const NSUInteger GTOIDTableMinimumCapacity = 16;
+
+static NSUInteger GTOIDTableCapacityForCount(NSUInteger count) {
+	NSUInteger capacity = GTOIDTableMinimumCapacity;
+	while (capacity * GTOIDTableMaxLoadNumerator / GTOIDTableMaxLoadDenominator < count) {
+		capacity <<= 1;
+	}
+	return capacity;
+}
+
+BOOL GTOIDTableInit(GTOIDTable *table, NSUInteger capacity, BOOL storesValues) {
+	NSCParameterAssert(table != NULL);
+
+	capacity = GTOIDTableCapacityForCount(capacity);
+
+	table->keys = malloc(capacity * sizeof(git_oid));
+	table->occupied = calloc(capacity, sizeof(uint8_t));
+	table->values = (storesValues ? calloc(capacity, sizeof(NSUInteger)) : NULL);
+	table->capacity = capacity;
+	table->count = 0;
+
+	if (table->keys == NULL || table->occupied == NULL || (storesValues && table->values == NULL)) {
+		GTOIDTableFree(table);
+		return NO;
+	}
+
+	return YES;
+}
+
+void GTOIDTableFree(GTOIDTable *table) {
+	free(table->keys);
+	free(table->values);
+	free(table->occupied);
+
+	table->keys = NULL;
+	table->values = NULL;
+	table->occupied = NULL;
+	table->capacity = 0;
+	table->count = 0;
+}
+
+void GTOIDTableRemoveAll(GTOIDTable *table) {
+	if (table->occupied != NULL) memset(table->occupied, 0, table->capacity * sizeof(uint8_t));
+	table->count = 0;
+}
+
+// Returns the slot holding `oid`, or the empty slot where it would be inserted.
+static NSUInteger GTOIDTableProbe(const GTOIDTable *table, const git_oid *oid) {
+	NSUInteger mask = table->capacity - 1;
+	NSUInteger slot = GTOIDTableHash(oid) & mask;
+
+	while (table->occupied[slot] && git_oid_cmp(&table->keys[slot], oid) != 0) {
+		slot = (slot + 1) & mask;
+	}
+
+	return slot;
+}
+
+NSUInteger GTOIDTableFind(const GTOIDTable *table, const git_oid *oid) {
+	NSCParameterAssert(oid != NULL);
+
+	if (table->count == 0) return NSNotFound;
+
+	NSUInteger slot = GTOIDTableProbe(table, oid);
+	return (table->occupied[slot] ? slot : NSNotFound);
+}
+
+static BOOL GTOIDTableGrow(GTOIDTable *table) {
+	GTOIDTable grown;
+	if (!GTOIDTableInit(&grown, table->capacity, table->values != NULL)) return NO;
+
+	for (NSUInteger i = 0; i < table->capacity; i++) {
+		if (!table->occupied[i]) continue;
+
+		NSUInteger slot = GTOIDTableProbe(&grown, &table->keys[i]);
+		git_oid_cpy(&grown.keys[slot], &table->keys[i]);
+		if (grown.values != NULL) grown.values[slot] = table->values[i];
+		grown.occupied[slot] = 1;
+		grown.count++;
+	}
+
+	GTOIDTableFree(table);
+	*table = grown;
+
+	return YES;
+}
+
+NSUInteger GTOIDTableInsert(GTOIDTable *table, const git_oid *oid, BOOL *inserted) {
+	NSCParameterAssert(oid != NULL);
+
+	NSUInteger slot = GTOIDTableProbe(table, oid);
+	if (table->occupied[slot]) {
+		if (inserted != NULL) *inserted = NO;
+		return slot;
+	}
+
+	if ((table->count + 1) * GTOIDTableMaxLoadDenominator > table->capacity * GTOIDTableMaxLoadNumerator) {
+		if (!GTOIDTableGrow(table)) {
+			if (inserted != NULL) *inserted = NO;
+			return NSNotFound;
+		}
+
+		slot = GTOIDTableProbe(table, oid);
+	}
+
+	git_oid_cpy(&table->keys[slot], oid);
+	if (table->values != NULL) table->values[slot] = 0;
+	table->occupied[slot] = 1;
+	table->count++;
+
+	if (inserted != NULL) *inserted = YES;
+	return slot;
+}
+
+BOOL GTOIDTableRemove(GTOIDTable *table, const git_oid *oid) {
+	NSUInteger slot = GTOIDTableFind(table, oid);
+	if (slot == NSNotFound) return NO;
+
+	// Shift the following entries of the probe sequence back, so lookups never
+	// stop early at the hole we're leaving behind.
+	NSUInteger mask = table->capacity - 1;
+	NSUInteger hole = slot;
+	NSUInteger next = (hole + 1) & mask;
+	while (table->occupied[next]) {
+		NSUInteger home = GTOIDTableHash(&table->keys[next]) & mask;
+		BOOL canMove = (hole <= next ? (home <= hole || home > next) : (home <= hole && home > next));
+		if (canMove) {
+			git_oid_cpy(&table->keys[hole], &table->keys[next]);
+			if (table->values != NULL) table->values[hole] = table->values[next];
+			hole = next;
+		}
+
+		next = (next + 1) & mask;
+	}
+
+	table->occupied[hole] = 0;
+	table->count--;
+
+	return YES;
+}
@@ -0,0 +1,29 @@
+//
+//  GTObject+Private.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTObject.h"
+#import "git2/oid.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface GTObject ()
+
+/// Initializes an object which only looks up its `git_object` once that's
+/// first needed. Subclasses use this to answer what they can from the raw
+/// object instead.
+///
+/// oid        - The ID of the object. Cannot be NULL.
+/// type       - The type of the object.
+/// repository - The repository containing the object. Cannot be nil.
+- (instancetype)initWithGitOid:(const git_oid *)oid objectType:(GTObjectType)type inRepository:(GTRepository *)repository NS_DESIGNATED_INITIALIZER;
+
+/// The ID of the object, without looking it up.
+- (const git_oid *)git_oid __attribute__((objc_returns_inner_pointer));
+
+@end
+
+NS_ASSUME_NONNULL_END
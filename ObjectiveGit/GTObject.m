@@ -28,10 +28,12 @@
 //
 
 #import "GTObject.h"
+#import "GTObject+Private.h"
 #import "GTCommit.h"
 #import "GTObjectDatabase.h"
 #import "NSError+Git.h"
 #import "GTRepository.h"
+#import "GTRepository+Private.h"
 #import "NSString+Git.h"
 #import "GTTree.h"
 #import "GTBlob.h"
@@ -40,12 +42,21 @@
 
 #import "git2/errors.h"
 
-@interface GTObject ()
+@interface GTObject () {
+	// Set for objects initialized with -initWithGitOid:objectType:inRepository:,
+	// whose `git_object` is looked up on first use.
+	BOOL _lazy;
+	git_oid _lazyOid;
+	GTObjectType _lazyType;
+}
+
 @property (nonatomic, readonly, assign) git_object *git_object;
 @end
 
 @implementation GTObject
 
+@synthesize git_object = _git_object;
+
 - (NSString *)description {
   return [NSString stringWithFormat:@"<%@: %p> type: %@, shortSha: %@, sha: %@", NSStringFromClass([self class]), self, self.type, self.shortSHA, self.SHA];
 }
@@ -64,7 +75,7 @@
 - (BOOL)isEqual:(id)otherObject {
 	if(![otherObject isKindOfClass:[GTObject class]]) return NO;
 	
-	return 0 == git_oid_cmp(git_object_id(self.git_object), git_object_id(((GTObject *)otherObject).git_object)) ? YES : NO;
+	return 0 == git_oid_cmp(self.git_oid, ((GTObject *)otherObject).git_oid) ? YES : NO;
 }
 
 
@@ -122,14 +133,49 @@
 	return [[self alloc] initWithObj:theObject inRepository:theRepo];
 }
 
+- (instancetype)initWithGitOid:(const git_oid *)oid objectType:(GTObjectType)type inRepository:(GTRepository *)repository {
+	NSParameterAssert(oid != NULL);
+	NSParameterAssert(repository != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_repository = repository;
+	_lazy = YES;
+	git_oid_cpy(&_lazyOid, oid);
+	_lazyType = type;
+
+	return self;
+}
+
+- (git_object *)git_object {
+	if (!_lazy) return _git_object;
+
+	@synchronized (self) {
+		if (_git_object == NULL) {
+			int gitError = git_object_lookup(&_git_object, self.repository.git_repository, &_lazyOid, (git_object_t)_lazyType);
+			if (gitError != GIT_OK) {
+				NSLog(@"Failed to look up object %@ with error code: %d", self.SHA, gitError);
+			}
+		}
+
+		return _git_object;
+	}
+}
+
+- (const git_oid *)git_oid {
+	return (_lazy ? &_lazyOid : git_object_id(_git_object));
+}
+
 - (NSString *)type {
-	NSString *type = [NSString stringWithUTF8String:git_object_type2string(git_object_type(self.git_object))];
+	git_object_t objectType = (_lazy ? (git_object_t)_lazyType : git_object_type(self.git_object));
+	NSString *type = [NSString stringWithUTF8String:git_object_type2string(objectType)];
 	NSAssert(type != nil, @"type was nil");
 	return type;
 }
 
 - (GTOID *)OID {
-	return [GTOID oidWithGitOid:git_object_id(self.git_object)];
+	return [self.repository OIDWithGitOid:self.git_oid];
 }
 
 - (NSString *)SHA {
@@ -0,0 +1,34 @@
+//
+//  GTObjectCache+Private.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTObjectCache.h"
+#import "git2/types.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface GTObjectCache ()
+
+/// Looks up a cached object, and marks it as the most recently used.
+///
+/// oid        - The ID of the object. Cannot be NULL.
+/// type       - The type the object must have, or GIT_OBJECT_ANY.
+/// repository - The repository the object must belong to. Cannot be NULL.
+///
+/// Returns a new reference to the object, which the caller must free, or NULL
+/// if no such object is cached.
+- (git_object * _Nullable)lookUpGitObjectWithOid:(const git_oid *)oid type:(git_object_t)type inRepository:(git_repository *)repository;
+
+/// Caches an object, evicting the least recently used objects if that takes
+/// the cache over its limit.
+///
+/// object - The object to cache. The cache takes its own reference, so the
+///          caller keeps ownership. Cannot be NULL.
+- (void)addGitObject:(git_object *)object;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,70 @@
+//
+//  GTObjectCache.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The byte limit used by -init.
+extern const NSUInteger GTObjectCacheDefaultByteLimit;
+
+/// A bounded cache of the objects looked up through a repository.
+///
+/// Assign one to a GTRepository's `objectCache` to keep recently looked up
+/// commits, trees, blobs and tags parsed in memory. Repeated lookups of the
+/// same object then skip the object database and parsing, and only allocate a
+/// new wrapper. This matters most for big trees and blobs, which libgit2's own
+/// cache doesn't keep.
+///
+/// The cache keeps the parsed libgit2 objects rather than their GTObject
+/// wrappers, because wrappers retain their repository and the repository
+/// retains its cache.
+///
+/// Each object is charged an estimate of its memory use, based on its type and
+/// contents. When the total goes over `byteLimit`, the least recently used
+/// objects are evicted. The cache also shrinks itself when the system is low
+/// on memory.
+///
+/// A cache should only be used by a single repository.
+///
+/// This class is thread safe.
+@interface GTObjectCache : NSObject
+
+/// The most bytes the cached objects may be estimated to use.
+@property (nonatomic, readonly, assign) NSUInteger byteLimit;
+
+/// The number of objects currently cached.
+@property (readonly, assign) NSUInteger count;
+
+/// The estimated number of bytes used by the cached objects.
+@property (readonly, assign) NSUInteger byteCount;
+
+/// The number of lookups answered from the cache.
+@property (readonly, assign) NSUInteger hitCount;
+
+/// The number of lookups which had to go to the object database.
+@property (readonly, assign) NSUInteger missCount;
+
+/// The number of objects evicted to stay within `byteLimit`, or because the
+/// system was low on memory.
+@property (readonly, assign) NSUInteger evictionCount;
+
+/// Initializes a cache with a limit of GTObjectCacheDefaultByteLimit.
+- (instancetype)init;
+
+/// Initializes a cache. Designated initializer.
+///
+/// byteLimit - The most bytes the cached objects may be estimated to use.
+///             Objects which are bigger than this on their own aren't cached.
+- (instancetype)initWithByteLimit:(NSUInteger)byteLimit NS_DESIGNATED_INITIALIZER;
+
+/// Evicts every object, without counting them in `evictionCount`.
+- (void)removeAllObjects;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,307 @@
+//
+//  GTObjectCache.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTObjectCache+Private.h"
+#import "GTOIDTable.h"
+
+#import "git2/blob.h"
+#import "git2/commit.h"
+#import "git2/object.h"
+#import "git2/tag.h"
+#import "git2/tree.h"
+
+#import <pthread.h>
+
+const NSUInteger GTObjectCacheDefaultByteLimit = 32 * 1024 * 1024;
+
+// What every object is charged on top of its contents, for the libgit2 object,
+// its cache entry and the wrapper handed out for it.
+static const NSUInteger GTObjectCacheObjectOverhead = 256;
+
+// What every tree entry is charged, for the git_tree_entry and its filename.
+static const NSUInteger GTObjectCacheTreeEntrySize = 64;
+
+// A cached object, linked into the list of objects from most to least recently
+// used. Links are indices into the entries array, or NSNotFound. Free entries
+// are linked through `next`.
+typedef struct {
+	git_object *object;
+	NSUInteger byteSize;
+	NSUInteger previous;
+	NSUInteger next;
+} GTObjectCacheEntry;
+
+// Estimates the memory used by a parsed object.
+static NSUInteger GTObjectCacheEstimatedByteSize(git_object *object) {
+	NSUInteger size = GTObjectCacheObjectOverhead;
+
+	switch (git_object_type(object)) {
+		case GIT_OBJECT_COMMIT: {
+			const git_commit *commit = (const git_commit *)object;
+			const char *header = git_commit_raw_header(commit);
+			const char *message = git_commit_message_raw(commit);
+			if (header != NULL) size += strlen(header);
+			if (message != NULL) size += strlen(message);
+			size += git_commit_parentcount(commit) * sizeof(git_oid);
+			break;
+		}
+		case GIT_OBJECT_TREE:
+			size += git_tree_entrycount((const git_tree *)object) * GTObjectCacheTreeEntrySize;
+			break;
+		case GIT_OBJECT_BLOB:
+			size += (NSUInteger)git_blob_rawsize((const git_blob *)object);
+			break;
+		case GIT_OBJECT_TAG: {
+			const char *message = git_tag_message((const git_tag *)object);
+			if (message != NULL) size += strlen(message);
+			break;
+		}
+		default:
+			break;
+	}
+
+	return size;
+}
+
+@interface GTObjectCache () {
+	pthread_mutex_t _lock;
+
+	// Maps object IDs to indices into `_entries`.
+	GTOIDTable _table;
+
+	GTObjectCacheEntry *_entries;
+	NSUInteger _entriesCapacity;
+	NSUInteger _freeEntry;
+
+	// The most and least recently used entries.
+	NSUInteger _head;
+	NSUInteger _tail;
+
+	dispatch_source_t _memoryPressureSource;
+}
+
+@property (readwrite, assign) NSUInteger count;
+@property (readwrite, assign) NSUInteger byteCount;
+@property (readwrite, assign) NSUInteger hitCount;
+@property (readwrite, assign) NSUInteger missCount;
+@property (readwrite, assign) NSUInteger evictionCount;
+
+@end
+
+@implementation GTObjectCache
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	return [self initWithByteLimit:GTObjectCacheDefaultByteLimit];
+}
+
+- (instancetype)initWithByteLimit:(NSUInteger)byteLimit {
+	self = [super init];
+	if (self == nil) return nil;
+
+	if (!GTOIDTableInit(&_table, 0, YES)) return nil;
+
+	_byteLimit = byteLimit;
+	_freeEntry = NSNotFound;
+	_head = NSNotFound;
+	_tail = NSNotFound;
+	pthread_mutex_init(&_lock, NULL);
+
+	__weak GTObjectCache *weakSelf = self;
+	_memoryPressureSource = dispatch_source_create(DISPATCH_SOURCE_TYPE_MEMORYPRESSURE, 0, DISPATCH_MEMORYPRESSURE_WARN | DISPATCH_MEMORYPRESSURE_CRITICAL, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0));
+	dispatch_source_t source = _memoryPressureSource;
+	dispatch_source_set_event_handler(_memoryPressureSource, ^{
+		GTObjectCache *strongSelf = weakSelf;
+		if (strongSelf == nil) return;
+
+		// Give up half the cache when memory gets tight, and all of it when
+		// the system is about to start killing processes.
+		BOOL critical = (dispatch_source_get_data(source) & DISPATCH_MEMORYPRESSURE_CRITICAL) != 0;
+		[strongSelf evictToByteCount:(critical ? 0 : strongSelf.byteLimit / 2)];
+	});
+	dispatch_resume(_memoryPressureSource);
+
+	return self;
+}
+
+- (void)dealloc {
+	dispatch_source_cancel(_memoryPressureSource);
+
+	[self lockedRemoveAllObjects];
+	free(_entries);
+	GTOIDTableFree(&_table);
+	pthread_mutex_destroy(&_lock);
+}
+
+#pragma mark Entries
+
+// Unlinks the entry from the recently used list. Must be called with `_lock`
+// held.
+- (void)lockedUnlinkEntry:(NSUInteger)index {
+	GTObjectCacheEntry *entry = &_entries[index];
+	if (entry->previous != NSNotFound) {
+		_entries[entry->previous].next = entry->next;
+	} else {
+		_head = entry->next;
+	}
+
+	if (entry->next != NSNotFound) {
+		_entries[entry->next].previous = entry->previous;
+	} else {
+		_tail = entry->previous;
+	}
+}
+
+// Links the entry in as the most recently used. Must be called with `_lock`
+// held.
+- (void)lockedLinkEntryAtHead:(NSUInteger)index {
+	GTObjectCacheEntry *entry = &_entries[index];
+	entry->previous = NSNotFound;
+	entry->next = _head;
+
+	if (_head != NSNotFound) _entries[_head].previous = index;
+	_head = index;
+	if (_tail == NSNotFound) _tail = index;
+}
+
+// Returns a free entry, growing the entries array if needed, or NSNotFound if
+// it couldn't grow. Must be called with `_lock` held.
+- (NSUInteger)lockedAllocateEntry {
+	if (_freeEntry == NSNotFound) {
+		NSUInteger capacity = MAX(_entriesCapacity * 2, (NSUInteger)64);
+		GTObjectCacheEntry *entries = realloc(_entries, capacity * sizeof(*entries));
+		if (entries == NULL) return NSNotFound;
+
+		for (NSUInteger index = _entriesCapacity; index < capacity; index++) {
+			entries[index].object = NULL;
+			entries[index].next = (index + 1 < capacity ? index + 1 : NSNotFound);
+		}
+
+		_freeEntry = _entriesCapacity;
+		_entries = entries;
+		_entriesCapacity = capacity;
+	}
+
+	NSUInteger index = _freeEntry;
+	_freeEntry = _entries[index].next;
+	return index;
+}
+
+// Drops the entry and its object. Must be called with `_lock` held.
+- (void)lockedRemoveEntry:(NSUInteger)index {
+	GTObjectCacheEntry *entry = &_entries[index];
+	[self lockedUnlinkEntry:index];
+	GTOIDTableRemove(&_table, git_object_id(entry->object));
+
+	self.count--;
+	self.byteCount -= entry->byteSize;
+
+	git_object_free(entry->object);
+	entry->object = NULL;
+	entry->next = _freeEntry;
+	_freeEntry = index;
+}
+
+// Evicts the least recently used objects until the cache is within
+// `byteCount`. Must be called with `_lock` held.
+- (void)lockedEvictToByteCount:(NSUInteger)byteCount {
+	while (self.byteCount > byteCount && _tail != NSNotFound) {
+		[self lockedRemoveEntry:_tail];
+		self.evictionCount++;
+	}
+}
+
+// Must be called with `_lock` held.
+- (void)lockedRemoveAllObjects {
+	while (_tail != NSNotFound) [self lockedRemoveEntry:_tail];
+}
+
+#pragma mark Caching
+
+- (git_object *)lookUpGitObjectWithOid:(const git_oid *)oid type:(git_object_t)type inRepository:(git_repository *)repository {
+	NSParameterAssert(oid != NULL);
+	NSParameterAssert(repository != NULL);
+
+	git_object *object = NULL;
+
+	pthread_mutex_lock(&_lock);
+	NSUInteger slot = GTOIDTableFind(&_table, oid);
+	if (slot != NSNotFound) {
+		NSUInteger index = _table.values[slot];
+		git_object *cachedObject = _entries[index].object;
+		BOOL matches = (type == GIT_OBJECT_ANY || git_object_type(cachedObject) == type) && git_object_owner(cachedObject) == repository;
+		if (matches && git_object_dup(&object, cachedObject) == GIT_OK) {
+			[self lockedUnlinkEntry:index];
+			[self lockedLinkEntryAtHead:index];
+		} else {
+			object = NULL;
+		}
+	}
+
+	if (object != NULL) {
+		self.hitCount++;
+	} else {
+		self.missCount++;
+	}
+	pthread_mutex_unlock(&_lock);
+
+	return object;
+}
+
+- (void)addGitObject:(git_object *)object {
+	NSParameterAssert(object != NULL);
+
+	NSUInteger byteSize = GTObjectCacheEstimatedByteSize(object);
+	if (byteSize > self.byteLimit) return;
+
+	git_object *cachedObject = NULL;
+	if (git_object_dup(&cachedObject, object) != GIT_OK) return;
+
+	pthread_mutex_lock(&_lock);
+	BOOL inserted = NO;
+	NSUInteger slot = GTOIDTableInsert(&_table, git_object_id(object), &inserted);
+	NSUInteger index = (inserted ? [self lockedAllocateEntry] : NSNotFound);
+	if (index == NSNotFound) {
+		// Either another thread cached the object first, or we're out of
+		// memory. Caching is only an optimization, so give up either way.
+		if (inserted) GTOIDTableRemove(&_table, git_object_id(object));
+		pthread_mutex_unlock(&_lock);
+		git_object_free(cachedObject);
+		return;
+	}
+
+	_table.values[slot] = index;
+	_entries[index].object = cachedObject;
+	_entries[index].byteSize = byteSize;
+	[self lockedLinkEntryAtHead:index];
+
+	self.count++;
+	self.byteCount += byteSize;
+	[self lockedEvictToByteCount:self.byteLimit];
+	pthread_mutex_unlock(&_lock);
+}
+
+- (void)evictToByteCount:(NSUInteger)byteCount {
+	pthread_mutex_lock(&_lock);
+	[self lockedEvictToByteCount:byteCount];
+	pthread_mutex_unlock(&_lock);
+}
+
+- (void)removeAllObjects {
+	pthread_mutex_lock(&_lock);
+	[self lockedRemoveAllObjects];
+	pthread_mutex_unlock(&_lock);
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> count: %lu, byteCount: %lu, byteLimit: %lu, hits: %lu, misses: %lu, evictions: %lu", self.class, self, (unsigned long)self.count, (unsigned long)self.byteCount, (unsigned long)self.byteLimit, (unsigned long)self.hitCount, (unsigned long)self.missCount, (unsigned long)self.evictionCount];
+}
+
+@end
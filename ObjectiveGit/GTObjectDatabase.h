@@ -26,6 +26,7 @@
 #import "GTObject.h"
 
 @class GTOID;
+@class GTOIDAbbreviationIndex;
 
 NS_ASSUME_NONNULL_BEGIN
 
@@ -69,6 +70,17 @@ NS_ASSUME_NONNULL_BEGIN
 /// Returns YES if the object exists or NO otherwise.
 - (BOOL)containsObjectWithOID:(GTOID *)oid;
 
+/// Builds an index of every object in the database, for finding the shortest
+/// unambiguous abbreviations of many OIDs at once.
+///
+/// Building the index reads every pack index, so callers should hold on to it
+/// and call -refresh: when the database may have changed.
+///
+/// error - The error if one occurred.
+///
+/// Returns the index, or nil if an error occurred.
+- (GTOIDAbbreviationIndex * _Nullable)abbreviationIndexWithError:(NSError **)error;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -30,6 +30,7 @@
 #import "GTOID.h"
 #import "NSString+Git.h"
 #import "GTOID.h"
+#import "GTOIDAbbreviationIndex.h"
 #import "EXTScope.h"
 
 #import "git2/errors.h"
@@ -139,4 +140,8 @@
 	return git_odb_exists(self.git_odb, oid.git_oid) ? YES : NO;
 }
 
+- (GTOIDAbbreviationIndex *)abbreviationIndexWithError:(NSError **)error {
+	return [[GTOIDAbbreviationIndex alloc] initWithObjectDatabase:self error:error];
+}
+
 @end
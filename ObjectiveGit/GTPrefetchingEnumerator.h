@@ -0,0 +1,90 @@
+//
+//  GTPrefetchingEnumerator.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+#import "GTEnumerator.h"
+
+@class GTCommit;
+@class GTRepository;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// The default number of commits a GTPrefetchingEnumerator reads ahead.
+extern const NSUInteger GTPrefetchingEnumeratorDefaultBufferSize;
+
+/// Enumerates commits like GTEnumerator, but walks the history and looks up
+/// each commit on a background thread, so that reading and inflating commits
+/// overlaps with the caller's processing of earlier ones.
+///
+/// The background thread uses its own handle on the repository, and stays at
+/// most `bufferSize` commits ahead of the caller. Commits are delivered in the
+/// same order a GTEnumerator with the same configuration would return them.
+///
+/// The background thread only reads raw commits. They're wrapped in
+/// `repository` on the calling thread, and parsed lazily, so the returned
+/// commits can be used like any other commit in `repository`.
+///
+/// This class is not thread safe; it should be consumed from one thread at a
+/// time.
+@interface GTPrefetchingEnumerator : NSEnumerator
+
+/// The repository being enumerated.
+@property (nonatomic, strong, readonly) GTRepository *repository;
+
+/// The most commits which will be read ahead of the caller.
+@property (nonatomic, assign, readonly) NSUInteger bufferSize;
+
+/// Whether -cancel has been called.
+@property (nonatomic, assign, readonly, getter = isCancelled) BOOL cancelled;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Starts enumerating commits in the background. Designated initializer.
+///
+/// repo           - The repository to enumerate the commits of. Cannot be nil.
+/// options        - The sorting options to walk with.
+/// bufferSize     - The most commits to read ahead of the caller. Must be
+///                  greater than zero.
+/// configureBlock - Called once, before this method returns, to push and hide
+///                  commits on the walk. The enumerator passed to it belongs to
+///                  the background thread's repository handle and must not be
+///                  used after the block returns. Return NO and set `error` to
+///                  fail initialization. Cannot be nil.
+/// error          - If not NULL, set to any error that occurs.
+///
+/// Returns an initialized enumerator, or nil if an error occurs.
+- (instancetype _Nullable)initWithRepository:(GTRepository *)repo options:(GTEnumeratorOptions)options bufferSize:(NSUInteger)bufferSize configureBlock:(BOOL (^)(GTEnumerator *enumerator, NSError **error))configureBlock error:(NSError **)error NS_DESIGNATED_INITIALIZER;
+
+/// Gets the next commit, waiting for the background thread if it hasn't read
+/// it yet.
+///
+/// success - If not NULL, this will be set to whether getting the next object
+///           was successful. This will be YES if the receiver is exhausted or
+///           cancelled, so it can be used to interpret the meaning of a nil
+///           return value.
+/// error   - If not NULL, set to any error that occurs during traversal.
+///
+/// Returns nil if an error occurs or the receiver is exhausted or cancelled.
+- (GTCommit * _Nullable)nextObjectWithSuccess:(BOOL * _Nullable)success error:(NSError **)error;
+
+/// Enumerates all remaining commits, completely exhausting the receiver.
+///
+/// error - If not NULL, set to any error that occurs during traversal.
+///
+/// Returns a (possibly empty) array of GTCommits, or nil if an error occurs.
+- (NSArray<GTCommit *> * _Nullable)allObjectsWithError:(NSError **)error;
+
+/// Stops the background thread and drops any commits it read ahead. Any later
+/// call to -nextObjectWithSuccess:error: returns nil as though the receiver
+/// were exhausted.
+///
+/// This is called automatically when the receiver is deallocated.
+- (void)cancel;
+
+@end
+
+NS_ASSUME_NONNULL_END
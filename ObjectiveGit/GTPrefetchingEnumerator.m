@@ -0,0 +1,326 @@
+//
+//  GTPrefetchingEnumerator.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTPrefetchingEnumerator.h"
+#import "GTCommit+Private.h"
+#import "GTOID.h"
+#import "GTRepository.h"
+#import "NSError+Git.h"
+
+#import "git2/errors.h"
+#import "git2/odb.h"
+#import "git2/repository.h"
+
+#import <pthread.h>
+
+const NSUInteger GTPrefetchingEnumeratorDefaultBufferSize = 256;
+
+// How many OIDs the producer takes from the walk at a time.
+static const NSUInteger GTPrefetchingEnumeratorWalkBatchSize = 64;
+
+// A raw commit read by the producer, waiting to be wrapped by the consumer.
+@interface GTPrefetchedCommit : NSObject {
+@public
+	git_odb_object *_rawCommit;
+}
+
+@end
+
+@implementation GTPrefetchedCommit
+
+- (void)dealloc {
+	git_odb_object_free(_rawCommit);
+}
+
+@end
+
+// A bounded FIFO of raw commits shared by the producer and the consumer.
+//
+// The producer blocks in -push: while the ring is full, and the consumer blocks
+// in -popWithError: while it is empty and the producer hasn't finished.
+@interface GTPrefetchRing : NSObject {
+	pthread_mutex_t _lock;
+	pthread_cond_t _changed;
+
+	CFTypeRef *_slots;
+	NSUInteger _capacity;
+	NSUInteger _head;
+	NSUInteger _count;
+
+	BOOL _finished;
+	BOOL _cancelled;
+	NSError *_error;
+}
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity;
+
+// Returns NO, without adding the object, if the ring was cancelled.
+- (BOOL)push:(id)object;
+
+// Returns nil once the ring has been drained after finishing, or cancelled.
+- (id)popWithError:(NSError **)error;
+
+- (void)finishWithError:(NSError *)error;
+- (void)cancel;
+- (BOOL)isCancelled;
+
+@end
+
+@implementation GTPrefetchRing
+
+- (instancetype)initWithCapacity:(NSUInteger)capacity {
+	NSParameterAssert(capacity > 0);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_capacity = capacity;
+	_slots = calloc(capacity, sizeof(*_slots));
+	pthread_mutex_init(&_lock, NULL);
+	pthread_cond_init(&_changed, NULL);
+
+	return self;
+}
+
+- (void)dealloc {
+	for (NSUInteger i = 0; i < _count; i++) {
+		CFRelease(_slots[(_head + i) % _capacity]);
+	}
+
+	free(_slots);
+	pthread_cond_destroy(&_changed);
+	pthread_mutex_destroy(&_lock);
+}
+
+- (BOOL)push:(id)object {
+	pthread_mutex_lock(&_lock);
+
+	while (_count == _capacity && !_cancelled) {
+		pthread_cond_wait(&_changed, &_lock);
+	}
+
+	BOOL cancelled = _cancelled;
+	if (!cancelled) {
+		_slots[(_head + _count) % _capacity] = CFBridgingRetain(object);
+		_count++;
+		pthread_cond_broadcast(&_changed);
+	}
+
+	pthread_mutex_unlock(&_lock);
+	return !cancelled;
+}
+
+- (id)popWithError:(NSError **)error {
+	pthread_mutex_lock(&_lock);
+
+	while (_count == 0 && !_finished && !_cancelled) {
+		pthread_cond_wait(&_changed, &_lock);
+	}
+
+	id object = nil;
+	if (_count > 0 && !_cancelled) {
+		object = CFBridgingRelease(_slots[_head]);
+		_slots[_head] = NULL;
+		_head = (_head + 1) % _capacity;
+		_count--;
+		pthread_cond_broadcast(&_changed);
+	} else if (error != NULL && !_cancelled) {
+		*error = _error;
+	}
+
+	pthread_mutex_unlock(&_lock);
+	return object;
+}
+
+- (void)finishWithError:(NSError *)error {
+	pthread_mutex_lock(&_lock);
+	_finished = YES;
+	_error = error;
+	pthread_cond_broadcast(&_changed);
+	pthread_mutex_unlock(&_lock);
+}
+
+- (void)cancel {
+	pthread_mutex_lock(&_lock);
+	_cancelled = YES;
+	pthread_cond_broadcast(&_changed);
+	pthread_mutex_unlock(&_lock);
+}
+
+- (BOOL)isCancelled {
+	pthread_mutex_lock(&_lock);
+	BOOL cancelled = _cancelled;
+	pthread_mutex_unlock(&_lock);
+
+	return cancelled;
+}
+
+@end
+
+@interface GTPrefetchingEnumerator ()
+
+@property (nonatomic, strong, readonly) GTPrefetchRing *ring;
+
+@end
+
+@implementation GTPrefetchingEnumerator
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	NSAssert(NO, @"Call to an unavailable initializer.");
+	return nil;
+}
+
+- (instancetype)initWithRepository:(GTRepository *)repo options:(GTEnumeratorOptions)options bufferSize:(NSUInteger)bufferSize configureBlock:(BOOL (^)(GTEnumerator *enumerator, NSError **error))configureBlock error:(NSError **)error {
+	NSParameterAssert(repo != nil);
+	NSParameterAssert(bufferSize > 0);
+	NSParameterAssert(configureBlock != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_repository = repo;
+	_bufferSize = bufferSize;
+
+	// libgit2 repositories can't be used from two threads at once, so the
+	// producer gets a handle of its own. It only ever passes raw commits to
+	// the consumer, which wraps them in `repo`.
+	GTRepository *producerRepository = [[GTRepository alloc] initWithURL:repo.gitDirectoryURL flags:GTRepositoryOpenNoSearch ceilingDirs:nil error:error];
+	if (producerRepository == nil) return nil;
+
+	producerRepository.OIDPool = repo.OIDPool;
+
+	GTEnumerator *enumerator = [[GTEnumerator alloc] initWithRepository:producerRepository error:error];
+	if (enumerator == nil) return nil;
+
+	[enumerator resetWithOptions:options];
+	if (!configureBlock(enumerator, error)) return nil;
+
+	_ring = [[GTPrefetchRing alloc] initWithCapacity:bufferSize];
+	[self.class startProducingFromEnumerator:enumerator intoRing:_ring];
+
+	return self;
+}
+
+- (void)dealloc {
+	[_ring cancel];
+}
+
+#pragma mark Producing
+
+// The producer only holds on to the ring, never the GTPrefetchingEnumerator,
+// so that releasing the enumerator cancels the walk.
+//
+// Only the producer uses the enumerator's repository. Commits are read as raw
+// objects, which don't refer to the repository they were read through.
++ (void)startProducingFromEnumerator:(GTEnumerator *)enumerator intoRing:(GTPrefetchRing *)ring {
+	dispatch_queue_t queue = dispatch_queue_create("org.libgit2.ObjectiveGit.GTPrefetchingEnumerator", DISPATCH_QUEUE_SERIAL);
+	dispatch_async(queue, ^{
+		git_odb *odb = NULL;
+		int gitError = git_repository_odb(&odb, enumerator.repository.git_repository);
+		if (gitError != GIT_OK) {
+			[ring finishWithError:[NSError git_errorFor:gitError description:@"Failed to open the object database"]];
+			return;
+		}
+
+		git_oid oids[GTPrefetchingEnumeratorWalkBatchSize];
+		NSError *error = nil;
+
+		while (!ring.isCancelled) {
+			NSUInteger count = [enumerator nextOIDs:oids maxCount:GTPrefetchingEnumeratorWalkBatchSize error:&error];
+			if (count == NSNotFound || count == 0) break;
+
+			for (NSUInteger i = 0; i < count && error == nil; i++) {
+				@autoreleasepool {
+					GTPrefetchedCommit *commit = [[GTPrefetchedCommit alloc] init];
+					gitError = git_odb_read(&commit->_rawCommit, odb, &oids[i]);
+
+					// Match git_object_lookup, which can't find objects of the
+					// wrong type.
+					if (gitError == GIT_OK && git_odb_object_type(commit->_rawCommit) != GIT_OBJECT_COMMIT) gitError = GIT_ENOTFOUND;
+
+					if (gitError != GIT_OK) {
+						GTOID *OID = [GTOID oidWithGitOid:&oids[i]];
+						error = [NSError git_errorFor:gitError description:@"Failed to lookup commit" userInfo:@{ GTGitErrorOID: OID } failureReason:@"The commit %@ couldn't be found in the repository.", OID.SHA];
+					} else if (![ring push:commit]) {
+						git_odb_free(odb);
+						return;
+					}
+				}
+			}
+
+			if (error != nil) break;
+		}
+
+		git_odb_free(odb);
+		[ring finishWithError:error];
+	});
+}
+
+#pragma mark Enumerating
+
+- (BOOL)isCancelled {
+	return self.ring.isCancelled;
+}
+
+- (void)cancel {
+	[self.ring cancel];
+}
+
+- (GTCommit *)nextObjectWithSuccess:(BOOL *)success error:(NSError **)error {
+	NSError *ringError = nil;
+	GTPrefetchedCommit *prefetchedCommit = [self.ring popWithError:&ringError];
+
+	GTCommit *commit = nil;
+	if (prefetchedCommit != nil) {
+		git_odb_object *rawCommit = prefetchedCommit->_rawCommit;
+		prefetchedCommit->_rawCommit = NULL;
+		commit = [[GTCommit alloc] initWithRawCommit:rawCommit inRepository:self.repository];
+	}
+
+	if (success != NULL) *success = (commit != nil || ringError == nil);
+	if (ringError != nil && error != NULL) *error = ringError;
+
+	return commit;
+}
+
+- (NSArray *)allObjectsWithError:(NSError **)error {
+	NSMutableArray *array = [NSMutableArray array];
+
+	GTCommit *object;
+	do {
+		BOOL success;
+		object = [self nextObjectWithSuccess:&success error:error];
+		if (!success) return nil;
+
+		if (object != nil) {
+			[array addObject:object];
+		}
+	} while (object != nil);
+
+	return array;
+}
+
+#pragma mark NSEnumerator
+
+- (NSArray *)allObjects {
+	NSArray *objects = [self allObjectsWithError:NULL];
+	return objects ? objects : [NSArray array];
+}
+
+- (id)nextObject {
+	return [self nextObjectWithSuccess:NULL error:NULL];
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> repository: %@, bufferSize: %lu", self.class, self, self.repository, (unsigned long)self.bufferSize];
+}
+
+@end
@@ -220,7 +220,7 @@ static NSString *referenceTypeToString(GTReferenceType type) {
 	const git_oid *oid = self.git_oid;
 	if (oid == NULL) return nil;
 
-	return [[GTOID alloc] initWithGitOid:oid];
+	return [self.repository OIDWithGitOid:oid];
 }
 
 - (GTReference *)reloadedReferenceWithError:(NSError **)error {
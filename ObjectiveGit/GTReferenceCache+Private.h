@@ -0,0 +1,29 @@
+//
+//  GTReferenceCache+Private.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTReferenceCache.h"
+#import "git2/types.h"
+
+NS_ASSUME_NONNULL_BEGIN
+
+@interface GTReferenceCache ()
+
+/// Looks up a reference, answering from the cache if it's still current.
+///
+/// reference  - Set to a new reference, which the caller must free. Cannot be
+///              NULL.
+/// name       - The full name of the reference. Cannot be nil.
+/// resolve    - Whether to follow symbolic references to the direct reference
+///              they end at, like git_reference_resolve.
+/// repository - The repository the cache was created for. Cannot be NULL.
+///
+/// Returns GIT_OK, or the libgit2 error which occurred.
+- (int)lookUpGitReference:(git_reference * _Nullable * _Nonnull)reference named:(NSString *)name resolve:(BOOL)resolve inRepository:(git_repository *)repository;
+
+@end
+
+NS_ASSUME_NONNULL_END
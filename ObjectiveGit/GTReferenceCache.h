@@ -0,0 +1,63 @@
+//
+//  GTReferenceCache.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@class GTRepository;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// An in-memory cache of a repository's references.
+///
+/// Assign one to a GTRepository's `referenceCache` to answer
+/// -lookUpReferenceWithName:error:, -headReferenceWithError: and
+/// -currentBranchWithError: from memory. Before a cached reference is used,
+/// its loose file, and `packed-refs` if it's packed, are checked with stat(2).
+/// If their inode, size or modification time changed, the reference is read
+/// again. A lookup therefore costs one or two stat calls, instead of opening
+/// and parsing the reference.
+///
+/// Changes which keep all three the same, like a file rewritten in place
+/// within the timestamp resolution, aren't noticed. Call
+/// -invalidateAllReferences after such writes.
+///
+/// A cache can only be used with the repository it was created for.
+///
+/// This class is thread safe.
+@interface GTReferenceCache : NSObject
+
+/// The number of references currently cached.
+@property (readonly, assign) NSUInteger count;
+
+/// The number of lookups answered from the cache.
+@property (readonly, assign) NSUInteger hitCount;
+
+/// The number of lookups of references which weren't cached yet.
+@property (readonly, assign) NSUInteger missCount;
+
+/// The number of lookups which found the cached reference out of date, and
+/// read it again.
+@property (readonly, assign) NSUInteger staleCount;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Initializes an empty cache for the given repository. Designated
+/// initializer.
+///
+/// repository - The repository whose references to cache. The cache doesn't
+///              retain it. Cannot be nil.
+- (instancetype)initWithRepository:(GTRepository *)repository NS_DESIGNATED_INITIALIZER;
+
+/// Forgets the reference with the given full name, if it's cached.
+- (void)invalidateReferenceNamed:(NSString *)name;
+
+/// Forgets every cached reference.
+- (void)invalidateAllReferences;
+
+@end
+
+NS_ASSUME_NONNULL_END
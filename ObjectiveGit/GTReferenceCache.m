@@ -0,0 +1,225 @@
+//
+//  GTReferenceCache.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTReferenceCache+Private.h"
+#import "GTRepository.h"
+
+#import "git2/errors.h"
+#import "git2/refs.h"
+#import "git2/repository.h"
+
+#import <pthread.h>
+#import <sys/stat.h>
+
+// How many symbolic references are followed before giving up, like libgit2.
+static const NSUInteger GTReferenceCacheMaximumNesting = 10;
+
+// What stat(2) said about a file, enough to tell whether it has changed.
+typedef struct {
+	BOOL exists;
+	dev_t device;
+	ino_t inode;
+	off_t size;
+	struct timespec modificationTime;
+} GTReferenceCacheFileState;
+
+static GTReferenceCacheFileState GTReferenceCacheFileStateAtPath(const char *path) {
+	GTReferenceCacheFileState state = { 0 };
+
+	struct stat info;
+	if (stat(path, &info) != 0) return state;
+
+	state.exists = YES;
+	state.device = info.st_dev;
+	state.inode = info.st_ino;
+	state.size = info.st_size;
+	state.modificationTime = info.st_mtimespec;
+	return state;
+}
+
+static BOOL GTReferenceCacheFileStatesEqual(GTReferenceCacheFileState first, GTReferenceCacheFileState second) {
+	if (first.exists != second.exists) return NO;
+	if (!first.exists) return YES;
+
+	return first.device == second.device && first.inode == second.inode && first.size == second.size && first.modificationTime.tv_sec == second.modificationTime.tv_sec && first.modificationTime.tv_nsec == second.modificationTime.tv_nsec;
+}
+
+// A cached reference, with the state of the files it was read from.
+@interface GTReferenceCacheEntry : NSObject {
+@public
+	git_reference *_git_reference;
+	GTReferenceCacheFileState _looseState;
+	GTReferenceCacheFileState _packedState;
+}
+
+@end
+
+@implementation GTReferenceCacheEntry
+
+- (void)dealloc {
+	git_reference_free(_git_reference);
+}
+
+@end
+
+@interface GTReferenceCache () {
+	pthread_mutex_t _lock;
+}
+
+// The directories per-worktree references, like HEAD, and shared references,
+// under `refs/`, are stored in. Both end in a slash.
+@property (nonatomic, readonly, copy) NSString *gitDirectoryPath;
+@property (nonatomic, readonly, copy) NSString *commonDirectoryPath;
+
+// Cached references, keyed by full name. Guarded by `_lock`.
+@property (nonatomic, readonly, strong) NSMutableDictionary<NSString *, GTReferenceCacheEntry *> *entries;
+
+@property (readwrite, assign) NSUInteger hitCount;
+@property (readwrite, assign) NSUInteger missCount;
+@property (readwrite, assign) NSUInteger staleCount;
+
+@end
+
+@implementation GTReferenceCache
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	NSAssert(NO, @"Call to an unavailable initializer.");
+	return nil;
+}
+
+- (instancetype)initWithRepository:(GTRepository *)repository {
+	NSParameterAssert(repository != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_gitDirectoryPath = @(git_repository_path(repository.git_repository));
+	_commonDirectoryPath = @(git_repository_commondir(repository.git_repository));
+	_entries = [NSMutableDictionary dictionary];
+	pthread_mutex_init(&_lock, NULL);
+
+	return self;
+}
+
+- (void)dealloc {
+	pthread_mutex_destroy(&_lock);
+}
+
+#pragma mark Properties
+
+- (NSUInteger)count {
+	pthread_mutex_lock(&_lock);
+	NSUInteger count = self.entries.count;
+	pthread_mutex_unlock(&_lock);
+
+	return count;
+}
+
+#pragma mark Invalidation
+
+- (void)invalidateReferenceNamed:(NSString *)name {
+	NSParameterAssert(name != nil);
+
+	pthread_mutex_lock(&_lock);
+	[self.entries removeObjectForKey:name];
+	pthread_mutex_unlock(&_lock);
+}
+
+- (void)invalidateAllReferences {
+	pthread_mutex_lock(&_lock);
+	[self.entries removeAllObjects];
+	pthread_mutex_unlock(&_lock);
+}
+
+#pragma mark Lookup
+
+- (NSString *)loosePathForReferenceNamed:(NSString *)name {
+	NSString *directoryPath = ([name hasPrefix:@"refs/"] ? self.commonDirectoryPath : self.gitDirectoryPath);
+	return [directoryPath stringByAppendingString:name];
+}
+
+- (int)lookUpGitReference:(git_reference **)reference named:(NSString *)name resolve:(BOOL)resolve inRepository:(git_repository *)repository {
+	NSParameterAssert(reference != NULL);
+	NSParameterAssert(name != nil);
+	NSParameterAssert(repository != NULL);
+
+	git_reference *current = NULL;
+	int gitError = [self lookUpGitReference:&current named:name inRepository:repository];
+
+	for (NSUInteger nesting = 0; gitError == GIT_OK && resolve && git_reference_type(current) == GIT_REFERENCE_SYMBOLIC; nesting++) {
+		if (nesting == GTReferenceCacheMaximumNesting) {
+			git_reference_free(current);
+			return GIT_ENOTFOUND;
+		}
+
+		git_reference *target = NULL;
+		gitError = [self lookUpGitReference:&target named:@(git_reference_symbolic_target(current)) inRepository:repository];
+		git_reference_free(current);
+		current = target;
+	}
+
+	if (gitError != GIT_OK) return gitError;
+
+	*reference = current;
+	return GIT_OK;
+}
+
+// Looks up a single reference, without following it.
+- (int)lookUpGitReference:(git_reference **)reference named:(NSString *)name inRepository:(git_repository *)repository {
+	const char *loosePath = [self loosePathForReferenceNamed:name].fileSystemRepresentation;
+	const char *packedPath = [self.commonDirectoryPath stringByAppendingString:@"packed-refs"].fileSystemRepresentation;
+
+	// The files are checked before the reference is read, so a change in
+	// between only makes the next lookup read it again. A loose reference
+	// overrides a packed one, so packed-refs only matters when there's no
+	// loose file.
+	GTReferenceCacheFileState looseState = GTReferenceCacheFileStateAtPath(loosePath);
+	GTReferenceCacheFileState packedState = { 0 };
+	if (!looseState.exists) packedState = GTReferenceCacheFileStateAtPath(packedPath);
+
+	pthread_mutex_lock(&_lock);
+	GTReferenceCacheEntry *entry = self.entries[name];
+	BOOL current = entry != nil && GTReferenceCacheFileStatesEqual(entry->_looseState, looseState) && (looseState.exists || GTReferenceCacheFileStatesEqual(entry->_packedState, packedState));
+	if (current) {
+		self.hitCount++;
+	} else if (entry != nil) {
+		self.staleCount++;
+	} else {
+		self.missCount++;
+	}
+	int gitError = (current ? git_reference_dup(reference, entry->_git_reference) : GIT_OK);
+	pthread_mutex_unlock(&_lock);
+
+	if (current) return gitError;
+
+	gitError = git_reference_lookup(reference, repository, name.UTF8String);
+	if (gitError != GIT_OK) {
+		[self invalidateReferenceNamed:name];
+		return gitError;
+	}
+
+	GTReferenceCacheEntry *newEntry = [[GTReferenceCacheEntry alloc] init];
+	if (git_reference_dup(&newEntry->_git_reference, *reference) != GIT_OK) return GIT_OK;
+	newEntry->_looseState = looseState;
+	newEntry->_packedState = packedState;
+
+	pthread_mutex_lock(&_lock);
+	self.entries[name] = newEntry;
+	pthread_mutex_unlock(&_lock);
+
+	return GIT_OK;
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> count: %lu, hits: %lu, misses: %lu, stale: %lu", self.class, self, (unsigned long)self.count, (unsigned long)self.hitCount, (unsigned long)self.missCount, (unsigned long)self.staleCount];
+}
+
+@end
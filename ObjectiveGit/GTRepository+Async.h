@@ -0,0 +1,95 @@
+//
+//  GTRepository+Async.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTRepository.h"
+#import "git2/remote.h"
+
+@class GTBranch;
+@class GTCancellationToken;
+@class GTDiff;
+@class GTRemote;
+@class GTStatusDelta;
+@class GTTree;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Asynchronous variants of the long running repository operations.
+///
+/// Each operation runs on `asyncOperationQueue`, so only a bounded number of
+/// them run at once no matter how many are started. Completion handlers are
+/// called on that queue too, once the operation has finished, failed or been
+/// cancelled. Cancelled operations fail with
+/// +[GTCancellationToken cancellationError].
+///
+/// A repository can only be used by one thread at a time, so the receiver must
+/// not be used elsewhere until the completion handler has been called. Use a
+/// GTRepositoryPool to run operations on the same repository concurrently.
+@interface GTRepository (Async)
+
+/// The queue asynchronous operations run on.
+///
+/// By default, this is a queue which runs as many operations at once as there
+/// are active processors, with a quality of service of
+/// NSQualityOfServiceUtility. Change its `maxConcurrentOperationCount` or
+/// `qualityOfService`, or set another queue, to adjust that.
++ (NSOperationQueue *)asyncOperationQueue;
++ (void)setAsyncOperationQueue:(NSOperationQueue *)queue;
+
+/// Clones a repository asynchronously.
+///
+/// See +cloneFromURL:toWorkingDirectory:options:error:transferProgressBlock:
+/// for the parameters. The token is checked on every transfer progress update.
+///
+/// cancellationToken - The token to cancel the clone with, or nil.
+/// completion        - Called with the cloned repository, or nil and the error
+///                     which occurred. Cannot be nil.
++ (void)cloneFromURL:(NSURL *)originURL toWorkingDirectory:(NSURL *)workdirURL options:(NSDictionary * _Nullable)options cancellationToken:(GTCancellationToken * _Nullable)cancellationToken transferProgressBlock:(void (^ _Nullable)(const git_transfer_progress *progress, BOOL *stop))transferProgressBlock completion:(void (^)(GTRepository * _Nullable repository, NSError * _Nullable error))completion;
+
+/// Fetches a remote asynchronously.
+///
+/// See -fetchRemote:withOptions:error:progress: for the parameters. The token
+/// is checked on every transfer progress update.
+///
+/// cancellationToken - The token to cancel the fetch with, or nil.
+/// completion        - Called with whether the fetch succeeded, and the error
+///                     if not. Cannot be nil.
+- (void)fetchRemote:(GTRemote *)remote withOptions:(NSDictionary * _Nullable)options cancellationToken:(GTCancellationToken * _Nullable)cancellationToken progress:(void (^ _Nullable)(const git_transfer_progress *stats, BOOL *stop))progressBlock completion:(void (^)(BOOL success, NSError * _Nullable error))completion;
+
+/// Pushes branches asynchronously.
+///
+/// See -pushBranches:toRemote:withOptions:error:progress: for the parameters.
+/// The token is checked on every transfer progress update.
+///
+/// cancellationToken - The token to cancel the push with, or nil.
+/// completion        - Called with whether the push succeeded, and the error if
+///                     not. Cannot be nil.
+- (void)pushBranches:(NSArray<GTBranch *> *)branches toRemote:(GTRemote *)remote withOptions:(NSDictionary * _Nullable)options cancellationToken:(GTCancellationToken * _Nullable)cancellationToken progress:(void (^ _Nullable)(unsigned int current, unsigned int total, size_t bytes, BOOL *stop))progressBlock completion:(void (^)(BOOL success, NSError * _Nullable error))completion;
+
+/// Enumerates file statuses asynchronously.
+///
+/// See -enumerateFileStatusWithOptions:error:usingBlock: for the parameters.
+/// The block is called on the operation queue, and the token is checked
+/// before every file.
+///
+/// cancellationToken - The token to cancel the enumeration with, or nil.
+/// completion        - Called with whether the enumeration completed, and the
+///                     error if not. Cannot be nil.
+- (void)enumerateFileStatusWithOptions:(NSDictionary * _Nullable)options cancellationToken:(GTCancellationToken * _Nullable)cancellationToken usingBlock:(void (^ _Nullable)(GTStatusDelta * _Nullable headToIndex, GTStatusDelta * _Nullable indexToWorkingDirectory, BOOL *stop))block completion:(void (^)(BOOL success, NSError * _Nullable error))completion;
+
+/// Diffs two trees asynchronously.
+///
+/// See +[GTDiff diffOldTree:withNewTree:inRepository:options:error:] for the
+/// parameters. The token is checked before every file.
+///
+/// cancellationToken - The token to cancel the diff with, or nil.
+/// completion        - Called with the diff, or nil and the error which
+///                     occurred. Cannot be nil.
+- (void)diffOldTree:(GTTree * _Nullable)oldTree withNewTree:(GTTree * _Nullable)newTree options:(NSDictionary * _Nullable)options cancellationToken:(GTCancellationToken * _Nullable)cancellationToken completion:(void (^)(GTDiff * _Nullable diff, NSError * _Nullable error))completion;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,149 @@
+//
+//  GTRepository+Async.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTRepository+Async.h"
+#import "GTCancellationToken.h"
+#import "GTDiff.h"
+#import "GTRepository+RemoteOperations.h"
+#import "GTRepository+Status.h"
+
+static NSOperationQueue *GTRepositoryAsyncOperationQueue;
+
+@implementation GTRepository (Async)
+
+#pragma mark Queue
+
++ (NSOperationQueue *)asyncOperationQueue {
+	@synchronized (GTRepository.class) {
+		if (GTRepositoryAsyncOperationQueue == nil) {
+			NSOperationQueue *queue = [[NSOperationQueue alloc] init];
+			queue.name = @"org.libgit2.ObjectiveGit.async";
+			queue.maxConcurrentOperationCount = (NSInteger)NSProcessInfo.processInfo.activeProcessorCount;
+			queue.qualityOfService = NSQualityOfServiceUtility;
+			GTRepositoryAsyncOperationQueue = queue;
+		}
+
+		return GTRepositoryAsyncOperationQueue;
+	}
+}
+
++ (void)setAsyncOperationQueue:(NSOperationQueue *)queue {
+	NSParameterAssert(queue != nil);
+
+	@synchronized (GTRepository.class) {
+		GTRepositoryAsyncOperationQueue = queue;
+	}
+}
+
+// Runs `block` on the async queue, and passes what it returns to `completion`.
+//
+// If the token is cancelled before the block starts, it isn't run at all. If
+// the block fails after the token was cancelled, the cancellation is reported
+// instead of whatever libgit2 made of the aborted callback.
++ (void)performWithCancellationToken:(GTCancellationToken *)cancellationToken block:(id (^)(NSError **error))block completion:(void (^)(id result, NSError *error))completion {
+	NSParameterAssert(block != nil);
+	NSParameterAssert(completion != nil);
+
+	[self.asyncOperationQueue addOperationWithBlock:^{
+		if (cancellationToken.cancelled) {
+			completion(nil, GTCancellationToken.cancellationError);
+			return;
+		}
+
+		NSError *error = nil;
+		id result = block(&error);
+		if (result == nil && cancellationToken.cancelled) error = GTCancellationToken.cancellationError;
+
+		completion(result, error);
+	}];
+}
+
+#pragma mark Operations
+
++ (void)cloneFromURL:(NSURL *)originURL toWorkingDirectory:(NSURL *)workdirURL options:(NSDictionary *)options cancellationToken:(GTCancellationToken *)cancellationToken transferProgressBlock:(void (^)(const git_transfer_progress *, BOOL *))transferProgressBlock completion:(void (^)(GTRepository *, NSError *))completion {
+	NSParameterAssert(originURL != nil);
+	NSParameterAssert(workdirURL != nil);
+
+	[self performWithCancellationToken:cancellationToken block:^(NSError **error) {
+		return [self cloneFromURL:originURL toWorkingDirectory:workdirURL options:options error:error transferProgressBlock:^(const git_transfer_progress *progress, BOOL *stop) {
+			if (cancellationToken.cancelled) {
+				*stop = YES;
+			} else if (transferProgressBlock != nil) {
+				transferProgressBlock(progress, stop);
+			}
+		}];
+	} completion:completion];
+}
+
+- (void)fetchRemote:(GTRemote *)remote withOptions:(NSDictionary *)options cancellationToken:(GTCancellationToken *)cancellationToken progress:(void (^)(const git_transfer_progress *, BOOL *))progressBlock completion:(void (^)(BOOL, NSError *))completion {
+	NSParameterAssert(remote != nil);
+	NSParameterAssert(completion != nil);
+
+	[self.class performWithCancellationToken:cancellationToken block:^(NSError **error) {
+		BOOL success = [self fetchRemote:remote withOptions:options error:error progress:^(const git_transfer_progress *stats, BOOL *stop) {
+			if (cancellationToken.cancelled) {
+				*stop = YES;
+			} else if (progressBlock != nil) {
+				progressBlock(stats, stop);
+			}
+		}];
+		return (success ? @YES : nil);
+	} completion:^(id result, NSError *error) {
+		completion(result != nil, error);
+	}];
+}
+
+- (void)pushBranches:(NSArray<GTBranch *> *)branches toRemote:(GTRemote *)remote withOptions:(NSDictionary *)options cancellationToken:(GTCancellationToken *)cancellationToken progress:(void (^)(unsigned int, unsigned int, size_t, BOOL *))progressBlock completion:(void (^)(BOOL, NSError *))completion {
+	NSParameterAssert(branches.count > 0);
+	NSParameterAssert(remote != nil);
+	NSParameterAssert(completion != nil);
+
+	[self.class performWithCancellationToken:cancellationToken block:^(NSError **error) {
+		BOOL success = [self pushBranches:branches toRemote:remote withOptions:options error:error progress:^(unsigned int current, unsigned int total, size_t bytes, BOOL *stop) {
+			if (cancellationToken.cancelled) {
+				*stop = YES;
+			} else if (progressBlock != nil) {
+				progressBlock(current, total, bytes, stop);
+			}
+		}];
+		return (success ? @YES : nil);
+	} completion:^(id result, NSError *error) {
+		completion(result != nil, error);
+	}];
+}
+
+- (void)enumerateFileStatusWithOptions:(NSDictionary *)options cancellationToken:(GTCancellationToken *)cancellationToken usingBlock:(void (^)(GTStatusDelta *, GTStatusDelta *, BOOL *))block completion:(void (^)(BOOL, NSError *))completion {
+	NSParameterAssert(completion != nil);
+
+	[self.class performWithCancellationToken:cancellationToken block:^(NSError **error) {
+		// Stopping counts as success for the synchronous enumeration, so
+		// remember whether it was stopped for the cancellation.
+		__block BOOL cancelled = NO;
+		BOOL success = [self enumerateFileStatusWithOptions:options error:error usingBlock:^(GTStatusDelta *headToIndex, GTStatusDelta *indexToWorkingDirectory, BOOL *stop) {
+			if (cancellationToken.cancelled) {
+				cancelled = YES;
+				*stop = YES;
+			} else if (block != nil) {
+				block(headToIndex, indexToWorkingDirectory, stop);
+			}
+		}];
+		return (success && !cancelled ? @YES : nil);
+	} completion:^(id result, NSError *error) {
+		completion(result != nil, error);
+	}];
+}
+
+- (void)diffOldTree:(GTTree *)oldTree withNewTree:(GTTree *)newTree options:(NSDictionary *)options cancellationToken:(GTCancellationToken *)cancellationToken completion:(void (^)(GTDiff *, NSError *))completion {
+	NSMutableDictionary *diffOptions = [NSMutableDictionary dictionaryWithDictionary:options ?: @{}];
+	if (cancellationToken != nil) diffOptions[GTDiffOptionsCancellationTokenKey] = cancellationToken;
+
+	[self.class performWithCancellationToken:cancellationToken block:^(NSError **error) {
+		return [GTDiff diffOldTree:oldTree withNewTree:newTree inRepository:self options:diffOptions error:error];
+	} completion:completion];
+}
+
+@end
@@ -15,6 +15,10 @@ NS_ASSUME_NONNULL_BEGIN
 - (id _Nullable)lookUpObjectByGitOid:(const git_oid *)oid objectType:(GTObjectType)type error:(NSError **)error;
 - (id _Nullable)lookUpObjectByGitOid:(const git_oid *)oid error:(NSError **)error;
 
+/// Returns the interned OID from the receiver's `OIDPool`, or a new GTOID if
+/// the receiver doesn't have a pool.
+- (GTOID *)OIDWithGitOid:(const git_oid *)oid;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -7,10 +7,42 @@
 //
 
 #import "GTRepository.h"
+#import "GTReference.h"
 
 NS_ASSUME_NONNULL_BEGIN
 
-@class GTReference;
+@class GTOID;
+
+/// A reference seen by -enumerateReferencesMatchingGlob:error:usingBlock:.
+///
+/// Properties are read from the underlying reference when first asked for, so
+/// a caller which only needs the name pays for nothing else. The same entry is
+/// reused for every reference, and is only valid during the block it was
+/// passed to.
+@interface GTReferenceEnumerationEntry : NSObject
+
+/// The full name of the reference, like `refs/heads/master`.
+@property (nonatomic, readonly, copy) NSString *name;
+
+/// Whether the reference points at an object or at another reference.
+@property (nonatomic, readonly, assign) GTReferenceType referenceType;
+
+/// The object a direct reference points at, or nil for symbolic references.
+@property (nonatomic, readonly, strong) GTOID * _Nullable OID;
+
+/// The name of the reference a symbolic reference points at, or nil for
+/// direct references.
+@property (nonatomic, readonly, copy) NSString * _Nullable symbolicTargetName;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Creates a GTReference for the entry, which stays valid after the block
+/// returns.
+///
+/// Returns the reference, or nil if it couldn't be copied.
+- (GTReference * _Nullable)reference;
+
+@end
 
 @interface GTRepository (References)
 
@@ -22,6 +54,19 @@ NS_ASSUME_NONNULL_BEGIN
 /// Returns the reference or nil if look up failed.
 - (GTReference * _Nullable)lookUpReferenceWithName:(NSString *)name error:(NSError **)error;
 
+/// Enumerates references in a single pass, without creating a GTReference for
+/// each of them.
+///
+/// glob  - An fnmatch(3) pattern the full reference names must match, like
+///         `refs/remotes/origin/*`, or nil to enumerate every reference. `*`
+///         also matches `/`.
+/// error - The error if one occurred. May be NULL.
+/// block - A block to invoke for each matching reference. Set `stop` to YES
+///         to end the enumeration early. Cannot be nil.
+///
+/// Returns whether the enumeration completed or was stopped without an error.
+- (BOOL)enumerateReferencesMatchingGlob:(NSString * _Nullable)glob error:(NSError **)error usingBlock:(void (^)(GTReferenceEnumerationEntry *entry, BOOL *stop))block;
+
 @end
 
 NS_ASSUME_NONNULL_END
@@ -7,10 +7,92 @@
 //
 
 #import "GTRepository+References.h"
-#import "GTReference.h"
+#import "GTRepository+Private.h"
+#import "GTReferenceCache+Private.h"
+#import "GTOID.h"
 #import "NSError+Git.h"
 
 #import "git2/errors.h"
+#import "git2/refs.h"
+
+@interface GTReferenceEnumerationEntry () {
+	// The reference currently described, or NULL outside of the block.
+	git_reference *_git_reference;
+
+	NSString *_name;
+	GTOID *_OID;
+	NSString *_symbolicTargetName;
+}
+
+@property (nonatomic, readonly, strong) GTRepository *repository;
+
+@end
+
+@implementation GTReferenceEnumerationEntry
+
+- (instancetype)init {
+	NSAssert(NO, @"Call to an unavailable initializer.");
+	return nil;
+}
+
+- (instancetype)initWithRepository:(GTRepository *)repository {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_repository = repository;
+
+	return self;
+}
+
+// Points the entry at the next reference, forgetting what was read from the
+// last one. The entry doesn't take ownership of `reference`.
+- (void)setGitReference:(git_reference *)reference {
+	_git_reference = reference;
+	_name = nil;
+	_OID = nil;
+	_symbolicTargetName = nil;
+}
+
+- (NSString *)name {
+	if (_name == nil && _git_reference != NULL) _name = @(git_reference_name(_git_reference));
+	return _name;
+}
+
+- (GTReferenceType)referenceType {
+	if (_git_reference == NULL) return GTReferenceTypeInvalid;
+	return (GTReferenceType)git_reference_type(_git_reference);
+}
+
+- (GTOID *)OID {
+	if (_OID == nil && _git_reference != NULL) {
+		const git_oid *oid = git_reference_target(_git_reference);
+		if (oid != NULL) _OID = [self.repository OIDWithGitOid:oid];
+	}
+	return _OID;
+}
+
+- (NSString *)symbolicTargetName {
+	if (_symbolicTargetName == nil && _git_reference != NULL) {
+		const char *target = git_reference_symbolic_target(_git_reference);
+		if (target != NULL) _symbolicTargetName = @(target);
+	}
+	return _symbolicTargetName;
+}
+
+- (GTReference *)reference {
+	if (_git_reference == NULL) return nil;
+
+	git_reference *copy = NULL;
+	if (git_reference_dup(&copy, _git_reference) != GIT_OK) return nil;
+
+	return [[GTReference alloc] initWithGitReference:copy repository:self.repository];
+}
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> name: %@", self.class, self, self.name];
+}
+
+@end
 
 @implementation GTRepository (References)
 
@@ -18,7 +100,8 @@
 	NSParameterAssert(name != nil);
 
 	git_reference *ref = NULL;
-	int gitError = git_reference_lookup(&ref, self.git_repository, name.UTF8String);
+	GTReferenceCache *cache = self.referenceCache;
+	int gitError = (cache != nil ? [cache lookUpGitReference:&ref named:name resolve:NO inRepository:self.git_repository] : git_reference_lookup(&ref, self.git_repository, name.UTF8String));
 	if (gitError != GIT_OK) {
 		if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to lookup reference %@.", name];
 		return nil;
@@ -27,4 +110,35 @@
 	return [[GTReference alloc] initWithGitReference:ref repository:self];
 }
 
+- (BOOL)enumerateReferencesMatchingGlob:(NSString *)glob error:(NSError **)error usingBlock:(void (^)(GTReferenceEnumerationEntry *entry, BOOL *stop))block {
+	NSParameterAssert(block != nil);
+
+	git_reference_iterator *iterator = NULL;
+	int gitError = (glob != nil ? git_reference_iterator_glob_new(&iterator, self.git_repository, glob.UTF8String) : git_reference_iterator_new(&iterator, self.git_repository));
+	if (gitError != GIT_OK) {
+		if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to iterate references matching %@", glob];
+		return NO;
+	}
+
+	GTReferenceEnumerationEntry *entry = [[GTReferenceEnumerationEntry alloc] initWithRepository:self];
+	git_reference *reference = NULL;
+	BOOL stop = NO;
+	while (!stop && (gitError = git_reference_next(&reference, iterator)) == GIT_OK) {
+		[entry setGitReference:reference];
+		block(entry, &stop);
+		[entry setGitReference:NULL];
+
+		git_reference_free(reference);
+	}
+
+	git_reference_iterator_free(iterator);
+
+	if (!stop && gitError != GIT_ITEROVER) {
+		if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to iterate references matching %@", glob];
+		return NO;
+	}
+
+	return YES;
+}
+
 @end
@@ -9,6 +9,7 @@
 #import "GTRepository+RemoteOperations.h"
 
 #import "EXTScope.h"
+#import "GTCommitGraph.h"
 #import "GTCredential.h"
 #import "GTCredential+Private.h"
 #import "GTFetchHeadEntry.h"
@@ -108,6 +109,13 @@ int GTRemotePushTransferProgressCallback(unsigned int current, unsigned int tota
 		return NO;
 	}
 
+	// Only the fetched commits need reading. If that fails, the old graph is
+	// still correct for the commits it covers.
+	if (self.commitGraph != nil) {
+		GTCommitGraph *graph = [GTCommitGraph writeCommitGraphForRepository:self error:NULL];
+		if (graph != nil) self.commitGraph = graph;
+	}
+
 	return YES;
 }
 
@@ -42,11 +42,16 @@
 
 @class GTBlob;
 @class GTCommit;
+@class GTCommitCountCache;
+@class GTCommitGraph;
 @class GTConfiguration;
 @class GTDiffFile;
 @class GTIndex;
 @class GTObjectDatabase;
 @class GTOdbObject;
+@class GTOIDPool;
+@class GTObjectCache;
+@class GTReferenceCache;
 @class GTSignature;
 @class GTSubmodule;
 @class GTTag;
@@ -170,6 +175,48 @@ typedef NS_ENUM(NSInteger, GTRepositoryStateType) {
 /// Is HEAD unborn (pointing to a branch without an initial commit)?
 @property (nonatomic, readonly, getter = isHEADUnborn) BOOL HEADUnborn;
 
+/// The pool used to intern the OIDs handed out by the receiver's objects, such
+/// as -[GTCommit OID], -[GTCommit parentOIDs], -[GTReference OID] and
+/// -[GTEnumerator nextOIDWithSuccess:error:].
+///
+/// This is nil by default, in which case every call creates a new GTOID. Set a
+/// pool to get one shared GTOID per object ID during long history walks. The
+/// same pool may be shared between repositories.
+@property (atomic, strong) GTOIDPool * _Nullable OIDPool;
+
+/// The commit graph used to speed up history traversals, such as topologically
+/// sorted enumeration, -calculateAhead:behind:ofOID:relativeToOID:error: and
+/// -mergeBaseBetweenFirstOID:secondOID:error:.
+///
+/// This is nil by default. Assign the result of
+/// +[GTCommitGraph writeCommitGraphForRepository:error:] or
+/// +[GTCommitGraph commitGraphWithRepository:error:] to use it. While set, the
+/// graph is updated after every successful fetch through the receiver.
+@property (atomic, strong) GTCommitGraph * _Nullable commitGraph;
+
+/// The cache used by -[GTBranch numberOfCommitsWithError:] and
+/// -numberOfCommitsInCurrentBranch:.
+///
+/// This is nil by default, in which case every count walks the whole history.
+/// Assign +[GTCommitCountCache commitCountCacheForRepository:] to reuse counts
+/// across calls and launches.
+@property (atomic, strong) GTCommitCountCache * _Nullable commitCountCache;
+
+/// The cache consulted by -lookUpObjectByGitOid:objectType:error: and the
+/// methods built on it.
+///
+/// This is nil by default, in which case every lookup goes to the object
+/// database. Assign a GTObjectCache to keep recently used objects parsed.
+@property (atomic, strong) GTObjectCache * _Nullable objectCache;
+
+/// The cache consulted by -lookUpReferenceWithName:error:,
+/// -headReferenceWithError: and -currentBranchWithError:.
+///
+/// This is nil by default, in which case every lookup reads the reference
+/// from disk. Assign a GTReferenceCache created for the receiver to keep
+/// references in memory while their files don't change.
+@property (atomic, strong) GTReferenceCache * _Nullable referenceCache;
+
 /// Initializes a new repository at the given file URL.
 ///
 /// fileURL - The file URL for the new repository. Cannot be nil.
@@ -207,6 +254,24 @@ typedef NS_ENUM(NSInteger, GTRepositoryStateType) {
 /// Returns the initialized repository, or nil if an error occurred.
 - (instancetype _Nullable)initWithURL:(NSURL *)localFileURL flags:(NSInteger)flags ceilingDirs:(NSArray<NSURL *> * _Nullable)ceilingDirURLs error:(NSError **)error;
 
+/// Opens a repository whose git directory is already known, skipping
+/// discovery.
+///
+/// The git directory is opened as is, without looking for a `.git` file or
+/// directory or walking up to parent directories, and the working directory
+/// is taken from the caller rather than worked out from the configuration.
+/// Only use this with locations from a trusted source, like a previous open
+/// of the same repository.
+///
+/// gitDirectoryURL     - The file URL of the git directory, like
+///                       `/path/to/repo/.git`. Cannot be nil.
+/// workingDirectoryURL - The file URL of the working directory, or nil to
+///                       open the repository as bare.
+/// error               - The error if one occurs.
+///
+/// Returns the initialized repository, or nil if an error occurred.
+- (instancetype _Nullable)initWithGitDirectoryURL:(NSURL *)gitDirectoryURL workingDirectoryURL:(NSURL * _Nullable)workingDirectoryURL error:(NSError **)error;
+
 - (instancetype)init NS_UNAVAILABLE;
 
 /// Initializes the receiver to wrap the given repository object. Designated initializer.
@@ -250,6 +315,20 @@ typedef NS_ENUM(NSInteger, GTRepositoryStateType) {
 /// Lookup an object in the repo using a revparse spec
 - (id _Nullable)lookUpObjectByRevParse:(NSString *)spec error:(NSError **)error;
 
+/// Looks up a commit without parsing it, for listings which only show a few
+/// properties of many commits.
+///
+/// The raw commit is read from the object database, and its header is only
+/// parsed once a property is first accessed. The message and signatures are
+/// only decoded when they're requested, and the commit is only parsed by
+/// libgit2 if its `git_commit` is needed.
+///
+/// oid   - The ID of the commit. Cannot be nil.
+/// error - The error if one occurred.
+///
+/// Returns the commit, or nil if it couldn't be found.
+- (GTCommit * _Nullable)lookUpLazyCommitByOID:(GTOID *)oid error:(NSError **)error;
+
 /// Finds the branch with the given name and type.
 ///
 /// branchName - The name of the branch to look up (e.g., `master` or
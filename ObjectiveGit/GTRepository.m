@@ -31,8 +31,11 @@
 
 #import "GTBlob.h"
 #import "GTBranch.h"
+#import "GTBranchSnapshot.h"
 #import "GTCheckoutOptions.h"
 #import "GTCommit.h"
+#import "GTCommit+Private.h"
+#import "GTCommitGraph+Private.h"
 #import "GTConfiguration+Private.h"
 #import "GTConfiguration.h"
 #import "GTCredential+Private.h"
@@ -42,6 +45,9 @@
 #import "GTFilterList.h"
 #import "GTIndex.h"
 #import "GTOID.h"
+#import "GTOIDPool.h"
+#import "GTObjectCache+Private.h"
+#import "GTReferenceCache+Private.h"
 #import "GTObject.h"
 #import "GTObjectDatabase.h"
 #import "GTSignature.h"
@@ -108,6 +114,9 @@ typedef struct {
 }
 
 - (void)dealloc {
+	// Cached objects have to go before the repository they belong to.
+	[_objectCache removeAllObjects];
+
 	if (_git_repository != NULL) {
 		git_repository_free(_git_repository);
 		_git_repository = NULL;
@@ -213,6 +222,35 @@ typedef struct {
 	return [self initWithGitRepository:r];
 }
 
+- (instancetype)initWithGitDirectoryURL:(NSURL *)gitDirectoryURL workingDirectoryURL:(NSURL *)workingDirectoryURL error:(NSError **)error {
+	NSParameterAssert(gitDirectoryURL != nil);
+
+	if (!gitDirectoryURL.isFileURL || gitDirectoryURL.path == nil || (workingDirectoryURL != nil && (!workingDirectoryURL.isFileURL || workingDirectoryURL.path == nil))) {
+		if (error != NULL) *error = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileReadUnsupportedSchemeError userInfo:@{ NSLocalizedDescriptionKey: NSLocalizedString(@"Invalid file path URL to open.", @"") }];
+		return nil;
+	}
+
+	// Opening as bare skips looking for the working directory, which is then
+	// set from what the caller already knows.
+	git_repository *r;
+	int gitError = git_repository_open_ext(&r, gitDirectoryURL.path.fileSystemRepresentation, GIT_REPOSITORY_OPEN_NO_SEARCH | GIT_REPOSITORY_OPEN_BARE, NULL);
+	if (gitError < GIT_OK) {
+		if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to open repository at URL %@.", gitDirectoryURL];
+		return nil;
+	}
+
+	if (workingDirectoryURL != nil) {
+		gitError = git_repository_set_workdir(r, workingDirectoryURL.path.fileSystemRepresentation, 0);
+		if (gitError < GIT_OK) {
+			git_repository_free(r);
+			if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to set the working directory of %@ to %@.", gitDirectoryURL, workingDirectoryURL];
+			return nil;
+		}
+	}
+
+	return [self initWithGitRepository:r];
+}
+
 
 typedef void(^GTTransferProgressBlock)(const git_transfer_progress *progress, BOOL *stop);
 
@@ -315,7 +353,9 @@ struct GTRemoteCreatePayload {
 }
 
 - (id)lookUpObjectByGitOid:(const git_oid *)oid objectType:(GTObjectType)type error:(NSError **)error {
-	git_object *obj;
+	GTObjectCache *cache = self.objectCache;
+	git_object *obj = [cache lookUpGitObjectWithOid:oid type:(git_object_t)type inRepository:self.git_repository];
+	if (obj != NULL) return [GTObject objectWithObj:obj inRepository:self];
 
 	int gitError = git_object_lookup(&obj, self.git_repository, oid, (git_object_t)type);
 	if (gitError < GIT_OK) {
@@ -327,13 +367,30 @@ struct GTRemoteCreatePayload {
 		return nil;
 	}
 
+	if (cache != nil) [cache addGitObject:obj];
+
 	return [GTObject objectWithObj:obj inRepository:self];
 }
 
+- (GTOID *)OIDWithGitOid:(const git_oid *)oid {
+	NSParameterAssert(oid != NULL);
+
+	GTOIDPool *pool = self.OIDPool;
+	if (pool != nil) return [pool OIDWithGitOid:oid];
+
+	return [GTOID oidWithGitOid:oid];
+}
+
 - (id)lookUpObjectByGitOid:(const git_oid *)oid error:(NSError **)error {
 	return [self lookUpObjectByGitOid:oid objectType:GTObjectTypeAny error:error];
 }
 
+- (GTCommit *)lookUpLazyCommitByOID:(GTOID *)oid error:(NSError **)error {
+	NSParameterAssert(oid != nil);
+
+	return [[GTCommit alloc] initLazilyWithGitOid:oid.git_oid inRepository:self error:error];
+}
+
 - (id)lookUpObjectByOID:(GTOID *)oid objectType:(GTObjectType)type error:(NSError **)error {
 	return [self lookUpObjectByGitOid:oid.git_oid objectType:type error:error];
 }
@@ -384,7 +441,13 @@ struct GTRemoteCreatePayload {
 
 - (GTReference *)headReferenceWithError:(NSError **)error {
 	git_reference *headRef;
-	int gitError = git_repository_head(&headRef, self.git_repository);
+	GTReferenceCache *cache = self.referenceCache;
+	int gitError = (cache != nil ? [cache lookUpGitReference:&headRef named:@"HEAD" resolve:YES inRepository:self.git_repository] : git_repository_head(&headRef, self.git_repository));
+
+	// Like git_repository_head, report a HEAD pointing to a branch which
+	// doesn't exist yet as unborn.
+	if (cache != nil && gitError == GIT_ENOTFOUND && git_repository_head_unborn(self.git_repository) == 1) gitError = GIT_EUNBORNBRANCH;
+
 	if (gitError != GIT_OK) {
 		NSString *unborn = @"";
 		if (gitError == GIT_EUNBORNBRANCH) {
@@ -453,21 +516,30 @@ typedef void (^GTRepositoryBranchEnumerationBlock)(GTBranch *branch, BOOL *stop)
 }
 
 - (NSArray *)branchesWithPrefix:(NSString *)prefix error:(NSError **)error {
-	NSArray *references = [self referenceNamesWithError:error];
-	if (references == nil) return nil;
+	NSParameterAssert(prefix != nil);
+
+	// Escape the prefix so it's matched literally, and let the glob narrow down
+	// the references read.
+	NSMutableString *glob = [NSMutableString stringWithCapacity:prefix.length + 1];
+	for (NSUInteger i = 0; i < prefix.length; i++) {
+		unichar character = [prefix characterAtIndex:i];
+		if (character == '*' || character == '?' || character == '[' || character == ']' || character == '\\') [glob appendString:@"\\"];
+		[glob appendFormat:@"%C", character];
+	}
+	[glob appendString:@"*"];
 
 	NSMutableArray *branches = [NSMutableArray array];
-	for (NSString *refName in references) {
-		if (![refName hasPrefix:prefix]) continue;
-
-		GTReference *ref = [self lookUpReferenceWithName:refName error:error];
-		if (ref == nil) continue;
+	BOOL success = [self enumerateReferencesMatchingGlob:glob error:error usingBlock:^(GTReferenceEnumerationEntry *entry, BOOL *stop) {
+		GTReference *ref = entry.reference;
+		if (ref == nil) return;
 
 		GTBranch *branch = [[GTBranch alloc] initWithReference:ref];
-		if (branch == nil) continue;
+		if (branch == nil) return;
 
 		[branches addObject:branch];
-	}
+	}];
+
+	if (!success) return nil;
 
 	return branches;
 }
@@ -476,17 +548,23 @@ typedef void (^GTRepositoryBranchEnumerationBlock)(GTBranch *branch, BOOL *stop)
 	NSArray *localBranches = [self localBranchesWithError:error];
 	if (localBranches == nil) return nil;
 
-	NSMutableArray *remoteBranches = [[self remoteBranchesWithError:error] mutableCopy];
+	NSArray *remoteBranches = [self remoteBranchesWithError:error];
 	if (remoteBranches == nil) return nil;
 
-	NSMutableArray *branches = [NSMutableArray array];
-	for (GTBranch *branch in localBranches) {
-		GTBranch *trackingBranch = [branch trackingBranchWithError:NULL success:NULL];
-		if (trackingBranch != nil) [remoteBranches removeObject:trackingBranch];
-		[branches addObject:branch];
+	// Read every upstream at once, instead of asking each local branch for its
+	// tracking branch.
+	GTBranchSnapshot *snapshot = [GTBranchSnapshot branchSnapshotWithRepository:self error:error];
+	if (snapshot == nil) return nil;
+
+	NSMutableSet *trackedBranchNames = [NSMutableSet set];
+	for (GTBranchSnapshotEntry *branch in snapshot.localBranches) {
+		if (branch.upstreamName != nil) [trackedBranchNames addObject:branch.upstreamName];
 	}
 
-	[branches addObjectsFromArray:remoteBranches];
+	NSMutableArray *branches = [localBranches mutableCopy];
+	for (GTBranch *branch in remoteBranches) {
+		if (![trackedBranchNames containsObject:branch.reference.name]) [branches addObject:branch];
+	}
 
 	return branches;
 }
@@ -698,6 +776,19 @@ static int GTRepositoryForeachTagCallback(const char *name, git_oid *oid, void *
 	NSParameterAssert(firstOID != nil);
 	NSParameterAssert(secondOID != nil);
 
+	GTCommitGraph *graph = self.commitGraph;
+	uint32_t firstIndex = (graph != nil ? [graph indexOfGitOid:firstOID.git_oid] : GTCommitGraphNotFound);
+	uint32_t secondIndex = (graph != nil ? [graph indexOfGitOid:secondOID.git_oid] : GTCommitGraphNotFound);
+	if (firstIndex != GTCommitGraphNotFound && secondIndex != GTCommitGraphNotFound) {
+		uint32_t mergeBaseIndex = [graph mergeBaseOfIndex:firstIndex andIndex:secondIndex];
+		if (mergeBaseIndex == GTCommitGraphNotFound) {
+			if (error != NULL) *error = [NSError git_errorFor:GIT_ENOTFOUND description:@"Failed to find merge base between commits %@ and %@.", firstOID.SHA, secondOID.SHA];
+			return nil;
+		}
+
+		return [self lookUpObjectByGitOid:[graph gitOidAtIndex:mergeBaseIndex] objectType:GTObjectTypeCommit error:error];
+	}
+
 	git_oid mergeBase;
 	int errorCode = git_merge_base(&mergeBase, self.git_repository, firstOID.git_oid, secondOID.git_oid);
 	if (errorCode < GIT_OK) {
@@ -934,6 +1025,14 @@ static int submoduleEnumerationCallback(git_submodule *git_submodule, const char
 	NSParameterAssert(headOID != nil);
 	NSParameterAssert(baseOID != nil);
 
+	GTCommitGraph *graph = self.commitGraph;
+	uint32_t headIndex = (graph != nil ? [graph indexOfGitOid:headOID.git_oid] : GTCommitGraphNotFound);
+	uint32_t baseIndex = (graph != nil ? [graph indexOfGitOid:baseOID.git_oid] : GTCommitGraphNotFound);
+	if (headIndex != GTCommitGraphNotFound && baseIndex != GTCommitGraphNotFound) {
+		[graph getAhead:ahead behind:behind ofIndex:headIndex relativeToIndex:baseIndex];
+		return YES;
+	}
+
 	int errorCode = git_graph_ahead_behind(ahead, behind, self.git_repository, headOID.git_oid, baseOID.git_oid);
 	if (errorCode != GIT_OK) {
 		if (error != NULL) *error = [NSError git_errorFor:errorCode description:@"Failed to calculate ahead/behind count of %@ relative to %@", headOID, baseOID];
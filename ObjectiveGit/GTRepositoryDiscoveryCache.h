@@ -0,0 +1,65 @@
+//
+//  GTRepositoryDiscoveryCache.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@class GTRepository;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// Remembers where the repositories opened through it were found, so opening
+/// them again skips discovery.
+///
+/// The first open of a path discovers the repository like
+/// -[GTRepository initWithURL:flags:ceilingDirs:error:]. Later opens of the
+/// same path check with stat(2) that the git directory, and the path's own
+/// `.git` entry, are still the ones found then, and use
+/// -[GTRepository initWithGitDirectoryURL:workingDirectoryURL:error:].
+///
+/// A repository created in a directory between the path and the repository
+/// found for it isn't noticed. Call -removeAllEntries after moving
+/// repositories around.
+///
+/// This class is thread safe.
+@interface GTRepositoryDiscoveryCache : NSObject
+
+/// A cache shared by the whole process.
++ (instancetype)sharedCache;
+
+/// The number of paths whose repository is known.
+@property (readonly, assign) NSUInteger count;
+
+/// The number of opens which skipped discovery.
+@property (readonly, assign) NSUInteger hitCount;
+
+/// The number of opens of paths which weren't known yet.
+@property (readonly, assign) NSUInteger missCount;
+
+/// The number of opens which found the repository of a known path had moved,
+/// and discovered it again.
+@property (readonly, assign) NSUInteger staleCount;
+
+/// Opens the repository containing the given path.
+///
+/// URL            - The file URL to find the repository from. Cannot be nil.
+/// flags          - A combination of the `GTRepositoryOpenFlags` flags.
+/// ceilingDirURLs - URLs at which the search for a containing repository
+///                  should stop, or nil.
+/// error          - The error if one occurs.
+///
+/// Returns the repository, or nil if an error occurred.
+- (GTRepository * _Nullable)openRepositoryAtURL:(NSURL *)URL flags:(NSInteger)flags ceilingDirs:(NSArray<NSURL *> * _Nullable)ceilingDirURLs error:(NSError **)error;
+
+/// Forgets the repository found for the given path, if any.
+- (void)removeEntryForURL:(NSURL *)URL;
+
+/// Forgets every repository.
+- (void)removeAllEntries;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,189 @@
+//
+//  GTRepositoryDiscoveryCache.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTRepositoryDiscoveryCache.h"
+#import "GTRepository.h"
+
+#import <pthread.h>
+#import <sys/stat.h>
+
+// Identifies a file or directory, or its absence.
+typedef struct {
+	BOOL exists;
+	dev_t device;
+	ino_t inode;
+} GTRepositoryDiscoveryFileIdentity;
+
+static GTRepositoryDiscoveryFileIdentity GTRepositoryDiscoveryFileIdentityAtPath(NSString *path) {
+	GTRepositoryDiscoveryFileIdentity identity = { 0 };
+
+	struct stat info;
+	if (stat(path.fileSystemRepresentation, &info) != 0) return identity;
+
+	identity.exists = YES;
+	identity.device = info.st_dev;
+	identity.inode = info.st_ino;
+	return identity;
+}
+
+static BOOL GTRepositoryDiscoveryFileIdentitiesEqual(GTRepositoryDiscoveryFileIdentity first, GTRepositoryDiscoveryFileIdentity second) {
+	return first.exists == second.exists && first.device == second.device && first.inode == second.inode;
+}
+
+// Where the repository for a path was found.
+@interface GTRepositoryDiscoveryEntry : NSObject {
+@public
+	GTRepositoryDiscoveryFileIdentity _gitDirectoryIdentity;
+	GTRepositoryDiscoveryFileIdentity _dotGitIdentity;
+}
+
+@property (nonatomic, copy) NSURL *gitDirectoryURL;
+@property (nonatomic, copy) NSURL *workingDirectoryURL;
+
+@end
+
+@implementation GTRepositoryDiscoveryEntry
+@end
+
+@interface GTRepositoryDiscoveryCache () {
+	pthread_mutex_t _lock;
+}
+
+// Keyed by -keyForPath:flags:ceilingDirs:. Guarded by `_lock`.
+@property (nonatomic, readonly, strong) NSMutableDictionary<NSString *, GTRepositoryDiscoveryEntry *> *entries;
+
+@property (readwrite, assign) NSUInteger hitCount;
+@property (readwrite, assign) NSUInteger missCount;
+@property (readwrite, assign) NSUInteger staleCount;
+
+@end
+
+@implementation GTRepositoryDiscoveryCache
+
+#pragma mark Lifecycle
+
++ (instancetype)sharedCache {
+	static GTRepositoryDiscoveryCache *sharedCache;
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		sharedCache = [[self alloc] init];
+	});
+
+	return sharedCache;
+}
+
+- (instancetype)init {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_entries = [NSMutableDictionary dictionary];
+	pthread_mutex_init(&_lock, NULL);
+
+	return self;
+}
+
+- (void)dealloc {
+	pthread_mutex_destroy(&_lock);
+}
+
+#pragma mark Properties
+
+- (NSUInteger)count {
+	pthread_mutex_lock(&_lock);
+	NSUInteger count = self.entries.count;
+	pthread_mutex_unlock(&_lock);
+
+	return count;
+}
+
+#pragma mark Opening
+
+// The flags and ceilings change what's found for a path, so they're part of
+// the key. The path comes first so entries for a path can be found by prefix.
+- (NSString *)keyForPath:(NSString *)path flags:(NSInteger)flags ceilingDirs:(NSArray<NSURL *> *)ceilingDirURLs {
+	NSString *ceilings = [[ceilingDirURLs valueForKey:@"path"] componentsJoinedByString:@":"] ?: @"";
+	return [NSString stringWithFormat:@"%@%C%ld%C%@", path, (unichar)0, (long)flags, (unichar)0, ceilings];
+}
+
+- (GTRepository *)openRepositoryAtURL:(NSURL *)URL flags:(NSInteger)flags ceilingDirs:(NSArray<NSURL *> *)ceilingDirURLs error:(NSError **)error {
+	NSParameterAssert(URL != nil);
+
+	NSString *path = URL.URLByStandardizingPath.path;
+	if (!URL.isFileURL || path == nil) return [[GTRepository alloc] initWithURL:URL flags:flags ceilingDirs:ceilingDirURLs error:error];
+
+	NSString *key = [self keyForPath:path flags:flags ceilingDirs:ceilingDirURLs];
+	NSString *dotGitPath = [path stringByAppendingPathComponent:@".git"];
+
+	pthread_mutex_lock(&_lock);
+	GTRepositoryDiscoveryEntry *entry = self.entries[key];
+	pthread_mutex_unlock(&_lock);
+
+	if (entry != nil) {
+		BOOL current = GTRepositoryDiscoveryFileIdentitiesEqual(entry->_gitDirectoryIdentity, GTRepositoryDiscoveryFileIdentityAtPath(entry.gitDirectoryURL.path)) && GTRepositoryDiscoveryFileIdentitiesEqual(entry->_dotGitIdentity, GTRepositoryDiscoveryFileIdentityAtPath(dotGitPath));
+		GTRepository *repository = (current ? [[GTRepository alloc] initWithGitDirectoryURL:entry.gitDirectoryURL workingDirectoryURL:entry.workingDirectoryURL error:NULL] : nil);
+
+		pthread_mutex_lock(&_lock);
+		if (repository != nil) {
+			self.hitCount++;
+		} else {
+			self.staleCount++;
+			[self.entries removeObjectForKey:key];
+		}
+		pthread_mutex_unlock(&_lock);
+
+		if (repository != nil) return repository;
+	}
+
+	// Take the identities before discovering, so a change in between shows
+	// up as stale on the next open rather than being missed.
+	GTRepositoryDiscoveryFileIdentity dotGitIdentity = GTRepositoryDiscoveryFileIdentityAtPath(dotGitPath);
+
+	GTRepository *repository = [[GTRepository alloc] initWithURL:URL flags:flags ceilingDirs:ceilingDirURLs error:error];
+	if (repository == nil) return nil;
+
+	GTRepositoryDiscoveryEntry *newEntry = [[GTRepositoryDiscoveryEntry alloc] init];
+	newEntry.gitDirectoryURL = repository.gitDirectoryURL;
+	newEntry.workingDirectoryURL = repository.fileURL;
+	newEntry->_gitDirectoryIdentity = GTRepositoryDiscoveryFileIdentityAtPath(newEntry.gitDirectoryURL.path);
+	newEntry->_dotGitIdentity = dotGitIdentity;
+
+	pthread_mutex_lock(&_lock);
+	if (entry == nil) self.missCount++;
+	if (newEntry.gitDirectoryURL != nil && newEntry->_gitDirectoryIdentity.exists) self.entries[key] = newEntry;
+	pthread_mutex_unlock(&_lock);
+
+	return repository;
+}
+
+#pragma mark Invalidation
+
+- (void)removeEntryForURL:(NSURL *)URL {
+	NSParameterAssert(URL != nil);
+
+	NSString *prefix = [URL.URLByStandardizingPath.path stringByAppendingFormat:@"%C", (unichar)0];
+	if (prefix == nil) return;
+
+	pthread_mutex_lock(&_lock);
+	for (NSString *key in self.entries.allKeys) {
+		if ([key hasPrefix:prefix]) [self.entries removeObjectForKey:key];
+	}
+	pthread_mutex_unlock(&_lock);
+}
+
+- (void)removeAllEntries {
+	pthread_mutex_lock(&_lock);
+	[self.entries removeAllObjects];
+	pthread_mutex_unlock(&_lock);
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> count: %lu, hits: %lu, misses: %lu, stale: %lu", self.class, self, (unsigned long)self.count, (unsigned long)self.hitCount, (unsigned long)self.missCount, (unsigned long)self.staleCount];
+}
+
+@end
@@ -0,0 +1,99 @@
+//
+//  GTRepositoryPool.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@class GTRepository;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A pool of open repositories, for code which works with the same
+/// repositories from many threads at once, like a server.
+///
+/// A GTRepository can only be used by one thread at a time. Instead of
+/// opening a new one for every request, lease one from the pool and return it
+/// when done. Returned repositories are kept open, up to
+/// `maximumIdleRepositoriesPerURL` per repository, and handed out again.
+///
+/// Only the first repository opened for a URL has to discover the repository.
+/// The others are opened straight from its git directory, and share its object
+/// database, so objects read through one are cached for all of them.
+///
+/// Repositories are handed out as they were returned, including any caches or
+/// other properties set on them.
+///
+/// This class is thread safe.
+@interface GTRepositoryPool : NSObject
+
+/// The most repositories kept open for each URL while nobody is using them.
+@property (nonatomic, readonly, assign) NSUInteger maximumIdleRepositoriesPerURL;
+
+/// The number of repositories currently kept open for reuse.
+@property (readonly, assign) NSUInteger idleCount;
+
+/// The number of repositories the pool has opened.
+@property (readonly, assign) NSUInteger openCount;
+
+/// The total time spent opening those repositories.
+@property (readonly, assign) NSTimeInterval totalOpenDuration;
+
+/// The number of leases handed out.
+@property (readonly, assign) NSUInteger leaseCount;
+
+/// The number of leases handed out by reusing an idle repository.
+@property (readonly, assign) NSUInteger reuseCount;
+
+/// The total time spent in -leaseRepositoryAtURL:error:, including opening
+/// repositories.
+@property (readonly, assign) NSTimeInterval totalLeaseDuration;
+
+/// Initializes a pool which keeps up to 4 idle repositories per URL.
+- (instancetype)init;
+
+/// Initializes a pool. Designated initializer.
+///
+/// maximumIdleRepositoriesPerURL - The most repositories to keep open for
+///                                 each URL while nobody is using them.
+- (instancetype)initWithMaximumIdleRepositoriesPerURL:(NSUInteger)maximumIdleRepositoriesPerURL NS_DESIGNATED_INITIALIZER;
+
+/// Leases a repository for the exclusive use of the caller.
+///
+/// Return it with -returnRepository: once done. Repositories which are never
+/// returned are simply closed when released.
+///
+/// URL   - The file URL of the repository, as accepted by
+///         -[GTRepository initWithURL:error:]. Cannot be nil.
+/// error - The error if one occurred.
+///
+/// Returns the repository, or nil if it couldn't be opened.
+- (GTRepository * _Nullable)leaseRepositoryAtURL:(NSURL *)URL error:(NSError **)error;
+
+/// Returns a repository leased from the receiver, so it can be leased again.
+///
+/// The repository must not be used by the caller afterwards.
+///
+/// repository - A repository returned by -leaseRepositoryAtURL:error:. Cannot
+///              be nil.
+- (void)returnRepository:(GTRepository *)repository;
+
+/// Leases a repository for the duration of a block.
+///
+/// URL   - The file URL of the repository. Cannot be nil.
+/// error - The error if one occurred.
+/// block - The block to invoke with the leased repository. Must return
+///         whether it succeeded, setting its `error` if not. The repository
+///         must not be used after the block returns. Cannot be nil.
+///
+/// Returns whether the repository could be opened and the block succeeded.
+- (BOOL)performWithRepositoryAtURL:(NSURL *)URL error:(NSError **)error block:(BOOL (^)(GTRepository *repository, NSError **error))block;
+
+/// Closes every idle repository.
+- (void)removeIdleRepositories;
+
+@end
+
+NS_ASSUME_NONNULL_END
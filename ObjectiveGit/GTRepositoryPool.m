@@ -0,0 +1,214 @@
+//
+//  GTRepositoryPool.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTRepositoryPool.h"
+#import "GTRepository.h"
+#import "NSError+Git.h"
+
+#import "git2/errors.h"
+#import "git2/odb.h"
+#import "git2/repository.h"
+#import "git2/sys/repository.h"
+
+#import <pthread.h>
+
+// What the pool knows about one repository.
+@interface GTRepositoryPoolEntry : NSObject {
+@public
+	// The object database shared by every repository opened after the first.
+	git_odb *_odb;
+}
+
+// The git directory the first repository was discovered at.
+@property (nonatomic, readonly, copy) NSURL *gitDirectoryURL;
+
+// The working directory of the first repository, or nil if it's bare.
+@property (nonatomic, readonly, copy) NSURL *workingDirectoryURL;
+
+// The repositories nobody is using. Guarded by the pool's lock.
+@property (nonatomic, readonly, strong) NSMutableArray<GTRepository *> *idleRepositories;
+
+@end
+
+@implementation GTRepositoryPoolEntry
+
+- (instancetype)initWithRepository:(GTRepository *)repository {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_gitDirectoryURL = [repository.gitDirectoryURL copy];
+	if (_gitDirectoryURL == nil) return nil;
+	_workingDirectoryURL = [repository.fileURL copy];
+	if (git_repository_odb(&_odb, repository.git_repository) != GIT_OK) return nil;
+
+	_idleRepositories = [NSMutableArray array];
+
+	return self;
+}
+
+- (void)dealloc {
+	if (_odb != NULL) git_odb_free(_odb);
+}
+
+@end
+
+@interface GTRepositoryPool () {
+	pthread_mutex_t _lock;
+}
+
+// The known repositories, keyed by the standardized path they were leased
+// with. Guarded by `_lock`.
+@property (nonatomic, readonly, strong) NSMutableDictionary<NSString *, GTRepositoryPoolEntry *> *entries;
+
+// The entries of the repositories currently leased, keyed by identity since
+// different repositories for the same path are equal. Guarded by `_lock`.
+@property (nonatomic, readonly, strong) NSMapTable<GTRepository *, GTRepositoryPoolEntry *> *leasedRepositories;
+
+@property (readwrite, assign) NSUInteger idleCount;
+@property (readwrite, assign) NSUInteger openCount;
+@property (readwrite, assign) NSTimeInterval totalOpenDuration;
+@property (readwrite, assign) NSUInteger leaseCount;
+@property (readwrite, assign) NSUInteger reuseCount;
+@property (readwrite, assign) NSTimeInterval totalLeaseDuration;
+
+@end
+
+@implementation GTRepositoryPool
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	return [self initWithMaximumIdleRepositoriesPerURL:4];
+}
+
+- (instancetype)initWithMaximumIdleRepositoriesPerURL:(NSUInteger)maximumIdleRepositoriesPerURL {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_maximumIdleRepositoriesPerURL = maximumIdleRepositoriesPerURL;
+	_entries = [NSMutableDictionary dictionary];
+	_leasedRepositories = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsWeakMemory | NSPointerFunctionsObjectPointerPersonality valueOptions:NSPointerFunctionsStrongMemory];
+	pthread_mutex_init(&_lock, NULL);
+
+	return self;
+}
+
+- (void)dealloc {
+	pthread_mutex_destroy(&_lock);
+}
+
+#pragma mark Leasing
+
+- (GTRepository *)leaseRepositoryAtURL:(NSURL *)URL error:(NSError **)error {
+	NSParameterAssert(URL != nil);
+
+	CFAbsoluteTime leaseStart = CFAbsoluteTimeGetCurrent();
+	NSString *key = URL.URLByStandardizingPath.path;
+	if (!URL.isFileURL || key == nil) {
+		if (error != NULL) *error = [NSError errorWithDomain:NSCocoaErrorDomain code:NSFileReadUnsupportedSchemeError userInfo:@{ NSLocalizedDescriptionKey: NSLocalizedString(@"Invalid file path URL to open.", @"") }];
+		return nil;
+	}
+
+	pthread_mutex_lock(&_lock);
+	GTRepositoryPoolEntry *entry = self.entries[key];
+	GTRepository *repository = entry.idleRepositories.lastObject;
+	if (repository != nil) {
+		[entry.idleRepositories removeLastObject];
+		self.idleCount--;
+		self.reuseCount++;
+	}
+	pthread_mutex_unlock(&_lock);
+
+	if (repository == nil) {
+		CFAbsoluteTime openStart = CFAbsoluteTimeGetCurrent();
+		repository = [self openRepositoryAtURL:URL entry:entry error:error];
+		if (repository == nil) return nil;
+
+		// The first repository opened for a URL provides the git directory
+		// and object database for the rest.
+		GTRepositoryPoolEntry *newEntry = (entry == nil ? [[GTRepositoryPoolEntry alloc] initWithRepository:repository] : nil);
+
+		pthread_mutex_lock(&_lock);
+		if (self.entries[key] == nil && newEntry != nil) self.entries[key] = newEntry;
+		entry = self.entries[key];
+		self.openCount++;
+		self.totalOpenDuration += CFAbsoluteTimeGetCurrent() - openStart;
+		pthread_mutex_unlock(&_lock);
+	}
+
+	pthread_mutex_lock(&_lock);
+	if (entry != nil) [self.leasedRepositories setObject:entry forKey:repository];
+	self.leaseCount++;
+	self.totalLeaseDuration += CFAbsoluteTimeGetCurrent() - leaseStart;
+	pthread_mutex_unlock(&_lock);
+
+	return repository;
+}
+
+- (GTRepository *)openRepositoryAtURL:(NSURL *)URL entry:(GTRepositoryPoolEntry *)entry error:(NSError **)error {
+	if (entry == nil) return [[GTRepository alloc] initWithURL:URL error:error];
+
+	// The repository was found before, so skip discovering it again.
+	GTRepository *repository = [[GTRepository alloc] initWithGitDirectoryURL:entry.gitDirectoryURL workingDirectoryURL:entry.workingDirectoryURL error:error];
+	if (repository == nil) return nil;
+
+	int gitError = git_repository_set_odb(repository.git_repository, entry->_odb);
+	if (gitError != GIT_OK) {
+		if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to share the object database of %@", URL];
+		return nil;
+	}
+
+	return repository;
+}
+
+- (void)returnRepository:(GTRepository *)repository {
+	NSParameterAssert(repository != nil);
+
+	pthread_mutex_lock(&_lock);
+	GTRepositoryPoolEntry *entry = [self.leasedRepositories objectForKey:repository];
+	[self.leasedRepositories removeObjectForKey:repository];
+	if (entry != nil && entry.idleRepositories.count < self.maximumIdleRepositoriesPerURL) {
+		[entry.idleRepositories addObject:repository];
+		self.idleCount++;
+	}
+	pthread_mutex_unlock(&_lock);
+}
+
+- (BOOL)performWithRepositoryAtURL:(NSURL *)URL error:(NSError **)error block:(BOOL (^)(GTRepository *repository, NSError **error))block {
+	NSParameterAssert(block != nil);
+
+	GTRepository *repository = [self leaseRepositoryAtURL:URL error:error];
+	if (repository == nil) return NO;
+
+	BOOL success = block(repository, error);
+	[self returnRepository:repository];
+
+	return success;
+}
+
+- (void)removeIdleRepositories {
+	NSMutableArray *repositories = [NSMutableArray array];
+
+	pthread_mutex_lock(&_lock);
+	for (GTRepositoryPoolEntry *entry in self.entries.allValues) {
+		[repositories addObjectsFromArray:entry.idleRepositories];
+		[entry.idleRepositories removeAllObjects];
+	}
+	self.idleCount = 0;
+	pthread_mutex_unlock(&_lock);
+
+	// Close them outside the lock.
+	[repositories removeAllObjects];
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> idle: %lu, opened: %lu, leased: %lu, reused: %lu", self.class, self, (unsigned long)self.idleCount, (unsigned long)self.openCount, (unsigned long)self.leaseCount, (unsigned long)self.reuseCount];
+}
+
+@end
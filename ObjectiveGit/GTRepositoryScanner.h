@@ -0,0 +1,157 @@
+//
+//  GTRepositoryScanner.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@class GTCancellationToken;
+@class GTOID;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// What a GTRepositoryScanner finds out about each repository.
+typedef NS_OPTIONS(NSUInteger, GTRepositoryScannerProbes) {
+	/// The branch HEAD points to and the commit it resolves to.
+	GTRepositoryScannerProbeHEAD = 1 << 0,
+
+	/// The names of the local branches.
+	GTRepositoryScannerProbeBranches = 1 << 1,
+
+	/// Whether the working directory has any changes. This reads the status of
+	/// every file, so it's usually the most expensive probe.
+	GTRepositoryScannerProbeWorkingDirectoryClean = 1 << 2,
+
+	/// How far the HEAD branch is ahead of and behind its upstream.
+	GTRepositoryScannerProbeAheadBehind = 1 << 3,
+
+	/// The number of stashes.
+	GTRepositoryScannerProbeStashCount = 1 << 4,
+
+	GTRepositoryScannerProbeAll = GTRepositoryScannerProbeHEAD | GTRepositoryScannerProbeBranches | GTRepositoryScannerProbeWorkingDirectoryClean | GTRepositoryScannerProbeAheadBehind | GTRepositoryScannerProbeStashCount,
+};
+
+/// What a GTRepositoryScanner found out about one repository.
+///
+/// Only the properties of the probes which were run, and which finished, are
+/// set. The others are left at nil, NO or NSNotFound.
+@interface GTRepositoryScanResult : NSObject
+
+/// The directory the repository was found at. This is the working directory,
+/// or the git directory of a bare repository.
+@property (nonatomic, readonly, copy) NSURL *fileURL;
+
+/// The git directory of the repository, or nil if it couldn't be opened.
+@property (nonatomic, readonly, copy) NSURL * _Nullable gitDirectoryURL;
+
+/// The probes which finished.
+@property (nonatomic, readonly, assign) GTRepositoryScannerProbes completedProbes;
+
+/// The error which stopped the remaining probes, or nil if every probe
+/// finished.
+@property (nonatomic, readonly, strong) NSError * _Nullable error;
+
+/// Whether the remaining probes were skipped, or the working directory probe
+/// abandoned, because the scanner's `timeout` had passed.
+@property (nonatomic, readonly, assign, getter=isTimedOut) BOOL timedOut;
+
+/// How long opening and probing the repository took.
+@property (nonatomic, readonly, assign) NSTimeInterval duration;
+
+/// The short name of the branch HEAD points to, or nil if HEAD is detached.
+@property (nonatomic, readonly, copy) NSString * _Nullable HEADBranchName;
+
+/// The commit HEAD resolves to, or nil if HEAD is unborn.
+@property (nonatomic, readonly, strong) GTOID * _Nullable HEADOID;
+
+/// The short names of the local branches, sorted.
+@property (nonatomic, readonly, copy) NSArray<NSString *> * _Nullable branchNames;
+
+/// Whether the working directory has no changes. Always YES for bare
+/// repositories.
+@property (nonatomic, readonly, assign, getter=isWorkingDirectoryClean) BOOL workingDirectoryClean;
+
+/// The full name of the upstream of the HEAD branch, or nil if it has none.
+@property (nonatomic, readonly, copy) NSString * _Nullable upstreamName;
+
+/// The number of commits on the HEAD branch which aren't on its upstream, or
+/// NSNotFound if it has no upstream.
+@property (nonatomic, readonly, assign) NSUInteger ahead;
+
+/// The number of commits on the upstream which aren't on the HEAD branch, or
+/// NSNotFound if it has no upstream.
+@property (nonatomic, readonly, assign) NSUInteger behind;
+
+/// The number of stashes, or NSNotFound if they weren't counted.
+@property (nonatomic, readonly, assign) NSUInteger stashCount;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+@end
+
+/// Finds the repositories under a directory, and probes them in parallel.
+///
+/// Discovery walks the directory tree on one thread and hands every
+/// repository it finds to a bounded pool of workers as soon as it's found, so
+/// probing starts before the walk has finished. Each worker opens its
+/// repository with -[GTRepository initWithGitDirectoryURL:workingDirectoryURL:error:]
+/// where the git directory is a plain `.git` directory, runs the probes and
+/// closes it again.
+///
+/// Configure the scanner before calling -scanWithCancellationToken:resultBlock:completion:.
+/// Changing it while a scan is running affects neither that scan nor its
+/// results.
+@interface GTRepositoryScanner : NSObject
+
+/// The directory to look for repositories under.
+@property (nonatomic, readonly, copy) NSURL *rootURL;
+
+/// The probes to run on every repository. Defaults to
+/// GTRepositoryScannerProbeAll.
+@property (nonatomic, assign) GTRepositoryScannerProbes probes;
+
+/// The most repositories to open and probe at once. Defaults to the number of
+/// active processors.
+@property (nonatomic, assign) NSUInteger maximumConcurrentRepositoryCount;
+
+/// How long to spend on a repository before skipping its remaining probes,
+/// or 0 for no limit. Defaults to 0.
+///
+/// The deadline is checked before each probe, and by the working directory
+/// probe before each file it compares. The other probes run to completion
+/// once they've started.
+@property (nonatomic, assign) NSTimeInterval timeout;
+
+/// Whether to keep looking for repositories inside the working directories of
+/// the repositories found, like vendored checkouts and submodules. Defaults
+/// to NO.
+@property (nonatomic, assign) BOOL scansNestedRepositories;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Initializes the receiver to scan the given directory. Designated
+/// initializer.
+///
+/// rootURL - The file URL of the directory to scan. Cannot be nil.
+- (instancetype)initWithRootURL:(NSURL *)rootURL NS_DESIGNATED_INITIALIZER;
+
+/// Scans for repositories asynchronously.
+///
+/// cancellationToken - The token to stop the scan with, or nil. Repositories
+///                     which haven't been opened yet are skipped, and no
+///                     further results are reported.
+/// resultBlock       - Called with every repository's result as soon as it's
+///                     been probed, in no particular order. Calls are
+///                     serialized, but happen on arbitrary threads. Cannot be
+///                     nil.
+/// completion        - Called once every result has been reported, with the
+///                     number of repositories found and the error if the
+///                     root couldn't be read or the scan was cancelled. Cannot
+///                     be nil.
+- (void)scanWithCancellationToken:(GTCancellationToken * _Nullable)cancellationToken resultBlock:(void (^)(GTRepositoryScanResult *result))resultBlock completion:(void (^)(NSUInteger repositoryCount, NSError * _Nullable error))completion;
+
+@end
+
+NS_ASSUME_NONNULL_END
@@ -0,0 +1,413 @@
+//
+//  GTRepositoryScanner.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTRepositoryScanner.h"
+
+#import "GTBranchSnapshot.h"
+#import "GTCancellationToken.h"
+#import "GTCommit.h"
+#import "GTDiff.h"
+#import "GTOID.h"
+#import "GTReference.h"
+#import "GTRepository.h"
+#import "GTRepository+Stashing.h"
+
+#import "git2/errors.h"
+
+#import <sys/stat.h>
+
+// How a repository was found in a directory.
+typedef NS_ENUM(NSInteger, GTRepositoryScannerLayout) {
+	GTRepositoryScannerLayoutNone = 0,
+
+	// The directory contains a `.git` directory.
+	GTRepositoryScannerLayoutGitDirectory,
+
+	// The directory contains a `.git` file pointing elsewhere, like a worktree
+	// or a submodule.
+	GTRepositoryScannerLayoutGitFile,
+
+	// The directory is a bare repository.
+	GTRepositoryScannerLayoutBare,
+};
+
+static BOOL GTRepositoryScannerStatMatches(NSString *path, mode_t type) {
+	struct stat info;
+	if (lstat(path.fileSystemRepresentation, &info) != 0) return NO;
+
+	return (info.st_mode & S_IFMT) == type;
+}
+
+static GTRepositoryScannerLayout GTRepositoryScannerLayoutAtPath(NSString *path) {
+	struct stat info;
+	if (lstat([path stringByAppendingPathComponent:@".git"].fileSystemRepresentation, &info) == 0) {
+		if (S_ISDIR(info.st_mode)) return GTRepositoryScannerLayoutGitDirectory;
+		if (S_ISREG(info.st_mode)) return GTRepositoryScannerLayoutGitFile;
+	}
+
+	// The same test libgit2 uses to recognize a git directory.
+	if (GTRepositoryScannerStatMatches([path stringByAppendingPathComponent:@"HEAD"], S_IFREG) && GTRepositoryScannerStatMatches([path stringByAppendingPathComponent:@"objects"], S_IFDIR) && GTRepositoryScannerStatMatches([path stringByAppendingPathComponent:@"refs"], S_IFDIR)) {
+		return GTRepositoryScannerLayoutBare;
+	}
+
+	return GTRepositoryScannerLayoutNone;
+}
+
+// A token which cancels itself once a deadline has passed, so libgit2 can
+// abandon a probe halfway through.
+@interface GTRepositoryScannerDeadlineToken : GTCancellationToken
+
+- (instancetype)initWithDeadline:(CFAbsoluteTime)deadline;
+
+@property (nonatomic, readonly, assign) CFAbsoluteTime deadline;
+
+@end
+
+@implementation GTRepositoryScannerDeadlineToken
+
+- (instancetype)initWithDeadline:(CFAbsoluteTime)deadline {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_deadline = deadline;
+
+	return self;
+}
+
+- (BOOL)isCancelled {
+	return super.cancelled || CFAbsoluteTimeGetCurrent() >= self.deadline;
+}
+
+@end
+
+@interface GTRepositoryScanResult ()
+
+@property (nonatomic, readwrite, copy) NSURL *gitDirectoryURL;
+@property (nonatomic, readwrite, assign) GTRepositoryScannerProbes completedProbes;
+@property (nonatomic, readwrite, strong) NSError *error;
+@property (nonatomic, readwrite, assign, getter=isTimedOut) BOOL timedOut;
+@property (nonatomic, readwrite, assign) NSTimeInterval duration;
+@property (nonatomic, readwrite, copy) NSString *HEADBranchName;
+@property (nonatomic, readwrite, strong) GTOID *HEADOID;
+@property (nonatomic, readwrite, copy) NSArray<NSString *> *branchNames;
+@property (nonatomic, readwrite, assign, getter=isWorkingDirectoryClean) BOOL workingDirectoryClean;
+@property (nonatomic, readwrite, copy) NSString *upstreamName;
+@property (nonatomic, readwrite, assign) NSUInteger ahead;
+@property (nonatomic, readwrite, assign) NSUInteger behind;
+@property (nonatomic, readwrite, assign) NSUInteger stashCount;
+
+@end
+
+@implementation GTRepositoryScanResult
+
+- (instancetype)init {
+	NSAssert(NO, @"Call to an unavailable initializer.");
+	return nil;
+}
+
+- (instancetype)initWithFileURL:(NSURL *)fileURL {
+	NSParameterAssert(fileURL != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_fileURL = [fileURL copy];
+	_ahead = NSNotFound;
+	_behind = NSNotFound;
+	_stashCount = NSNotFound;
+
+	return self;
+}
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> fileURL: %@, HEAD: %@ (%@), clean: %i, ahead: %ld, behind: %ld, stashes: %ld, timedOut: %i, error: %@", self.class, self, self.fileURL, self.HEADBranchName, self.HEADOID, self.workingDirectoryClean, (long)self.ahead, (long)self.behind, (long)self.stashCount, self.timedOut, self.error];
+}
+
+@end
+
+@implementation GTRepositoryScanner
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	NSAssert(NO, @"Call to an unavailable initializer.");
+	return nil;
+}
+
+- (instancetype)initWithRootURL:(NSURL *)rootURL {
+	NSParameterAssert(rootURL != nil);
+
+	self = [super init];
+	if (self == nil) return nil;
+
+	_rootURL = [rootURL copy];
+	_probes = GTRepositoryScannerProbeAll;
+	_maximumConcurrentRepositoryCount = NSProcessInfo.processInfo.activeProcessorCount;
+
+	return self;
+}
+
+#pragma mark Scanning
+
+- (void)scanWithCancellationToken:(GTCancellationToken *)cancellationToken resultBlock:(void (^)(GTRepositoryScanResult *))resultBlock completion:(void (^)(NSUInteger, NSError *))completion {
+	NSParameterAssert(resultBlock != nil);
+	NSParameterAssert(completion != nil);
+
+	// Take the configuration now, so it can't change under the scan.
+	NSURL *rootURL = self.rootURL;
+	GTRepositoryScannerProbes probes = self.probes;
+	NSTimeInterval timeout = self.timeout;
+	BOOL scansNestedRepositories = self.scansNestedRepositories;
+
+	NSOperationQueue *workers = [[NSOperationQueue alloc] init];
+	workers.name = @"org.libgit2.ObjectiveGit.scanner";
+	workers.maxConcurrentOperationCount = (NSInteger)MAX(self.maximumConcurrentRepositoryCount, (NSUInteger)1);
+
+	NSObject *resultLock = [[NSObject alloc] init];
+
+	dispatch_async(dispatch_get_global_queue(QOS_CLASS_UTILITY, 0), ^{
+		__block NSUInteger repositoryCount = 0;
+		NSError *error = nil;
+		BOOL success = [self.class enumerateRepositoriesUnderURL:rootURL nested:scansNestedRepositories cancellationToken:cancellationToken error:&error usingBlock:^(NSURL *fileURL, GTRepositoryScannerLayout layout) {
+			repositoryCount++;
+
+			[workers addOperationWithBlock:^{
+				if (cancellationToken.cancelled) return;
+
+				GTRepositoryScanResult *result = [self.class probeRepositoryAtURL:fileURL layout:layout probes:probes timeout:timeout];
+
+				@synchronized (resultLock) {
+					if (!cancellationToken.cancelled) resultBlock(result);
+				}
+			}];
+		}];
+
+		[workers waitUntilAllOperationsAreFinished];
+
+		if (success && cancellationToken.cancelled) error = GTCancellationToken.cancellationError;
+		completion(repositoryCount, (success && error == nil ? nil : error));
+	});
+}
+
+// Walks the directory tree depth first, calling `block` with every repository
+// found. Git directories are never walked into, and working directories only
+// when `nested` is set.
+//
+// Only failing to read the root itself is an error. Unreadable directories
+// further down are skipped.
++ (BOOL)enumerateRepositoriesUnderURL:(NSURL *)rootURL nested:(BOOL)nested cancellationToken:(GTCancellationToken *)cancellationToken error:(NSError **)error usingBlock:(void (^)(NSURL *fileURL, GTRepositoryScannerLayout layout))block {
+	NSArray *keys = @[ NSURLIsDirectoryKey, NSURLIsSymbolicLinkKey ];
+	NSMutableArray<NSURL *> *directories = [NSMutableArray arrayWithObject:rootURL];
+
+	while (directories.count > 0) {
+		if (cancellationToken.cancelled) return YES;
+
+		NSURL *directory = directories.lastObject;
+		[directories removeLastObject];
+
+		GTRepositoryScannerLayout layout = GTRepositoryScannerLayoutAtPath(directory.path);
+		if (layout != GTRepositoryScannerLayoutNone) {
+			block(directory, layout);
+			if (layout == GTRepositoryScannerLayoutBare || !nested) continue;
+		}
+
+		NSError *contentsError = nil;
+		NSArray<NSURL *> *contents = [NSFileManager.defaultManager contentsOfDirectoryAtURL:directory includingPropertiesForKeys:keys options:0 error:&contentsError];
+		if (contents == nil) {
+			if (directory != rootURL) continue;
+
+			if (error != NULL) *error = contentsError;
+			return NO;
+		}
+
+		// Pushed in reverse, so directories are visited in name order.
+		NSArray *sortedContents = [contents sortedArrayUsingComparator:^(NSURL *first, NSURL *second) {
+			return [second.lastPathComponent compare:first.lastPathComponent];
+		}];
+
+		for (NSURL *child in sortedContents) {
+			if ([child.lastPathComponent isEqualToString:@".git"]) continue;
+
+			NSDictionary *values = [child resourceValuesForKeys:keys error:NULL];
+			if (![values[NSURLIsDirectoryKey] boolValue] || [values[NSURLIsSymbolicLinkKey] boolValue]) continue;
+
+			[directories addObject:child];
+		}
+	}
+
+	return YES;
+}
+
+#pragma mark Probing
+
++ (GTRepository *)openRepositoryAtURL:(NSURL *)fileURL layout:(GTRepositoryScannerLayout)layout error:(NSError **)error {
+	switch (layout) {
+		case GTRepositoryScannerLayoutGitDirectory:
+			return [[GTRepository alloc] initWithGitDirectoryURL:[fileURL URLByAppendingPathComponent:@".git" isDirectory:YES] workingDirectoryURL:fileURL error:error];
+
+		case GTRepositoryScannerLayoutBare:
+			return [[GTRepository alloc] initWithGitDirectoryURL:fileURL workingDirectoryURL:nil error:error];
+
+		default:
+			return [[GTRepository alloc] initWithURL:fileURL flags:GTRepositoryOpenNoSearch ceilingDirs:nil error:error];
+	}
+}
+
++ (GTRepositoryScanResult *)probeRepositoryAtURL:(NSURL *)fileURL layout:(GTRepositoryScannerLayout)layout probes:(GTRepositoryScannerProbes)probes timeout:(NSTimeInterval)timeout {
+	CFAbsoluteTime start = CFAbsoluteTimeGetCurrent();
+	CFAbsoluteTime deadline = (timeout > 0 ? start + timeout : DBL_MAX);
+
+	GTRepositoryScanResult *result = [[GTRepositoryScanResult alloc] initWithFileURL:fileURL];
+
+	@autoreleasepool {
+		NSError *error = nil;
+		GTRepository *repository = [self openRepositoryAtURL:fileURL layout:layout error:&error];
+		if (repository == nil) {
+			result.error = error;
+		} else {
+			result.gitDirectoryURL = repository.gitDirectoryURL;
+			if (![self runProbes:probes onRepository:repository deadline:deadline result:result error:&error]) result.error = error;
+		}
+	}
+
+	result.duration = CFAbsoluteTimeGetCurrent() - start;
+	return result;
+}
+
+// Runs the probes in order of cost, so a timeout cuts off the expensive ones.
+//
+// Returns NO if a probe failed. Timing out isn't a failure.
++ (BOOL)runProbes:(GTRepositoryScannerProbes)probes onRepository:(GTRepository *)repository deadline:(CFAbsoluteTime)deadline result:(GTRepositoryScanResult *)result error:(NSError **)error {
+	BOOL (^timedOut)(void) = ^{
+		if (CFAbsoluteTimeGetCurrent() < deadline) return NO;
+
+		result.timedOut = YES;
+		return YES;
+	};
+
+	GTBranchSnapshot *snapshot = nil;
+	if ((probes & (GTRepositoryScannerProbeHEAD | GTRepositoryScannerProbeBranches | GTRepositoryScannerProbeAheadBehind)) != 0) {
+		if (timedOut()) return YES;
+
+		snapshot = [GTBranchSnapshot branchSnapshotWithRepository:repository error:error];
+		if (snapshot == nil) return NO;
+	}
+
+	if ((probes & GTRepositoryScannerProbeHEAD) != 0) {
+		if (timedOut()) return YES;
+
+		result.HEADBranchName = snapshot.HEADBranch.shortName;
+		result.HEADOID = snapshot.HEADBranch.OID;
+		if (result.HEADOID == nil && !repository.HEADUnborn) {
+			GTReference *HEADReference = [repository headReferenceWithError:error];
+			if (HEADReference == nil) return NO;
+
+			result.HEADOID = HEADReference.OID;
+		}
+
+		result.completedProbes |= GTRepositoryScannerProbeHEAD;
+	}
+
+	if ((probes & GTRepositoryScannerProbeBranches) != 0) {
+		result.branchNames = [snapshot.localBranches valueForKey:@"shortName"];
+		result.completedProbes |= GTRepositoryScannerProbeBranches;
+	}
+
+	if ((probes & GTRepositoryScannerProbeStashCount) != 0) {
+		if (timedOut()) return YES;
+
+		__block NSUInteger stashCount = 0;
+		[repository enumerateStashesUsingBlock:^(NSUInteger index, NSString *message, GTOID *OID, BOOL *stop) {
+			stashCount++;
+		}];
+
+		result.stashCount = stashCount;
+		result.completedProbes |= GTRepositoryScannerProbeStashCount;
+	}
+
+	if ((probes & GTRepositoryScannerProbeAheadBehind) != 0) {
+		if (timedOut()) return YES;
+
+		GTBranchSnapshotEntry *HEADBranch = snapshot.HEADBranch;
+		GTBranchSnapshotEntry *upstream = (HEADBranch != nil ? [snapshot upstreamOfBranch:HEADBranch] : nil);
+		if (upstream != nil) {
+			size_t ahead = 0;
+			size_t behind = 0;
+			if (![repository calculateAhead:&ahead behind:&behind ofOID:HEADBranch.OID relativeToOID:upstream.OID error:error]) return NO;
+
+			result.upstreamName = upstream.name;
+			result.ahead = ahead;
+			result.behind = behind;
+		}
+
+		result.completedProbes |= GTRepositoryScannerProbeAheadBehind;
+	}
+
+	if ((probes & GTRepositoryScannerProbeWorkingDirectoryClean) != 0) {
+		if (timedOut()) return YES;
+
+		BOOL clean = YES;
+		if (!repository.bare) {
+			// Diffed rather than read with -enumerateFileStatusWithOptions:,
+			// which computes every status before returning, so the deadline
+			// can stop the diffs between files.
+			GTRepositoryScannerDeadlineToken *deadlineToken = [[GTRepositoryScannerDeadlineToken alloc] initWithDeadline:deadline];
+			NSError *diffError = nil;
+			BOOL success = [self isWorkingDirectoryClean:&clean inRepository:repository cancellationToken:deadlineToken error:&diffError];
+			if (!success && diffError.code == GIT_EUSER && deadlineToken.cancelled) {
+				result.timedOut = YES;
+				return YES;
+			}
+			if (!success) {
+				if (error != NULL) *error = diffError;
+				return NO;
+			}
+		}
+
+		result.workingDirectoryClean = clean;
+		result.completedProbes |= GTRepositoryScannerProbeWorkingDirectoryClean;
+	}
+
+	return YES;
+}
+
+// Compares HEAD to the index, and only if they match, the index to the
+// working directory. Untracked files count as changes and ignored files
+// don't, as in `git status`.
++ (BOOL)isWorkingDirectoryClean:(BOOL *)clean inRepository:(GTRepository *)repository cancellationToken:(GTCancellationToken *)cancellationToken error:(NSError **)error {
+	GTTree *HEADTree = nil;
+	if (!repository.HEADUnborn) {
+		GTReference *HEADReference = [repository headReferenceWithError:error];
+		if (HEADReference == nil) return NO;
+
+		GTCommit *HEADCommit = [repository lookUpObjectByOID:HEADReference.OID objectType:GTObjectTypeCommit error:error];
+		if (HEADCommit == nil) return NO;
+
+		HEADTree = HEADCommit.tree;
+	}
+
+	GTDiff *indexDiff = [GTDiff diffIndexFromTree:HEADTree inRepository:repository options:@{ GTDiffOptionsCancellationTokenKey: cancellationToken } error:error];
+	if (indexDiff == nil) return NO;
+
+	if (indexDiff.deltaCount > 0) {
+		*clean = NO;
+		return YES;
+	}
+
+	// One untracked entry is enough, so untracked directories aren't walked.
+	NSDictionary *options = @{
+		GTDiffOptionsFlagsKey: @(GTDiffOptionsFlagsIncludeUntracked | GTDiffOptionsFlagsEnableFastUntrackedDirs | GTDiffOptionsFlagsSkipBinaryCheck),
+		GTDiffOptionsCancellationTokenKey: cancellationToken,
+	};
+	GTDiff *workingDirectoryDiff = [GTDiff diffIndexToWorkingDirectoryInRepository:repository options:options error:error];
+	if (workingDirectoryDiff == nil) return NO;
+
+	*clean = (workingDirectoryDiff.deltaCount == 0);
+	return YES;
+}
+
+@end
@@ -0,0 +1,82 @@
+//
+//  GTTagTable.h
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import <Foundation/Foundation.h>
+
+@class GTOID;
+@class GTRepository;
+@class GTTag;
+
+NS_ASSUME_NONNULL_BEGIN
+
+/// A tag as recorded by a GTTagTable.
+@interface GTTagTableEntry : NSObject
+
+/// The full reference name of the tag, like `refs/tags/v1.0`.
+@property (nonatomic, readonly, copy) NSString *name;
+
+/// The name of the tag without its `refs/tags/` prefix.
+@property (nonatomic, readonly, copy) NSString *shortName;
+
+/// The object the tag reference points to. For annotated tags this is the
+/// tag object, and for lightweight tags the tagged object itself.
+@property (nonatomic, readonly, strong) GTOID *OID;
+
+/// The object the tag ultimately points to, after peeling every tag object.
+@property (nonatomic, readonly, strong) GTOID *targetOID;
+
+/// Whether the tag is annotated, i.e. `OID` is a tag object.
+@property (nonatomic, readonly, assign, getter=isAnnotated) BOOL annotated;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Looks up the tag object of an annotated tag, with its message and tagger.
+///
+/// error - The error if one occurred.
+///
+/// Returns the tag, or nil if the tag is lightweight or an error occurred.
+- (GTTag * _Nullable)tagWithError:(NSError **)error;
+
+@end
+
+/// Every tag of a repository, with the objects they point to, read without
+/// loading tag objects where possible.
+///
+/// Tags in `packed-refs` come with their peeled target when git recorded it,
+/// which `git gc` and `git pack-refs` do. Only the remaining tags, usually the
+/// few created since the last pack, have their objects read, and only far
+/// enough to find what they point to.
+///
+/// Tables don't change after they're read.
+@interface GTTagTable : NSObject
+
+/// Every tag, sorted by name.
+@property (nonatomic, readonly, copy) NSArray<GTTagTableEntry *> *tags;
+
+/// The number of tags whose object had to be read to find their target.
+@property (nonatomic, readonly, assign) NSUInteger readObjectCount;
+
+/// Reads the tags of the given repository.
+///
+/// repository - The repository to read. Cannot be nil.
+/// error      - The error if one occurred.
+///
+/// Returns the table, or nil if an error occurred.
++ (instancetype _Nullable)tagTableWithRepository:(GTRepository *)repository error:(NSError **)error;
+
+- (instancetype)init NS_UNAVAILABLE;
+
+/// Returns the tag with the given full reference name, or nil if there was no
+/// such tag.
+- (GTTagTableEntry * _Nullable)tagWithName:(NSString *)name;
+
+/// Returns the tags which peel to the given object, sorted by name.
+- (NSArray<GTTagTableEntry *> *)tagsWithTargetOID:(GTOID *)targetOID;
+
+@end
+
+NS_ASSUME_NONNULL_END
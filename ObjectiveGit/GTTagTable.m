@@ -0,0 +1,317 @@
+//
+//  GTTagTable.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+#import "GTTagTable.h"
+#import "GTOID.h"
+#import "GTRepository+Private.h"
+#import "GTTag.h"
+#import "NSError+Git.h"
+
+#import "git2/errors.h"
+#import "git2/odb.h"
+#import "git2/refs.h"
+#import "git2/repository.h"
+
+static NSString * const GTTagTableTagPrefix = @"refs/tags/";
+
+// How many tag objects are followed before giving up on a chain of tags.
+static const NSUInteger GTTagTableMaximumNesting = 10;
+
+// Follows tag objects from `oid` until it reaches another kind of object,
+// reading only the `object` line of every tag.
+static int GTTagTablePeelOID(git_oid *peeled, git_odb *odb, const git_oid *oid) {
+	git_oid current = *oid;
+	for (NSUInteger depth = 0; depth <= GTTagTableMaximumNesting; depth++) {
+		size_t size = 0;
+		git_object_t type = GIT_OBJECT_INVALID;
+		int gitError = git_odb_read_header(&size, &type, odb, &current);
+		if (gitError != GIT_OK) return gitError;
+
+		if (type != GIT_OBJECT_TAG) {
+			*peeled = current;
+			return GIT_OK;
+		}
+
+		git_odb_object *object = NULL;
+		gitError = git_odb_read(&object, odb, &current);
+		if (gitError != GIT_OK) return gitError;
+
+		const char *data = git_odb_object_data(object);
+		size_t length = git_odb_object_size(object);
+		BOOL valid = (length >= 7 + GIT_OID_HEXSZ && memcmp(data, "object ", 7) == 0 && git_oid_fromstrn(&current, data + 7, GIT_OID_HEXSZ) == GIT_OK);
+		git_odb_object_free(object);
+
+		if (!valid) return GIT_ERROR;
+	}
+
+	return GIT_ERROR;
+}
+
+@interface GTTagTableEntry ()
+
+@property (nonatomic, readonly, strong) GTRepository *repository;
+
+@property (nonatomic, readwrite, strong) GTOID *targetOID;
+
+- (instancetype)initWithName:(NSString *)name OID:(GTOID *)OID repository:(GTRepository *)repository NS_DESIGNATED_INITIALIZER;
+
+@end
+
+@implementation GTTagTableEntry
+
+- (instancetype)init {
+	NSAssert(NO, @"Call to an unavailable initializer.");
+	return nil;
+}
+
+- (instancetype)initWithName:(NSString *)name OID:(GTOID *)OID repository:(GTRepository *)repository {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_name = [name copy];
+	_shortName = [name substringFromIndex:GTTagTableTagPrefix.length];
+	_OID = OID;
+	_repository = repository;
+
+	return self;
+}
+
+- (BOOL)isAnnotated {
+	return ![self.OID isEqual:self.targetOID];
+}
+
+- (GTTag *)tagWithError:(NSError **)error {
+	if (!self.annotated) return nil;
+
+	return [self.repository lookUpObjectByGitOid:self.OID.git_oid objectType:GTObjectTypeTag error:error];
+}
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> name: %@, OID: %@, targetOID: %@", self.class, self, self.name, self.OID, self.targetOID];
+}
+
+@end
+
+@interface GTTagTable ()
+
+// Every tag, keyed by full reference name.
+@property (nonatomic, readonly, copy) NSDictionary<NSString *, GTTagTableEntry *> *tagsByName;
+
+// The tags peeling to each object, keyed by the object's OID.
+@property (nonatomic, readonly, copy) NSDictionary<GTOID *, NSArray<GTTagTableEntry *> *> *tagsByTargetOID;
+
+@end
+
+@implementation GTTagTable
+
+#pragma mark Lifecycle
+
+- (instancetype)init {
+	NSAssert(NO, @"Call to an unavailable initializer.");
+	return nil;
+}
+
+- (instancetype)initWithTags:(NSArray *)tags readObjectCount:(NSUInteger)readObjectCount {
+	self = [super init];
+	if (self == nil) return nil;
+
+	_tags = [tags sortedArrayUsingDescriptors:@[ [NSSortDescriptor sortDescriptorWithKey:@"name" ascending:YES selector:@selector(compare:)] ]];
+	_readObjectCount = readObjectCount;
+
+	NSMutableDictionary *tagsByName = [NSMutableDictionary dictionaryWithCapacity:_tags.count];
+	NSMutableDictionary *tagsByTargetOID = [NSMutableDictionary dictionaryWithCapacity:_tags.count];
+	for (GTTagTableEntry *tag in _tags) {
+		tagsByName[tag.name] = tag;
+
+		NSMutableArray *targetTags = tagsByTargetOID[tag.targetOID];
+		if (targetTags == nil) {
+			targetTags = [NSMutableArray array];
+			tagsByTargetOID[tag.targetOID] = targetTags;
+		}
+		[targetTags addObject:tag];
+	}
+
+	_tagsByName = [tagsByName copy];
+	_tagsByTargetOID = [tagsByTargetOID copy];
+
+	return self;
+}
+
++ (instancetype)tagTableWithRepository:(GTRepository *)repository error:(NSError **)error {
+	NSParameterAssert(repository != nil);
+
+	NSMutableDictionary<NSString *, GTOID *> *packedOIDs = [NSMutableDictionary dictionary];
+	NSMutableDictionary<NSString *, GTOID *> *packedTargetOIDs = [NSMutableDictionary dictionary];
+	NSString *packedRefsPath = [@(git_repository_commondir(repository.git_repository)) stringByAppendingPathComponent:@"packed-refs"];
+	[self readPackedRefsAtPath:packedRefsPath repository:repository OIDs:packedOIDs targetOIDs:packedTargetOIDs];
+
+	git_reference_iterator *iterator = NULL;
+	int gitError = git_reference_iterator_glob_new(&iterator, repository.git_repository, "refs/tags/*");
+	if (gitError != GIT_OK) {
+		if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to iterate tags"];
+		return nil;
+	}
+
+	NSMutableArray<GTTagTableEntry *> *tags = [NSMutableArray array];
+	NSMutableArray<GTTagTableEntry *> *unpeeledTags = [NSMutableArray array];
+
+	git_reference *reference = NULL;
+	while ((gitError = git_reference_next(&reference, iterator)) == GIT_OK) {
+		git_reference *resolved = NULL;
+		if (git_reference_type(reference) == GIT_REFERENCE_SYMBOLIC && git_reference_resolve(&resolved, reference) != GIT_OK) {
+			git_reference_free(reference);
+			continue;
+		}
+
+		NSString *name = @(git_reference_name(reference));
+		GTOID *OID = [repository OIDWithGitOid:git_reference_target(resolved ?: reference)];
+		GTTagTableEntry *tag = [[GTTagTableEntry alloc] initWithName:name OID:OID repository:repository];
+		[tags addObject:tag];
+
+		// Only trust packed-refs if the reference still points where it did
+		// when it was packed.
+		if ([packedOIDs[name] isEqual:OID]) tag.targetOID = packedTargetOIDs[name];
+		if (tag.targetOID == nil) [unpeeledTags addObject:tag];
+
+		git_reference_free(resolved);
+		git_reference_free(reference);
+	}
+
+	git_reference_iterator_free(iterator);
+
+	if (gitError != GIT_ITEROVER) {
+		if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to iterate tags"];
+		return nil;
+	}
+
+	NSUInteger readObjectCount = [self peelTags:unpeeledTags inRepository:repository error:error];
+	if (readObjectCount == NSNotFound) return nil;
+
+	return [[self alloc] initWithTags:tags readObjectCount:readObjectCount];
+}
+
+#pragma mark Reading
+
+// Collects the tags in packed-refs, and their peeled targets.
+//
+// A `# pack-refs with: peeled` header promises every tag is followed by a `^`
+// line with its target if, and only if, it's annotated. Without it, only the
+// tags which have a `^` line are peeled. A missing or unreadable file has no
+// tags.
++ (void)readPackedRefsAtPath:(NSString *)path repository:(GTRepository *)repository OIDs:(NSMutableDictionary *)OIDs targetOIDs:(NSMutableDictionary *)targetOIDs {
+	NSData *data = [NSData dataWithContentsOfFile:path options:NSDataReadingMappedIfSafe error:NULL];
+	if (data == nil) return;
+
+	const char *bytes = data.bytes;
+	const char *end = bytes + data.length;
+	const char *tagPrefix = GTTagTableTagPrefix.UTF8String;
+	size_t tagPrefixLength = strlen(tagPrefix);
+
+	BOOL peeled = NO;
+	NSString *lastTagName = nil;
+	for (const char *line = bytes; line < end;) {
+		const char *lineEnd = memchr(line, '\n', end - line) ?: end;
+		size_t length = lineEnd - line;
+		if (length > 0 && line[length - 1] == '\r') length--;
+
+		if (line == bytes && length > 0 && line[0] == '#') {
+			NSString *header = [[NSString alloc] initWithBytes:line length:length encoding:NSUTF8StringEncoding];
+			NSArray *traits = [header componentsSeparatedByString:@" "];
+			peeled = [traits containsObject:@"peeled"] || [traits containsObject:@"fully-peeled"];
+		} else if (length == 1 + GIT_OID_HEXSZ && line[0] == '^') {
+			git_oid oid;
+			if (lastTagName != nil && git_oid_fromstrn(&oid, line + 1, GIT_OID_HEXSZ) == GIT_OK) targetOIDs[lastTagName] = [repository OIDWithGitOid:&oid];
+			lastTagName = nil;
+		} else if (length > GIT_OID_HEXSZ + 1 + tagPrefixLength && line[GIT_OID_HEXSZ] == ' ' && memcmp(line + GIT_OID_HEXSZ + 1, tagPrefix, tagPrefixLength) == 0) {
+			git_oid oid;
+			NSString *name = [[NSString alloc] initWithBytes:line + GIT_OID_HEXSZ + 1 length:length - GIT_OID_HEXSZ - 1 encoding:NSUTF8StringEncoding];
+			if (name != nil && git_oid_fromstrn(&oid, line, GIT_OID_HEXSZ) == GIT_OK) {
+				GTOID *OID = [repository OIDWithGitOid:&oid];
+				OIDs[name] = OID;
+				if (peeled) targetOIDs[name] = OID;
+				lastTagName = name;
+			} else {
+				lastTagName = nil;
+			}
+		} else {
+			lastTagName = nil;
+		}
+
+		line = lineEnd + 1;
+	}
+}
+
+// Reads the objects of the given tags to fill in their targets.
+//
+// Objects are read in OID order, which keeps reads from the same pack close
+// together, and each object only once. Objects which aren't tags are only
+// read as far as their header.
+//
+// Returns the number of objects read, or NSNotFound if an error occurred.
++ (NSUInteger)peelTags:(NSArray<GTTagTableEntry *> *)tags inRepository:(GTRepository *)repository error:(NSError **)error {
+	if (tags.count == 0) return 0;
+
+	git_odb *odb = NULL;
+	int gitError = git_repository_odb(&odb, repository.git_repository);
+	if (gitError != GIT_OK) {
+		if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to open the object database"];
+		return NSNotFound;
+	}
+
+	NSArray *sortedTags = [tags sortedArrayUsingComparator:^(GTTagTableEntry *first, GTTagTableEntry *second) {
+		int comparison = git_oid_cmp(first.OID.git_oid, second.OID.git_oid);
+		return (comparison < 0 ? NSOrderedAscending : (comparison > 0 ? NSOrderedDescending : NSOrderedSame));
+	}];
+
+	NSUInteger readObjectCount = 0;
+	GTTagTableEntry *previousTag = nil;
+	for (GTTagTableEntry *tag in sortedTags) {
+		if ([tag.OID isEqual:previousTag.OID]) {
+			tag.targetOID = previousTag.targetOID;
+			continue;
+		}
+
+		readObjectCount++;
+
+		git_oid target;
+		gitError = GTTagTablePeelOID(&target, odb, tag.OID.git_oid);
+		if (gitError != GIT_OK) {
+			git_odb_free(odb);
+			if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to peel tag %@", tag.name];
+			return NSNotFound;
+		}
+
+		tag.targetOID = (git_oid_equal(&target, tag.OID.git_oid) ? tag.OID : [repository OIDWithGitOid:&target]);
+		previousTag = tag;
+	}
+
+	git_odb_free(odb);
+
+	return readObjectCount;
+}
+
+#pragma mark Lookups
+
+- (GTTagTableEntry *)tagWithName:(NSString *)name {
+	NSParameterAssert(name != nil);
+
+	return self.tagsByName[name];
+}
+
+- (NSArray<GTTagTableEntry *> *)tagsWithTargetOID:(GTOID *)targetOID {
+	NSParameterAssert(targetOID != nil);
+
+	return self.tagsByTargetOID[targetOID] ?: @[];
+}
+
+#pragma mark NSObject
+
+- (NSString *)description {
+	return [NSString stringWithFormat:@"<%@: %p> count: %lu, readObjectCount: %lu", self.class, self, (unsigned long)self.tags.count, (unsigned long)self.readObjectCount];
+}
+
+@end
@@ -33,6 +33,7 @@
 
 @class GTTreeEntry;
 @class GTIndex;
+@class GTOIDSet;
 
 typedef NS_ENUM(NSInteger, GTTreeEnumerationOptions) {
 	GTTreeEnumerationOptionPre = GIT_TREEWALK_PRE, // Walk the tree in pre-order (subdirectories come first)
@@ -88,6 +89,18 @@ NS_ASSUME_NONNULL_BEGIN
 /// Returns `YES` if the enumeration completed successfully, `NO` otherwise.
 - (BOOL)enumerateEntriesWithOptions:(GTTreeEnumerationOptions)options error:(NSError **)error block:(BOOL (^)(GTTreeEntry *entry, NSString *root, BOOL *stop))block;
 
+/// Adds the object IDs of the tree's entries to a set without creating any
+/// GTTreeEntry objects.
+///
+/// set       - The set to add the object IDs to. Cannot be nil.
+/// recursive - Whether to descend into subtrees. Subtrees whose ID is already
+///             in `set` are not descended into again, so the same set can be
+///             reused across many trees to collect all reachable objects.
+/// error     - The error if one occurred.
+///
+/// Returns whether the walk completed successfully.
+- (BOOL)addEntryOIDsToSet:(GTOIDSet *)set recursive:(BOOL)recursive error:(NSError **)error;
+
 /// Merges the given tree into the receiver in memory and produces the result as
 /// an index.
 ///
@@ -31,6 +31,7 @@
 #import "GTTreeEntry.h"
 #import "GTRepository.h"
 #import "GTIndex.h"
+#import "GTOIDSet.h"
 #import "NSError+Git.h"
 
 #import "git2/errors.h"
@@ -130,6 +131,42 @@ static int treewalk_cb(const char *root, const git_tree_entry *git_entry, void *
 	return YES;
 }
 
+static int treeOIDWalkCallback(const char *root, const git_tree_entry *git_entry, void *payload) {
+	GTOIDSet *set = (__bridge GTOIDSet *)payload;
+	BOOL added = NO;
+	if (![set addGitOid:git_tree_entry_id(git_entry) added:&added]) return GIT_EUSER;
+
+	// Skip subtrees we've already seen.
+	return (added ? 0 : 1);
+}
+
+- (BOOL)addEntryOIDsToSet:(GTOIDSet *)set recursive:(BOOL)recursive error:(NSError **)error {
+	NSParameterAssert(set != nil);
+
+	if (!recursive) {
+		size_t count = git_tree_entrycount(self.git_tree);
+		for (size_t i = 0; i < count; i++) {
+			if (![set addGitOid:git_tree_entry_id(git_tree_entry_byindex(self.git_tree, i)) added:NULL]) {
+				if (error != NULL) *error = [NSError git_errorFor:GIT_ERROR description:@"Failed to grow the set for the entries of tree %@", self.SHA];
+				return NO;
+			}
+		}
+		return YES;
+	}
+
+	int gitError = git_tree_walk(self.git_tree, GIT_TREEWALK_PRE, treeOIDWalkCallback, (__bridge void *)set);
+	if (gitError == GIT_EUSER) {
+		if (error != NULL) *error = [NSError git_errorFor:GIT_ERROR description:@"Failed to grow the set for the entries of tree %@", self.SHA];
+		return NO;
+	}
+	if (gitError != GIT_OK) {
+		if (error != NULL) *error = [NSError git_errorFor:gitError description:@"Failed to collect entries of tree %@", self.SHA];
+		return NO;
+	}
+
+	return YES;
+}
+
 - (NSArray *)entries {
 	__block NSMutableArray *entries = [NSMutableArray array];
 	BOOL success = [self enumerateEntriesWithOptions:GTTreeEnumerationOptionPre error:nil block:^(GTTreeEntry *entry, NSString *root, BOOL *stop) {
@@ -31,6 +31,7 @@
 #import "GTObject.h"
 #import "GTTree.h"
 #import "GTRepository.h"
+#import "GTRepository+Private.h"
 #import "NSError+Git.h"
 #import "NSString+Git.h"
 #import "GTOID.h"
@@ -104,7 +105,7 @@
 }
 
 - (GTOID *)OID {
-	return [GTOID oidWithGitOid:git_tree_entry_id(self.git_tree_entry)];
+	return [self.repository OIDWithGitOid:git_tree_entry_id(self.git_tree_entry)];
 }
 
 - (NSString *)SHA {
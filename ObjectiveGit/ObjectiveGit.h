@@ -42,8 +42,16 @@ FOUNDATION_EXPORT const unsigned char ObjectiveGitVersionString[];
 #import <ObjectiveGit/GTRepository+Reset.h>
 #import <ObjectiveGit/GTRepository+Pull.h>
 #import <ObjectiveGit/GTRepository+Merging.h>
+#import <ObjectiveGit/GTRepository+Async.h>
+#import <ObjectiveGit/GTRepositoryPool.h>
+#import <ObjectiveGit/GTRepositoryDiscoveryCache.h>
+#import <ObjectiveGit/GTRepositoryScanner.h>
 #import <ObjectiveGit/GTEnumerator.h>
+#import <ObjectiveGit/GTPrefetchingEnumerator.h>
 #import <ObjectiveGit/GTCommit.h>
+#import <ObjectiveGit/GTCommitCountCache.h>
+#import <ObjectiveGit/GTCommitFilter.h>
+#import <ObjectiveGit/GTCommitGraph.h>
 #import <ObjectiveGit/GTCredential.h>
 #import <ObjectiveGit/GTSignature.h>
 #import <ObjectiveGit/GTTree.h>
@@ -53,16 +61,24 @@ FOUNDATION_EXPORT const unsigned char ObjectiveGitVersionString[];
 #import <ObjectiveGit/GTBlame.h>
 #import <ObjectiveGit/GTBlameHunk.h>
 #import <ObjectiveGit/GTTag.h>
+#import <ObjectiveGit/GTTagTable.h>
 #import <ObjectiveGit/GTIndex.h>
 #import <ObjectiveGit/GTIndexEntry.h>
 #import <ObjectiveGit/GTReference.h>
+#import <ObjectiveGit/GTReferenceCache.h>
 #import <ObjectiveGit/GTBranch.h>
+#import <ObjectiveGit/GTBranchSnapshot.h>
+#import <ObjectiveGit/GTCancellationToken.h>
 #import <ObjectiveGit/GTObject.h>
+#import <ObjectiveGit/GTObjectCache.h>
 #import <ObjectiveGit/GTRemote.h>
 #import <ObjectiveGit/GTConfiguration.h>
 #import <ObjectiveGit/GTReflog.h>
 #import <ObjectiveGit/GTReflogEntry.h>
 #import <ObjectiveGit/GTOID.h>
+#import <ObjectiveGit/GTOIDSet.h>
+#import <ObjectiveGit/GTOIDMap.h>
+#import <ObjectiveGit/GTOIDPool.h>
 #import <ObjectiveGit/GTSubmodule.h>
 #import <ObjectiveGit/GTStatusDelta.h>
 #import <ObjectiveGit/GTRepository+Blame.h>
@@ -74,6 +90,7 @@ FOUNDATION_EXPORT const unsigned char ObjectiveGitVersionString[];
 #import <ObjectiveGit/GTCheckoutOptions.h>
 
 #import <ObjectiveGit/GTObjectDatabase.h>
+#import <ObjectiveGit/GTOIDAbbreviationIndex.h>
 #import <ObjectiveGit/GTOdbObject.h>
 
 #import <ObjectiveGit/NSError+Git.h>
@@ -83,8 +100,12 @@ FOUNDATION_EXPORT const unsigned char ObjectiveGitVersionString[];
 #import <ObjectiveGit/NSArray+StringArray.h>
 
 #import <ObjectiveGit/GTDiff.h>
+#import <ObjectiveGit/GTDiff+Parallel.h>
 #import <ObjectiveGit/GTDiffDelta.h>
+#import <ObjectiveGit/GTDiffDeltaTable.h>
 #import <ObjectiveGit/GTDiffFile.h>
 #import <ObjectiveGit/GTDiffHunk.h>
 #import <ObjectiveGit/GTDiffLine.h>
 #import <ObjectiveGit/GTDiffPatch.h>
+#import <ObjectiveGit/GTDiffStats.h>
+#import <ObjectiveGit/GTDiffWriter.h>
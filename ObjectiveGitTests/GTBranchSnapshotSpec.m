@@ -0,0 +1,92 @@
+//
+//  GTBranchSnapshotSpec.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+@import ObjectiveGit;
+@import Nimble;
+@import Quick;
+
+#import "QuickSpec+GTFixtures.h"
+
+QuickSpecBegin(GTBranchSnapshotSpec)
+
+__block GTRepository *repository;
+__block GTBranchSnapshot *snapshot;
+
+beforeEach(^{
+	repository = self.testAppForkFixtureRepository;
+	expect(repository).notTo(beNil());
+
+	NSError *error = nil;
+	snapshot = [GTBranchSnapshot branchSnapshotWithRepository:repository error:&error];
+	expect(snapshot).notTo(beNil());
+	expect(error).to(beNil());
+});
+
+it(@"should match the local branches and their tracking branches", ^{
+	NSArray *localBranches = [repository localBranchesWithError:NULL];
+	expect(@(snapshot.localBranches.count)).to(equal(@(localBranches.count)));
+
+	for (GTBranch *branch in localBranches) {
+		GTBranchSnapshotEntry *entry = [snapshot branchWithName:branch.reference.name];
+		expect(entry).notTo(beNil());
+		expect(entry.shortName).to(equal(branch.shortName));
+		expect(@(entry.branchType)).to(equal(@(GTBranchTypeLocal)));
+		expect(entry.OID).to(equal(branch.OID));
+		expect(@(entry.HEAD)).to(equal(@(branch.HEAD)));
+
+		GTBranch *trackingBranch = [branch trackingBranchWithError:NULL success:NULL];
+		if (trackingBranch == nil) {
+			expect([snapshot upstreamOfBranch:entry]).to(beNil());
+		} else {
+			expect([snapshot upstreamOfBranch:entry].name).to(equal(trackingBranch.reference.name));
+		}
+	}
+});
+
+it(@"should match the remote branches", ^{
+	NSArray *remoteBranches = [repository remoteBranchesWithError:NULL];
+	expect(@(snapshot.remoteBranches.count)).to(equal(@(remoteBranches.count)));
+
+	for (GTBranch *branch in remoteBranches) {
+		GTBranchSnapshotEntry *entry = [snapshot branchWithName:branch.reference.name];
+		expect(entry).notTo(beNil());
+		expect(@(entry.branchType)).to(equal(@(GTBranchTypeRemote)));
+		expect(entry.OID).to(equal(branch.OID));
+		expect(entry.upstreamName).to(beNil());
+		expect(@(entry.HEAD)).to(beFalsy());
+	}
+});
+
+it(@"should sort local branches before remote branches", ^{
+	NSArray *localNames = [snapshot.localBranches valueForKey:@"name"];
+	expect(localNames).to(equal([localNames sortedArrayUsingSelector:@selector(compare:)]));
+
+	NSArray *expectedBranches = [snapshot.localBranches arrayByAddingObjectsFromArray:snapshot.remoteBranches];
+	expect(snapshot.branches).to(equal(expectedBranches));
+});
+
+it(@"should find the branch HEAD points to", ^{
+	GTReference *HEAD = [repository headReferenceWithError:NULL];
+	expect(snapshot.HEADBranch.name).to(equal(HEAD.name));
+	expect(@(snapshot.HEADBranch.HEAD)).to(beTruthy());
+});
+
+it(@"should find the branches tracking a remote branch", ^{
+	GTBranchSnapshotEntry *branchA = [snapshot branchWithName:@"refs/heads/BranchA"];
+	expect(branchA.upstreamName).notTo(beNil());
+
+	GTBranchSnapshotEntry *upstream = [snapshot upstreamOfBranch:branchA];
+	expect(upstream).notTo(beNil());
+	expect([snapshot branchesTrackingBranch:upstream]).to(contain(branchA));
+	expect([snapshot branchesTrackingBranch:branchA]).to(beEmpty());
+});
+
+afterEach(^{
+	[self tearDown];
+});
+
+QuickSpecEnd
@@ -0,0 +1,96 @@
+//
+//  GTCommitCountCacheSpec.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+@import ObjectiveGit;
+@import Nimble;
+@import Quick;
+
+#import "QuickSpec+GTFixtures.h"
+
+QuickSpecBegin(GTCommitCountCacheSpec)
+
+__block GTRepository *repository;
+__block GTCommitCountCache *cache;
+
+beforeEach(^{
+	repository = self.testAppFixtureRepository;
+	expect(repository).notTo(beNil());
+
+	cache = [GTCommitCountCache commitCountCacheForRepository:repository];
+	expect(cache.fileURL).to(equal([GTCommitCountCache defaultFileURLForRepository:repository]));
+	repository.commitCountCache = cache;
+});
+
+it(@"should count with a full walk, then from the cache", ^{
+	NSError *error = nil;
+	expect(@([repository numberOfCommitsInCurrentBranch:&error])).to(equal(@164));
+	expect(error).to(beNil());
+	expect(@(cache.fullWalkCount)).to(equal(@1));
+
+	expect(@([repository numberOfCommitsInCurrentBranch:&error])).to(equal(@164));
+	expect(error).to(beNil());
+	expect(@(cache.fullWalkCount)).to(equal(@1));
+	expect(@(cache.hitCount)).to(equal(@1));
+});
+
+it(@"should only count new commits after a fast-forward", ^{
+	GTBranch *branch = [repository currentBranchWithError:NULL];
+	expect(@([branch numberOfCommitsWithError:NULL])).to(equal(@164));
+
+	GTCommit *tip = [branch targetCommitWithError:NULL];
+	GTCommit *commit = [repository createCommitWithTree:tip.tree message:@"New commit" parents:@[ tip ] updatingReferenceNamed:branch.reference.name error:NULL];
+	expect(commit).notTo(beNil());
+
+	branch = [repository currentBranchWithError:NULL];
+	NSError *error = nil;
+	expect(@([branch numberOfCommitsWithError:&error])).to(equal(@165));
+	expect(error).to(beNil());
+	expect(@(cache.extensionCount)).to(equal(@1));
+	expect(@(cache.fullWalkCount)).to(equal(@1));
+
+	// No reference points at the old tip anymore, so its count is gone.
+	[cache save];
+	GTCommitCountCache *reloadedCache = [[GTCommitCountCache alloc] initWithFileURL:cache.fileURL];
+	expect(@([reloadedCache numberOfCommitsReachableFromOID:commit.OID referenceName:nil inRepository:repository error:NULL])).to(equal(@165));
+	expect(@([reloadedCache numberOfCommitsReachableFromOID:tip.OID referenceName:nil inRepository:repository error:NULL])).to(equal(@164));
+	expect(@(reloadedCache.hitCount)).to(equal(@1));
+	expect(@(reloadedCache.fullWalkCount)).to(equal(@1));
+});
+
+it(@"should walk everything after a non-fast-forward", ^{
+	GTBranch *branch = [repository currentBranchWithError:NULL];
+	expect(@([branch numberOfCommitsWithError:NULL])).to(equal(@164));
+
+	GTCommit *tip = [branch targetCommitWithError:NULL];
+	GTCommit *amended = [repository createCommitWithTree:tip.tree message:@"Amended commit" parents:tip.parents updatingReferenceNamed:branch.reference.name error:NULL];
+	expect(amended).notTo(beNil());
+
+	branch = [repository currentBranchWithError:NULL];
+	expect(@([branch numberOfCommitsWithError:NULL])).to(equal(@164));
+	expect(@(cache.extensionCount)).to(equal(@0));
+	expect(@(cache.fullWalkCount)).to(equal(@2));
+});
+
+it(@"should persist counts", ^{
+	expect(@([repository numberOfCommitsInCurrentBranch:NULL])).to(equal(@164));
+	[cache save];
+
+	GTCommitCountCache *reloadedCache = [[GTCommitCountCache alloc] initWithFileURL:cache.fileURL];
+	GTBranch *branch = [repository currentBranchWithError:NULL];
+	expect(@([reloadedCache numberOfCommitsReachableFromOID:branch.OID referenceName:nil inRepository:repository error:NULL])).to(equal(@164));
+	expect(@(reloadedCache.hitCount)).to(equal(@1));
+
+	[reloadedCache removeAllCounts];
+	expect(@([NSFileManager.defaultManager fileExistsAtPath:cache.fileURL.path])).to(beFalsy());
+});
+
+afterEach(^{
+	repository.commitCountCache = nil;
+	[self tearDown];
+});
+
+QuickSpecEnd
@@ -0,0 +1,147 @@
+//
+//  GTCommitFilterSpec.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+@import ObjectiveGit;
+@import Nimble;
+@import Quick;
+
+#import "QuickSpec+GTFixtures.h"
+
+QuickSpecBegin(GTCommitFilterSpec)
+
+__block GTCommitFilter *filter;
+__block BOOL (^matches)(NSString *rawCommit);
+
+beforeEach(^{
+	filter = [[GTCommitFilter alloc] init];
+
+	matches = ^(NSString *rawCommit) {
+		NSData *data = [rawCommit dataUsingEncoding:NSUTF8StringEncoding];
+		return [filter matchesCommitBytes:data.bytes length:data.length];
+	};
+});
+
+NSString *rawCommit = @"tree 4b825dc642cb6eb9a060e54bf8d69288fbee4904\n"
+	"parent 8496071c1b46c854b31185ea97743be6a8774479\n"
+	"parent 5b5b025afb0b4c913b4c338a42934a3863bf3644\n"
+	"author Jane Doe <Jane@Example.com> 1500000000 +0100\n"
+	"committer Bob <bob@example.org> 1600000000 -0700\n"
+	"\n"
+	"Fix the bug\n"
+	"\n"
+	"Details here\n";
+
+it(@"should match everything by default", ^{
+	expect(@(matches(rawCommit))).to(beTruthy());
+	expect(@(matches(@""))).to(beTruthy());
+});
+
+it(@"should match emails case insensitively", ^{
+	filter.authorEmail = @"jane@example.com";
+	expect(@(matches(rawCommit))).to(beTruthy());
+
+	filter.committerEmail = @"jane@example.com";
+	expect(@(matches(rawCommit))).to(beFalsy());
+
+	filter.committerEmail = @"bob@example.org";
+	expect(@(matches(rawCommit))).to(beTruthy());
+});
+
+it(@"should match a window of committer dates", ^{
+	filter.since = [NSDate dateWithTimeIntervalSince1970:1600000000];
+	filter.until = [NSDate dateWithTimeIntervalSince1970:1600000000];
+	expect(@(matches(rawCommit))).to(beTruthy());
+
+	filter.since = [NSDate dateWithTimeIntervalSince1970:1600000001];
+	filter.until = nil;
+	expect(@(matches(rawCommit))).to(beFalsy());
+
+	filter.since = nil;
+	filter.until = [NSDate dateWithTimeIntervalSince1970:1599999999];
+	expect(@(matches(rawCommit))).to(beFalsy());
+});
+
+it(@"should match parent counts", ^{
+	filter.minimumParentCount = 2;
+	expect(@(matches(rawCommit))).to(beTruthy());
+
+	filter.maximumParentCount = 1;
+	expect(@(matches(rawCommit))).to(beFalsy());
+});
+
+it(@"should match a message pattern on any line", ^{
+	NSError *error = nil;
+	expect(@([filter setMessagePattern:@"^details" caseInsensitive:YES error:&error])).to(beTruthy());
+	expect(error).to(beNil());
+	expect(@(matches(rawCommit))).to(beTruthy());
+
+	expect(@([filter setMessagePattern:@"^details" caseInsensitive:NO error:&error])).to(beTruthy());
+	expect(@(matches(rawCommit))).to(beFalsy());
+
+	// The header isn't part of the message.
+	expect(@([filter setMessagePattern:@"Jane" caseInsensitive:NO error:&error])).to(beTruthy());
+	expect(@(matches(rawCommit))).to(beFalsy());
+});
+
+it(@"should reject an invalid message pattern", ^{
+	expect(@([filter setMessagePattern:@"bug" caseInsensitive:NO error:NULL])).to(beTruthy());
+
+	NSError *error = nil;
+	expect(@([filter setMessagePattern:@"(unbalanced" caseInsensitive:NO error:&error])).to(beFalsy());
+	expect(error).notTo(beNil());
+	expect(filter.messagePattern).to(equal(@"bug"));
+});
+
+it(@"should copy every condition", ^{
+	filter.authorEmail = @"nobody@example.com";
+	[filter setMessagePattern:@"bug" caseInsensitive:NO error:NULL];
+
+	GTCommitFilter *copiedFilter = [filter copy];
+	expect(copiedFilter.authorEmail).to(equal(filter.authorEmail));
+	expect(copiedFilter.messagePattern).to(equal(filter.messagePattern));
+
+	NSData *data = [rawCommit dataUsingEncoding:NSUTF8StringEncoding];
+	expect(@([copiedFilter matchesCommitBytes:data.bytes length:data.length])).to(beFalsy());
+});
+
+it(@"should filter enumerated commits", ^{
+	GTRepository *repo = self.testAppFixtureRepository;
+	expect(repo).notTo(beNil());
+
+	GTEnumerator *enumerator = [[GTEnumerator alloc] initWithRepository:repo error:NULL];
+	[enumerator pushHEAD:NULL];
+	NSArray *commits = [enumerator allObjectsWithError:NULL];
+
+	GTCommit *newest = commits.firstObject;
+	filter.authorEmail = newest.author.email;
+	filter.since = [newest.commitDate dateByAddingTimeInterval:-30 * 24 * 60 * 60];
+	filter.maximumParentCount = 1;
+
+	NSMutableArray *expectedSHAs = [NSMutableArray array];
+	for (GTCommit *commit in commits) {
+		if (![commit.author.email.lowercaseString isEqualToString:filter.authorEmail.lowercaseString]) continue;
+		if ([commit.commitDate compare:filter.since] == NSOrderedAscending) continue;
+		if (commit.parents.count > 1) continue;
+
+		[expectedSHAs addObject:commit.SHA];
+	}
+
+	enumerator.commitFilter = filter;
+	[enumerator pushHEAD:NULL];
+
+	NSError *error = nil;
+	NSArray *filteredCommits = [enumerator allObjectsWithError:&error];
+	expect(error).to(beNil());
+	expect([filteredCommits valueForKey:@"SHA"]).to(equal(expectedSHAs));
+	expect(@(expectedSHAs.count)).to(beGreaterThan(@0));
+});
+
+afterEach(^{
+	[self tearDown];
+});
+
+QuickSpecEnd
@@ -0,0 +1,174 @@
+//
+//  GTCommitGraphSpec.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+@import ObjectiveGit;
+@import Nimble;
+@import Quick;
+
+#import "QuickSpec+GTFixtures.h"
+
+QuickSpecBegin(GTCommitGraphSpec)
+
+__block GTRepository *repo;
+__block GTCommitGraph *graph;
+__block NSArray *commits;
+
+beforeEach(^{
+	repo = self.testAppFixtureRepository;
+	expect(repo).notTo(beNil());
+
+	NSError *error = nil;
+	graph = [GTCommitGraph writeCommitGraphForRepository:repo error:&error];
+	expect(graph).notTo(beNil());
+	expect(error).to(beNil());
+
+	GTEnumerator *enumerator = [[GTEnumerator alloc] initWithRepository:repo error:NULL];
+	[enumerator pushGlob:@"refs/*" error:NULL];
+	[enumerator pushHEAD:NULL];
+	commits = [enumerator allObjectsWithError:NULL];
+	expect(@(commits.count)).to(beGreaterThan(@1));
+});
+
+it(@"should contain every reachable commit", ^{
+	expect(@(graph.count)).to(equal(@(commits.count)));
+
+	for (GTCommit *commit in commits) {
+		expect([graph parentOIDsOfOID:commit.OID]).to(equal([commit.parents valueForKey:@"OID"]));
+		expect([graph treeOIDOfOID:commit.OID]).to(equal(commit.tree.OID));
+		expect([graph commitDateOfOID:commit.OID]).to(equal(commit.commitDate));
+
+		NSUInteger generation = 0;
+		for (GTCommit *parent in commit.parents) {
+			generation = MAX(generation, [graph generationOfOID:parent.OID]);
+		}
+		expect(@([graph generationOfOID:commit.OID])).to(equal(@(generation + 1)));
+	}
+
+	GTOID *missingOID = [[GTOID alloc] initWithSHA:@"f7ecd8f4404d3a388efbff6711f1bdf28ffd16a0"];
+	expect(@([graph containsOID:missingOID])).to(beFalsy());
+	expect(@([graph generationOfOID:missingOID])).to(equal(@(NSNotFound)));
+});
+
+it(@"should read back the written graph", ^{
+	NSError *error = nil;
+	GTCommitGraph *readGraph = [GTCommitGraph commitGraphWithRepository:repo error:&error];
+	expect(readGraph).notTo(beNil());
+	expect(error).to(beNil());
+	expect(@(readGraph.count)).to(equal(@(graph.count)));
+	expect(readGraph.fileURL).to(equal([GTCommitGraph commitGraphURLForRepository:repo]));
+});
+
+it(@"should reject a file which isn't a commit graph", ^{
+	NSURL *URL = [self.tempDirectoryFileURL URLByAppendingPathComponent:@"not-a-commit-graph"];
+	expect(@([[@"garbage" dataUsingEncoding:NSUTF8StringEncoding] writeToURL:URL atomically:YES])).to(beTruthy());
+
+	NSError *error = nil;
+	expect([[GTCommitGraph alloc] initWithContentsOfURL:URL error:&error]).to(beNil());
+	expect(error).notTo(beNil());
+});
+
+it(@"should match libgit2 for ahead/behind counts and merge bases", ^{
+	NSArray *branches = [repo localBranchesWithError:NULL];
+	expect(@(branches.count)).to(beGreaterThan(@1));
+
+	for (GTBranch *first in branches) {
+		for (GTBranch *second in branches) {
+			repo.commitGraph = nil;
+			size_t expectedAhead = 0, expectedBehind = 0;
+			expect(@([repo calculateAhead:&expectedAhead behind:&expectedBehind ofOID:first.OID relativeToOID:second.OID error:NULL])).to(beTruthy());
+			GTCommit *expectedMergeBase = [repo mergeBaseBetweenFirstOID:first.OID secondOID:second.OID error:NULL];
+
+			repo.commitGraph = graph;
+			size_t ahead = 0, behind = 0;
+			expect(@([repo calculateAhead:&ahead behind:&behind ofOID:first.OID relativeToOID:second.OID error:NULL])).to(beTruthy());
+			expect(@(ahead)).to(equal(@(expectedAhead)));
+			expect(@(behind)).to(equal(@(expectedBehind)));
+
+			GTCommit *mergeBase = [repo mergeBaseBetweenFirstOID:first.OID secondOID:second.OID error:NULL];
+			expect(mergeBase.OID).to(equal(expectedMergeBase.OID));
+		}
+	}
+});
+
+it(@"should serve topologically sorted walks", ^{
+	repo.commitGraph = graph;
+
+	GTEnumerator *enumerator = [[GTEnumerator alloc] initWithRepository:repo error:NULL];
+	[enumerator resetWithOptions:GTEnumeratorOptionsTopologicalSort];
+	[enumerator pushGlob:@"refs/*" error:NULL];
+	[enumerator pushHEAD:NULL];
+	NSArray *sorted = [enumerator allObjectsWithError:NULL];
+
+	expect([NSSet setWithArray:[sorted valueForKey:@"OID"]]).to(equal([NSSet setWithArray:[commits valueForKey:@"OID"]]));
+
+	NSMutableSet *seen = [NSMutableSet set];
+	for (GTCommit *commit in sorted) {
+		for (GTOID *parentOID in [commit.parents valueForKey:@"OID"]) {
+			expect(@([seen containsObject:parentOID])).to(beFalsy());
+		}
+		[seen addObject:commit.OID];
+	}
+
+	// The walk should have reset, so it can be reused.
+	expect([enumerator nextObject]).to(beNil());
+	expect(@([enumerator pushSHA:[sorted.lastObject SHA] error:NULL])).to(beTruthy());
+	expect(@([enumerator allObjectsWithError:NULL].count)).to(equal(@1));
+});
+
+it(@"should walk references pushed before the commit graph was set", ^{
+	repo.commitGraph = nil;
+
+	GTEnumerator *enumerator = [[GTEnumerator alloc] initWithRepository:repo error:NULL];
+	[enumerator resetWithOptions:GTEnumeratorOptionsTopologicalSort];
+	expect(@([enumerator pushGlob:@"refs/*" error:NULL])).to(beTruthy());
+	expect(@([enumerator pushHEAD:NULL])).to(beTruthy());
+
+	repo.commitGraph = graph;
+	NSArray *sorted = [enumerator allObjectsWithError:NULL];
+	expect([NSSet setWithArray:[sorted valueForKey:@"OID"]]).to(equal([NSSet setWithArray:[commits valueForKey:@"OID"]]));
+
+	// Once reset, pushes are recorded again.
+	expect(@([enumerator pushHEAD:NULL])).to(beTruthy());
+	expect(@([enumerator allObjectsWithError:NULL].count)).to(beGreaterThan(@0));
+});
+
+it(@"should hide commits in topologically sorted walks", ^{
+	repo.commitGraph = graph;
+
+	GTCommit *tip = commits.firstObject;
+	GTCommit *parent = tip.parents.firstObject;
+	expect(parent).notTo(beNil());
+
+	GTEnumerator *enumerator = [[GTEnumerator alloc] initWithRepository:repo error:NULL];
+	[enumerator resetWithOptions:GTEnumeratorOptionsTopologicalSort | GTEnumeratorOptionsReverse];
+	[enumerator pushSHA:tip.SHA error:NULL];
+	[enumerator hideSHA:parent.SHA error:NULL];
+
+	NSArray *SHAs = [[enumerator allObjectsWithError:NULL] valueForKey:@"SHA"];
+	expect(SHAs.lastObject).to(equal(tip.SHA));
+	expect(@([SHAs containsObject:parent.SHA])).to(beFalsy());
+});
+
+it(@"should only read new commits when updated", ^{
+	GTCommit *tip = commits.firstObject;
+	GTCommit *commit = [repo createCommitWithTree:tip.tree message:@"New commit" parents:@[ tip ] updatingReferenceNamed:@"refs/heads/commit-graph-test" error:NULL];
+	expect(commit).notTo(beNil());
+	expect(@([graph containsOID:commit.OID])).to(beFalsy());
+
+	NSError *error = nil;
+	GTCommitGraph *updatedGraph = [GTCommitGraph writeCommitGraphForRepository:repo error:&error];
+	expect(updatedGraph).notTo(beNil());
+	expect(error).to(beNil());
+	expect(@(updatedGraph.count)).to(equal(@(graph.count + 1)));
+	expect(@([updatedGraph generationOfOID:commit.OID])).to(equal(@([updatedGraph generationOfOID:tip.OID] + 1)));
+});
+
+afterEach(^{
+	[self tearDown];
+});
+
+QuickSpecEnd
@@ -80,6 +80,59 @@ it(@"can identify merges", ^{
 	expect(@(commit.merge)).to(beTruthy());
 });
 
+describe(@"lazy commits", ^{
+	it(@"should read the same data as parsed commits", ^{
+		GTEnumerator *enumerator = [[GTEnumerator alloc] initWithRepository:repository error:NULL];
+		[enumerator pushGlob:@"refs/*" error:NULL];
+		NSArray *commits = [enumerator allObjectsWithError:NULL];
+		expect(@(commits.count)).to(beGreaterThan(@1));
+
+		for (GTCommit *commit in commits) {
+			NSError *error = nil;
+			GTCommit *lazyCommit = [repository lookUpLazyCommitByOID:commit.OID error:&error];
+			expect(lazyCommit).notTo(beNil());
+			expect(error).to(beNil());
+
+			expect(lazyCommit).to(equal(commit));
+			expect(lazyCommit.type).to(equal(@"commit"));
+			expect(lazyCommit.messageSummary).to(equal(commit.messageSummary));
+			expect(lazyCommit.message).to(equal(commit.message));
+			expect(lazyCommit.messageDetails).to(equal(commit.messageDetails));
+			expect(lazyCommit.author).to(equal(commit.author));
+			expect(lazyCommit.committer).to(equal(commit.committer));
+			expect(lazyCommit.commitDate).to(equal(commit.commitDate));
+			expect(lazyCommit.commitTimeZone).to(equal(commit.commitTimeZone));
+			expect(lazyCommit.tree.OID).to(equal(commit.tree.OID));
+			expect(lazyCommit.parentOIDs).to(equal(commit.parentOIDs));
+			expect([lazyCommit.parents valueForKey:@"OID"]).to(equal(commit.parentOIDs));
+			expect(@(lazyCommit.merge)).to(equal(@(commit.merge)));
+
+			// Falls back to libgit2 for anything else.
+			expect(@(git_oid_equal(git_commit_id(lazyCommit.git_commit), commit.OID.git_oid))).to(beTruthy());
+		}
+	});
+
+	it(@"should fail to look up objects which aren't commits", ^{
+		GTCommit *commit = [repository lookUpObjectBySHA:@"8496071c1b46c854b31185ea97743be6a8774479" error:NULL];
+
+		NSError *error = nil;
+		expect([repository lookUpLazyCommitByOID:commit.tree.OID error:&error]).to(beNil());
+		expect(error).notTo(beNil());
+	});
+
+	it(@"should be returned by an enumerator", ^{
+		GTEnumerator *enumerator = [[GTEnumerator alloc] initWithRepository:repository error:NULL];
+		[enumerator pushGlob:@"refs/*" error:NULL];
+		NSArray *commits = [enumerator allObjectsWithError:NULL];
+
+		enumerator.returnsLazyCommits = YES;
+		[enumerator pushGlob:@"refs/*" error:NULL];
+		NSArray *lazyCommits = [enumerator allObjectsWithError:NULL];
+		expect(lazyCommits).to(equal(commits));
+		expect([lazyCommits valueForKey:@"messageSummary"]).to(equal([commits valueForKey:@"messageSummary"]));
+	});
+});
+
 afterEach(^{
 	[self tearDown];
 });
@@ -0,0 +1,102 @@
+//
+//  GTDiffDeltaTableSpec.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+@import ObjectiveGit;
+@import Nimble;
+@import Quick;
+
+#import "QuickSpec+GTFixtures.h"
+
+QuickSpecBegin(GTDiffDeltaTableSpec)
+
+__block GTRepository *repository;
+__block GTDiff *diff;
+__block GTDiffDeltaTable *table;
+
+beforeEach(^{
+	repository = self.testAppFixtureRepository;
+	expect(repository).notTo(beNil());
+
+	GTEnumerator *enumerator = [[GTEnumerator alloc] initWithRepository:repository error:NULL];
+	[enumerator resetWithOptions:GTEnumeratorOptionsTopologicalSort | GTEnumeratorOptionsReverse];
+	[enumerator pushHEAD:NULL];
+	NSArray *commits = [enumerator allObjectsWithError:NULL];
+	expect(@(commits.count)).to(beGreaterThan(@1));
+
+	diff = [GTDiff diffOldTree:[commits.firstObject tree] withNewTree:[commits.lastObject tree] inRepository:repository options:nil error:NULL];
+	[diff findSimilarWithOptions:@{ GTDiffFindOptionsFlagsKey: @(GTDiffFindOptionsFlagsFindRenames) }];
+	expect(@(diff.deltaCount)).to(beGreaterThan(@2));
+
+	NSError *error = nil;
+	table = [GTDiffDeltaTable deltaTableWithDiff:diff error:&error];
+	expect(table).notTo(beNil());
+	expect(error).to(beNil());
+});
+
+it(@"should copy every delta", ^{
+	expect(@(table.count)).to(equal(@(diff.deltaCount)));
+	expect(@(table.order)).to(equal(@(GTDiffDeltaTableOrderDelta)));
+
+	__block NSUInteger index = 0;
+	[diff enumerateDeltasUsingBlock:^(GTDiffDelta *delta, BOOL *stop) {
+		expect(@([table deltaIndexAtIndex:index])).to(equal(@(index)));
+		expect(@([table typeAtIndex:index])).to(equal(@(delta.type)));
+		expect(@([table similarityAtIndex:index])).to(equal(@(delta.similarity)));
+		expect(@([table flagsAtIndex:index])).to(equal(@(delta.flags)));
+		expect(@([table pathOfOldFileAtIndex:index])).to(equal(delta.oldFile.path));
+		expect(@([table pathOfNewFileAtIndex:index])).to(equal(delta.newFile.path));
+		expect([GTOID oidWithGitOid:[table OIDOfOldFileAtIndex:index]]).to(equal(delta.oldFile.OID));
+		expect([GTOID oidWithGitOid:[table OIDOfNewFileAtIndex:index]]).to(equal(delta.newFile.OID));
+		expect(@([table modeOfOldFileAtIndex:index])).to(equal(@(delta.oldFile.mode)));
+		expect(@([table modeOfNewFileAtIndex:index])).to(equal(@(delta.newFile.mode)));
+		index++;
+	}];
+});
+
+it(@"should sort by path", ^{
+	[table sortUsingOrder:GTDiffDeltaTableOrderPath];
+	expect(@(table.order)).to(equal(@(GTDiffDeltaTableOrderPath)));
+
+	for (NSUInteger idx = 1; idx < table.count; idx++) {
+		expect(@(strcmp([table pathOfNewFileAtIndex:idx - 1], [table pathOfNewFileAtIndex:idx]))).to(beLessThanOrEqualTo(@0));
+	}
+});
+
+it(@"should sort by status, then path", ^{
+	[table sortUsingOrder:GTDiffDeltaTableOrderStatus];
+
+	for (NSUInteger idx = 1; idx < table.count; idx++) {
+		GTDeltaType previousType = [table typeAtIndex:idx - 1];
+		GTDeltaType type = [table typeAtIndex:idx];
+		expect(@(previousType)).to(beLessThanOrEqualTo(@(type)));
+
+		if (previousType == type) {
+			expect(@(strcmp([table pathOfNewFileAtIndex:idx - 1], [table pathOfNewFileAtIndex:idx]))).to(beLessThanOrEqualTo(@0));
+		}
+	}
+
+	[table sortUsingOrder:GTDiffDeltaTableOrderDelta];
+	for (NSUInteger idx = 0; idx < table.count; idx++) {
+		expect(@([table deltaIndexAtIndex:idx])).to(equal(@(idx)));
+	}
+});
+
+it(@"should create deltas for sorted rows", ^{
+	[table sortUsingOrder:GTDiffDeltaTableOrderPath];
+
+	for (NSUInteger idx = 0; idx < table.count; idx++) {
+		GTDiffDelta *delta = [table deltaAtIndex:idx];
+		expect(delta.newFile.path).to(equal(@([table pathOfNewFileAtIndex:idx])));
+		expect(@(delta.type)).to(equal(@([table typeAtIndex:idx])));
+	}
+});
+
+afterEach(^{
+	[self tearDown];
+});
+
+QuickSpecEnd
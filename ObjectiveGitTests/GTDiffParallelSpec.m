@@ -0,0 +1,104 @@
+//
+//  GTDiffParallelSpec.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+@import ObjectiveGit;
+@import Nimble;
+@import Quick;
+
+#import "QuickSpec+GTFixtures.h"
+
+QuickSpecBegin(GTDiffParallelSpec)
+
+__block GTRepository *repository;
+__block GTTree *oldTree;
+__block GTTree *newTree;
+
+// The patch data of every delta, generated one at a time.
+NSArray<NSData *> * (^serialPatchData)(GTDiff *) = ^(GTDiff *diff) {
+	NSMutableArray *patchData = [NSMutableArray array];
+	[diff enumerateDeltasUsingBlock:^(GTDiffDelta *delta, BOOL *stop) {
+		GTDiffPatch *patch = [delta generatePatch:NULL];
+		expect(patch).notTo(beNil());
+		[patchData addObject:patch.patchData ?: [NSData data]];
+	}];
+
+	return patchData;
+};
+
+NSArray<NSData *> * (^parallelPatchData)(GTDiff *, NSDictionary *) = ^(GTDiff *diff, NSDictionary *options) {
+	NSMutableArray *patchData = [NSMutableArray array];
+	NSError *error = nil;
+	BOOL success = [diff enumeratePatchesWithOptions:options error:&error usingBlock:^(GTDiffPatch *patch, NSTimeInterval generationTime, BOOL *stop) {
+		expect(@(generationTime)).to(beGreaterThanOrEqualTo(@0));
+		[patchData addObject:patch.patchData ?: [NSData data]];
+	}];
+	expect(@(success)).to(beTruthy());
+	expect(error).to(beNil());
+
+	return patchData;
+};
+
+beforeEach(^{
+	repository = self.testAppFixtureRepository;
+	expect(repository).notTo(beNil());
+
+	GTEnumerator *enumerator = [[GTEnumerator alloc] initWithRepository:repository error:NULL];
+	[enumerator resetWithOptions:GTEnumeratorOptionsTopologicalSort | GTEnumeratorOptionsReverse];
+	[enumerator pushHEAD:NULL];
+	NSArray *commits = [enumerator allObjectsWithError:NULL];
+	expect(@(commits.count)).to(beGreaterThan(@1));
+
+	oldTree = [commits.firstObject tree];
+	newTree = [commits.lastObject tree];
+});
+
+it(@"should generate the same patches in delta order", ^{
+	GTDiff *diff = [GTDiff diffOldTree:oldTree withNewTree:newTree inRepository:repository options:@{ GTDiffOptionsContextLinesKey: @5 } error:NULL];
+	expect(@(diff.deltaCount)).to(beGreaterThan(@2));
+
+	NSArray *expected = serialPatchData(diff);
+	expect(parallelPatchData(diff, @{ GTDiffPatchOptionsConcurrencyKey: @3, GTDiffPatchOptionsWindowKey: @2 })).to(equal(expected));
+	expect(parallelPatchData(diff, @{ GTDiffPatchOptionsConcurrencyKey: @1 })).to(equal(expected));
+});
+
+it(@"should generate the same patches for reversed diffs", ^{
+	GTDiff *diff = [GTDiff diffOldTree:oldTree withNewTree:newTree inRepository:repository options:@{ GTDiffOptionsFlagsKey: @(GTDiffOptionsFlagsReverse) } error:NULL];
+	expect(parallelPatchData(diff, nil)).to(equal(serialPatchData(diff)));
+});
+
+it(@"should generate the same patches for renames", ^{
+	GTDiff *diff = [GTDiff diffOldTree:oldTree withNewTree:newTree inRepository:repository options:nil error:NULL];
+	[diff findSimilarWithOptions:@{ GTDiffFindOptionsFlagsKey: @(GTDiffFindOptionsFlagsFindRenames | GTDiffFindOptionsFlagsFindCopies) }];
+	expect(parallelPatchData(diff, nil)).to(equal(serialPatchData(diff)));
+});
+
+it(@"should generate patches for diffs with unknown options", ^{
+	GTDiff *diff = [GTDiff diffOldTree:oldTree withNewTree:newTree inRepository:repository options:nil error:NULL];
+	git_diff *gitDiff = NULL;
+	expect(@(git_diff_tree_to_tree(&gitDiff, repository.git_repository, oldTree.git_tree, newTree.git_tree, NULL))).to(equal(@(GIT_OK)));
+	GTDiff *wrappedDiff = [[GTDiff alloc] initWithGitDiff:gitDiff repository:repository];
+
+	expect(parallelPatchData(wrappedDiff, nil)).to(equal(serialPatchData(diff)));
+});
+
+it(@"should stop when asked to", ^{
+	GTDiff *diff = [GTDiff diffOldTree:oldTree withNewTree:newTree inRepository:repository options:nil error:NULL];
+
+	__block NSUInteger count = 0;
+	BOOL success = [diff enumeratePatchesWithOptions:@{ GTDiffPatchOptionsWindowKey: @1 } error:NULL usingBlock:^(GTDiffPatch *patch, NSTimeInterval generationTime, BOOL *stop) {
+		count++;
+		*stop = (count == 2);
+	}];
+	expect(@(success)).to(beTruthy());
+	expect(@(count)).to(equal(@2));
+});
+
+afterEach(^{
+	[self tearDown];
+});
+
+QuickSpecEnd
@@ -149,6 +149,42 @@ describe(@"GTDiff diffing", ^{
 		}];
 	});
 
+	it(@"should enumerate line spans", ^{
+		setupDiffFromCommitSHAsAndOptions(@"be0f001ff517a00b5b8e3c29ee6561e70f994e17", @"fe89ea0a8e70961b8a6344d9660c326d3f2eb0fe", nil);
+
+		[diff enumerateDeltasUsingBlock:^(GTDiffDelta *delta, BOOL *stop) {
+			GTDiffPatch *patch = [delta generatePatch:NULL];
+			expect(patch).notTo(beNil());
+
+			[patch enumerateHunksUsingBlock:^(GTDiffHunk *hunk, BOOL *stop) {
+				NSMutableArray *lines = [NSMutableArray array];
+				[hunk enumerateLinesInHunk:NULL usingBlock:^(GTDiffLine *line, BOOL *stop) {
+					[lines addObject:line];
+				}];
+
+				__block NSUInteger lineIndex = 0;
+				NSError *error = nil;
+				BOOL success = [hunk enumerateLineSpansWithError:&error usingBlock:^(GTDiffLineSpan span, BOOL *stop) {
+					GTDiffLine *line = lines[lineIndex];
+					NSString *content = [[NSString alloc] initWithBytes:span.content length:span.contentLength encoding:NSUTF8StringEncoding];
+
+					expect([content stringByTrimmingCharactersInSet:NSCharacterSet.newlineCharacterSet]).to(equal(line.content));
+					expect(@(span.origin)).to(equal(@(line.origin)));
+					expect(@(span.oldLineNumber)).to(equal(@(line.oldLineNumber)));
+					expect(@(span.newLineNumber)).to(equal(@(line.newLineNumber)));
+					expect(@(span.lineCount)).to(equal(@(line.lineCount)));
+
+					lineIndex ++;
+				}];
+				expect(@(success)).to(beTruthy());
+				expect(error).to(beNil());
+				expect(@(lineIndex)).to(equal(@(hunk.lineCount)));
+			}];
+
+			*stop = YES;
+		}];
+	});
+
 	it(@"should recognised added files", ^{
 		setupDiffFromCommitSHAsAndOptions(@"4d5a6cc7a4d810be71bd47331c947b22580a5997", @"38f1e536cfc2ee41e07d55b38baec00149b2b0d1", nil);
 
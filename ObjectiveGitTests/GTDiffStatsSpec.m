@@ -0,0 +1,122 @@
+//
+//  GTDiffStatsSpec.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+@import ObjectiveGit;
+@import Nimble;
+@import Quick;
+
+#import "QuickSpec+GTFixtures.h"
+
+QuickSpecBegin(GTDiffStatsSpec)
+
+__block GTRepository *repository;
+__block NSArray *commits;
+__block GTDiff *diff;
+
+beforeEach(^{
+	repository = self.testAppFixtureRepository;
+	expect(repository).notTo(beNil());
+
+	GTEnumerator *enumerator = [[GTEnumerator alloc] initWithRepository:repository error:NULL];
+	[enumerator resetWithOptions:GTEnumeratorOptionsTopologicalSort | GTEnumeratorOptionsReverse];
+	[enumerator pushHEAD:NULL];
+	commits = [enumerator allObjectsWithError:NULL];
+	expect(@(commits.count)).to(beGreaterThan(@2));
+
+	diff = [GTDiff diffOldTree:[commits.firstObject tree] withNewTree:[commits.lastObject tree] inRepository:repository options:nil error:NULL];
+	expect(@(diff.deltaCount)).to(beGreaterThan(@2));
+});
+
+it(@"should count the same lines as each patch", ^{
+	NSError *error = nil;
+	GTDiffStats *stats = [GTDiffStats statsWithDiff:diff error:&error];
+	expect(stats).notTo(beNil());
+	expect(error).to(beNil());
+	expect(@(stats.filesChanged)).to(equal(@(diff.deltaCount)));
+
+	__block NSUInteger index = 0;
+	__block NSUInteger insertions = 0;
+	__block NSUInteger deletions = 0;
+	[diff enumerateDeltasUsingBlock:^(GTDiffDelta *delta, BOOL *stop) {
+		GTDiffPatch *patch = [delta generatePatch:NULL];
+		GTDiffFileStats fileStats = stats.fileStats[index++];
+
+		expect(@(fileStats.path)).to(equal(delta.newFile.path));
+		expect(@(fileStats.insertions)).to(equal(@(patch.addedLinesCount)));
+		expect(@(fileStats.deletions)).to(equal(@(patch.deletedLinesCount)));
+		expect(@(fileStats.binary)).to(equal(@((delta.flags & GTDiffFileFlagBinary) != 0)));
+
+		insertions += patch.addedLinesCount;
+		deletions += patch.deletedLinesCount;
+	}];
+
+	expect(@(stats.insertions)).to(equal(@(insertions)));
+	expect(@(stats.deletions)).to(equal(@(deletions)));
+});
+
+it(@"should print the stats", ^{
+	GTDiffStats *stats = [GTDiffStats statsWithDiff:diff error:NULL];
+	expect(stats).notTo(beNil());
+
+	NSString *full = [stats formattedStatsWithFormat:GTDiffStatsFormatFull width:80 error:NULL];
+	expect(full).to(contain(@(stats.fileStats[0].path)));
+	expect(full).to(contain([NSString stringWithFormat:@"%lu files changed", (unsigned long)stats.filesChanged]));
+
+	NSString *number = [stats formattedStatsWithFormat:GTDiffStatsFormatNumber width:0 error:NULL];
+	NSArray *lines = [[number stringByTrimmingCharactersInSet:NSCharacterSet.newlineCharacterSet] componentsSeparatedByString:@"\n"];
+	expect(@(lines.count)).to(equal(@(stats.filesChanged)));
+});
+
+it(@"should count commit pairs in parallel", ^{
+	NSMutableArray *pairs = [NSMutableArray arrayWithObject:@[ NSNull.null, commits.firstObject ]];
+	for (NSUInteger idx = 1; idx < commits.count; idx++) {
+		[pairs addObject:@[ commits[idx - 1], commits[idx] ]];
+	}
+
+	NSError *error = nil;
+	NSArray *parallelStats = [GTDiffStats statsForCommitPairs:pairs inRepository:repository options:nil concurrency:3 error:&error];
+	expect(parallelStats).notTo(beNil());
+	expect(error).to(beNil());
+	expect(@(parallelStats.count)).to(equal(@(pairs.count)));
+
+	[pairs enumerateObjectsUsingBlock:^(NSArray *pair, NSUInteger idx, BOOL *stop) {
+		GTTree *oldTree = (pair[0] == NSNull.null ? nil : [pair[0] tree]);
+		GTDiff *pairDiff = [GTDiff diffOldTree:oldTree withNewTree:[pair[1] tree] inRepository:repository options:nil error:NULL];
+		GTDiffStats *expected = [GTDiffStats statsWithDiff:pairDiff error:NULL];
+
+		GTDiffStats *stats = parallelStats[idx];
+		expect(@(stats.filesChanged)).to(equal(@(expected.filesChanged)));
+		expect(@(stats.insertions)).to(equal(@(expected.insertions)));
+		expect(@(stats.deletions)).to(equal(@(expected.deletions)));
+		for (NSUInteger fileIndex = 0; fileIndex < stats.filesChanged; fileIndex++) {
+			expect(@(strcmp(stats.fileStats[fileIndex].path, expected.fileStats[fileIndex].path))).to(equal(@0));
+		}
+
+		// Only the counts are kept.
+		expect(stats.diff).to(beNil());
+		NSError *formatError = nil;
+		expect([stats formattedStatsWithFormat:GTDiffStatsFormatShort width:80 error:&formatError]).to(beNil());
+		expect(formatError).notTo(beNil());
+	}];
+});
+
+it(@"should fail if a commit can't be found", ^{
+	GTRepository *otherRepository = self.bareFixtureRepository;
+	GTCommit *otherCommit = [otherRepository lookUpObjectByRevParse:@"HEAD" error:NULL];
+	expect(otherCommit).notTo(beNil());
+
+	NSError *error = nil;
+	NSArray *stats = [GTDiffStats statsForCommitPairs:@[ @[ commits.firstObject, otherCommit ] ] inRepository:repository options:nil concurrency:0 error:&error];
+	expect(stats).to(beNil());
+	expect(error).notTo(beNil());
+});
+
+afterEach(^{
+	[self tearDown];
+});
+
+QuickSpecEnd
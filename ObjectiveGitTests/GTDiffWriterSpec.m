@@ -0,0 +1,150 @@
+//
+//  GTDiffWriterSpec.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+@import ObjectiveGit;
+@import Nimble;
+@import Quick;
+
+#import "QuickSpec+GTFixtures.h"
+
+QuickSpecBegin(GTDiffWriterSpec)
+
+__block GTRepository *repository;
+__block GTDiff *diff;
+__block NSData *expectedPatchData;
+
+beforeEach(^{
+	repository = self.testAppFixtureRepository;
+	expect(repository).notTo(beNil());
+
+	GTEnumerator *enumerator = [[GTEnumerator alloc] initWithRepository:repository error:NULL];
+	[enumerator resetWithOptions:GTEnumeratorOptionsTopologicalSort | GTEnumeratorOptionsReverse];
+	[enumerator pushHEAD:NULL];
+	NSArray *commits = [enumerator allObjectsWithError:NULL];
+	expect(@(commits.count)).to(beGreaterThan(@1));
+
+	diff = [GTDiff diffOldTree:[commits.firstObject tree] withNewTree:[commits.lastObject tree] inRepository:repository options:nil error:NULL];
+	expect(@(diff.deltaCount)).to(beGreaterThan(@2));
+
+	NSMutableData *patchData = [NSMutableData data];
+	[diff enumerateDeltasUsingBlock:^(GTDiffDelta *delta, BOOL *stop) {
+		GTDiffPatch *patch = [delta generatePatch:NULL];
+		expect(patch).notTo(beNil());
+		[patchData appendData:patch.patchData];
+	}];
+	expectedPatchData = patchData;
+});
+
+it(@"should write the same patch text as each patch", ^{
+	NSOutputStream *stream = [NSOutputStream outputStreamToMemory];
+	[stream open];
+
+	GTDiffWriter *writer = [[GTDiffWriter alloc] initWithOutputStream:stream];
+	NSError *error = nil;
+	BOOL success = [writer writeDiff:diff format:GTDiffWriterFormatPatch error:&error];
+	expect(@(success)).to(beTruthy());
+	expect(error).to(beNil());
+	[stream close];
+
+	expect([stream propertyForKey:NSStreamDataWrittenToMemoryStreamKey]).to(equal(expectedPatchData));
+	expect(@(writer.bytesWritten)).to(equal(@(expectedPatchData.length)));
+});
+
+it(@"should write to a file descriptor", ^{
+	NSURL *fileURL = [self.tempDirectoryFileURL URLByAppendingPathComponent:@"diff.patch"];
+	int fileDescriptor = open(fileURL.fileSystemRepresentation, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+	expect(@(fileDescriptor)).to(beGreaterThanOrEqualTo(@0));
+
+	GTDiffWriter *writer = [[GTDiffWriter alloc] initWithFileDescriptor:fileDescriptor];
+	BOOL success = [writer writeDiff:diff format:GTDiffWriterFormatPatch error:NULL];
+	close(fileDescriptor);
+
+	expect(@(success)).to(beTruthy());
+	expect([NSData dataWithContentsOfURL:fileURL]).to(equal(expectedPatchData));
+});
+
+it(@"should write single patches", ^{
+	NSMutableData *data = [NSMutableData data];
+	GTDiffWriter *writer = [[GTDiffWriter alloc] initWithBufferSize:GTDiffWriterDefaultBufferSize chunkHandler:^(const void *bytes, NSUInteger length, NSError **error) {
+		[data appendBytes:bytes length:length];
+		return YES;
+	}];
+
+	[diff enumerateDeltasUsingBlock:^(GTDiffDelta *delta, BOOL *stop) {
+		expect(@([writer writePatch:[delta generatePatch:NULL] error:NULL])).to(beTruthy());
+	}];
+
+	expect(data).to(equal(expectedPatchData));
+});
+
+it(@"should never pass more than the buffer size at once", ^{
+	NSMutableData *data = [NSMutableData data];
+	__block NSUInteger largestChunk = 0;
+	GTDiffWriter *writer = [[GTDiffWriter alloc] initWithBufferSize:7 chunkHandler:^(const void *bytes, NSUInteger length, NSError **error) {
+		largestChunk = MAX(largestChunk, length);
+		[data appendBytes:bytes length:length];
+		return YES;
+	}];
+
+	expect(@([writer writeDiff:diff format:GTDiffWriterFormatPatch error:NULL])).to(beTruthy());
+	expect(@(largestChunk)).to(equal(@7));
+	expect(data).to(equal(expectedPatchData));
+});
+
+it(@"should write name and status lines", ^{
+	NSMutableData *data = [NSMutableData data];
+	GTDiffWriter *writer = [[GTDiffWriter alloc] initWithBufferSize:GTDiffWriterDefaultBufferSize chunkHandler:^(const void *bytes, NSUInteger length, NSError **error) {
+		[data appendBytes:bytes length:length];
+		return YES;
+	}];
+
+	expect(@([writer writeDiff:diff format:GTDiffWriterFormatNameStatus error:NULL])).to(beTruthy());
+
+	NSString *output = [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+	NSArray *lines = [[output stringByTrimmingCharactersInSet:NSCharacterSet.newlineCharacterSet] componentsSeparatedByString:@"\n"];
+	expect(@(lines.count)).to(equal(@(diff.deltaCount)));
+
+	[diff enumerateDeltasUsingBlock:^(GTDiffDelta *delta, BOOL *stop) {
+		expect(output).to(contain(delta.newFile.path));
+	}];
+});
+
+it(@"should write stats", ^{
+	NSMutableData *data = [NSMutableData data];
+	GTDiffWriter *writer = [[GTDiffWriter alloc] initWithBufferSize:GTDiffWriterDefaultBufferSize chunkHandler:^(const void *bytes, NSUInteger length, NSError **error) {
+		[data appendBytes:bytes length:length];
+		return YES;
+	}];
+
+	expect(@([writer writeDiff:diff format:GTDiffWriterFormatStat error:NULL])).to(beTruthy());
+
+	NSString *output = [[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding];
+	expect(output).to(contain(@"files changed"));
+});
+
+it(@"should stop when the destination fails", ^{
+	NSError *handlerError = [NSError errorWithDomain:@"GTDiffWriterSpec" code:42 userInfo:nil];
+	__block NSUInteger calls = 0;
+	GTDiffWriter *writer = [[GTDiffWriter alloc] initWithBufferSize:16 chunkHandler:^(const void *bytes, NSUInteger length, NSError **error) {
+		calls++;
+		*error = handlerError;
+		return NO;
+	}];
+
+	NSError *error = nil;
+	BOOL success = [writer writeDiff:diff format:GTDiffWriterFormatPatch error:&error];
+	expect(@(success)).to(beFalsy());
+	expect(error).to(equal(handlerError));
+	expect(@(calls)).to(equal(@1));
+	expect(@(writer.bytesWritten)).to(equal(@0));
+});
+
+afterEach(^{
+	[self tearDown];
+});
+
+QuickSpecEnd
@@ -99,6 +99,37 @@ describe(@"with a rev list", ^{
 		expect(@(enumerator.options)).to(equal(@(GTEnumeratorOptionsTimeSort)));
 		verifyEnumerator();
 	});
+
+	it(@"should get raw OIDs in batches", ^{
+		NSError *error = nil;
+		expect(@([enumerator pushSHA:expectedSHAs[0] error:&error])).to(beTruthy());
+
+		git_oid oids[3];
+		expect(@([enumerator nextOIDs:oids maxCount:3 error:&error])).to(equal(@3));
+		expect(@([enumerator nextOIDs:oids + 1 maxCount:2 error:&error])).to(equal(@1));
+		expect(@([enumerator nextOIDs:oids maxCount:3 error:&error])).to(equal(@0));
+		expect(error).to(beNil());
+
+		expect([GTOID oidWithGitOid:&oids[1]].SHA).to(equal(expectedSHAs[3]));
+	});
+
+	it(@"should get raw OIDs as data", ^{
+		NSError *error = nil;
+		expect(@([enumerator pushSHA:expectedSHAs[0] error:&error])).to(beTruthy());
+
+		NSData *first = [enumerator nextOIDDataWithMaxCount:1 error:&error];
+		NSData *rest = [enumerator nextOIDDataWithMaxCount:NSUIntegerMax error:&error];
+		expect(error).to(beNil());
+		expect(@(first.length)).to(equal(@(sizeof(git_oid))));
+		expect(@(rest.length)).to(equal(@(3 * sizeof(git_oid))));
+
+		const git_oid *oids = rest.bytes;
+		for (NSUInteger i = 0; i < 3; i++) {
+			expect([GTOID oidWithGitOid:&oids[i]].SHA).to(equal(expectedSHAs[i + 1]));
+		}
+
+		expect(@([enumerator nextOIDDataWithMaxCount:NSUIntegerMax error:&error].length)).to(equal(@0));
+	});
 });
 
 describe(@"globbing", ^{
@@ -151,6 +182,81 @@ describe(@"globbing", ^{
 	});
 });
 
+describe(@"path limiting", ^{
+	__block NSString *path;
+	__block NSArray *(^SHAsLimitedToPath)(GTEnumeratorOptions options, GTEnumeratorPathOptions pathOptions, NSUInteger concurrency);
+
+	beforeEach(^{
+		repo = self.testAppFixtureRepository;
+		expect(repo).notTo(beNil());
+
+		GTCommit *HEADCommit = [[repo currentBranchWithError:NULL] targetCommitWithError:NULL];
+		GTTreeEntry *entry = [HEADCommit.tree entryAtIndex:0];
+		expect(entry).notTo(beNil());
+		path = entry.name;
+
+		SHAsLimitedToPath = ^(GTEnumeratorOptions options, GTEnumeratorPathOptions pathOptions, NSUInteger concurrency) {
+			GTEnumerator *enumerator = [[GTEnumerator alloc] initWithRepository:repo error:NULL];
+			[enumerator resetWithOptions:options];
+			[enumerator limitToPaths:@[ path ] options:pathOptions];
+			enumerator.pathCheckConcurrency = concurrency;
+			expect(@([enumerator pushHEAD:NULL])).to(beTruthy());
+
+			NSError *error = nil;
+			NSArray *commits = [enumerator allObjectsWithError:&error];
+			expect(commits).notTo(beNil());
+			expect(error).to(beNil());
+			return [commits valueForKey:@"SHA"];
+		};
+	});
+
+	it(@"should only return commits which changed the path", ^{
+		NSArray *SHAs = SHAsLimitedToPath(GTEnumeratorOptionsTimeSort, GTEnumeratorPathOptionsNone, 1);
+		expect(@(SHAs.count)).to(beGreaterThan(@0));
+
+		GTEnumerator *enumerator = [[GTEnumerator alloc] initWithRepository:repo error:NULL];
+		[enumerator resetWithOptions:GTEnumeratorOptionsTimeSort];
+		[enumerator pushHEAD:NULL];
+
+		NSMutableArray *expectedSHAs = [NSMutableArray array];
+		for (GTCommit *commit in enumerator) {
+			GTOID *entryOID = [commit.tree entryWithPath:path error:NULL].OID;
+
+			BOOL changed = (commit.parents.count == 0 ? entryOID != nil : NO);
+			for (GTCommit *parent in commit.parents) {
+				GTOID *parentEntryOID = [parent.tree entryWithPath:path error:NULL].OID;
+				if (!(entryOID == parentEntryOID || [entryOID isEqual:parentEntryOID])) changed = YES;
+			}
+
+			if (changed) [expectedSHAs addObject:commit.SHA];
+		}
+
+		expect(SHAs).to(equal(expectedSHAs));
+	});
+
+	it(@"should simplify history to a subset of the full history", ^{
+		NSArray *fullSHAs = SHAsLimitedToPath(GTEnumeratorOptionsTimeSort, GTEnumeratorPathOptionsNone, 1);
+		NSArray *simplifiedSHAs = SHAsLimitedToPath(GTEnumeratorOptionsTimeSort, GTEnumeratorPathOptionsSimplifyHistory, 1);
+
+		expect(@(simplifiedSHAs.count)).to(beGreaterThan(@0));
+		expect(@([[NSSet setWithArray:simplifiedSHAs] isSubsetOfSet:[NSSet setWithArray:fullSHAs]])).to(beTruthy());
+	});
+
+	it(@"should reverse simplified history", ^{
+		NSArray *SHAs = SHAsLimitedToPath(GTEnumeratorOptionsTimeSort, GTEnumeratorPathOptionsSimplifyHistory, 1);
+		NSArray *reversedSHAs = SHAsLimitedToPath(GTEnumeratorOptionsTimeSort | GTEnumeratorOptionsReverse, GTEnumeratorPathOptionsSimplifyHistory, 1);
+		expect(reversedSHAs).to(equal(SHAs.reverseObjectEnumerator.allObjects));
+	});
+
+	it(@"should return the same commits when checking on several threads", ^{
+		for (NSNumber *pathOptions in @[ @(GTEnumeratorPathOptionsNone), @(GTEnumeratorPathOptionsSimplifyHistory) ]) {
+			NSArray *SHAs = SHAsLimitedToPath(GTEnumeratorOptionsTopologicalSort, pathOptions.unsignedIntegerValue, 1);
+			NSArray *concurrentSHAs = SHAsLimitedToPath(GTEnumeratorOptionsTopologicalSort, pathOptions.unsignedIntegerValue, 4);
+			expect(concurrentSHAs).to(equal(SHAs));
+		}
+	});
+});
+
 afterEach(^{
 	[self tearDown];
 });
@@ -0,0 +1,85 @@
+//
+//  GTOIDPoolSpec.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+@import ObjectiveGit;
+@import Nimble;
+@import Quick;
+
+#import "QuickSpec+GTFixtures.h"
+
+QuickSpecBegin(GTOIDPoolSpec)
+
+__block GTOID *firstOID;
+__block GTOID *secondOID;
+
+beforeEach(^{
+	firstOID = [[GTOID alloc] initWithSHA:@"f7ecd8f4404d3a388efbff6711f1bdf28ffd16a0"];
+	secondOID = [[GTOID alloc] initWithSHA:@"82dc47f6ba3beecab33080a1136d8913098e1801"];
+});
+
+it(@"should return the same instance for the same object ID", ^{
+	GTOIDPool *pool = [[GTOIDPool alloc] init];
+
+	GTOID *interned = [pool OIDWithGitOid:firstOID.git_oid];
+	expect(interned).to(equal(firstOID));
+	expect(interned).to(beIdenticalTo([pool OIDWithGitOid:firstOID.git_oid]));
+	expect(interned).notTo(beIdenticalTo([pool OIDWithGitOid:secondOID.git_oid]));
+
+	expect(@(pool.hitCount)).to(equal(@1));
+	expect(@(pool.missCount)).to(equal(@2));
+	expect(@(pool.count)).to(equal(@2));
+});
+
+it(@"should evict object IDs which weren't used for a whole generation", ^{
+	GTOIDPool *pool = [[GTOIDPool alloc] initWithGenerationCapacity:1];
+
+	GTOID *interned = [pool OIDWithGitOid:firstOID.git_oid];
+	[pool advanceGeneration];
+
+	// Promoted back into the current generation.
+	expect([pool OIDWithGitOid:firstOID.git_oid]).to(beIdenticalTo(interned));
+
+	[pool advanceGeneration];
+	[pool advanceGeneration];
+	expect(@(pool.count)).to(equal(@0));
+	expect(@(pool.evictionCount)).to(equal(@1));
+
+	expect([pool OIDWithGitOid:firstOID.git_oid]).notTo(beIdenticalTo(interned));
+});
+
+it(@"should bound the number of object IDs it holds", ^{
+	GTOIDPool *pool = [[GTOIDPool alloc] initWithGenerationCapacity:2];
+
+	git_oid oid = { { 0 } };
+	for (uint8_t i = 0; i < 10; i++) {
+		oid.id[0] = i;
+		[pool OIDWithGitOid:&oid];
+	}
+
+	expect(@(pool.count)).to(beLessThanOrEqualTo(@4));
+	expect(@(pool.missCount)).to(equal(@10));
+});
+
+it(@"should be used by repository objects", ^{
+	GTRepository *repo = self.bareFixtureRepository;
+	repo.OIDPool = [[GTOIDPool alloc] init];
+
+	GTReference *HEAD = [repo headReferenceWithError:NULL];
+	expect(HEAD).notTo(beNil());
+
+	GTCommit *commit = [repo lookUpObjectByOID:HEAD.targetOID objectType:GTObjectTypeCommit error:NULL];
+	expect(commit).notTo(beNil());
+	expect(commit.OID).to(beIdenticalTo(HEAD.OID));
+	expect(commit.OID).to(beIdenticalTo(commit.OID));
+	expect(@(repo.OIDPool.hitCount)).to(beGreaterThan(@0));
+});
+
+afterEach(^{
+	[self tearDown];
+});
+
+QuickSpecEnd
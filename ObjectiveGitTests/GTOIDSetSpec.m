@@ -0,0 +1,172 @@
+//
+//  GTOIDSetSpec.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+@import ObjectiveGit;
+@import Nimble;
+@import Quick;
+
+#import "QuickSpec+GTFixtures.h"
+
+QuickSpecBegin(GTOIDSetSpec)
+
+__block GTOID *firstOID;
+__block GTOID *secondOID;
+
+beforeEach(^{
+	firstOID = [[GTOID alloc] initWithSHA:@"f7ecd8f4404d3a388efbff6711f1bdf28ffd16a0"];
+	secondOID = [[GTOID alloc] initWithSHA:@"82dc47f6ba3beecab33080a1136d8913098e1801"];
+});
+
+describe(@"GTOIDSet", ^{
+	__block GTOIDSet *set;
+
+	beforeEach(^{
+		set = [[GTOIDSet alloc] init];
+		expect(set).notTo(beNil());
+	});
+
+	it(@"should add and test membership", ^{
+		expect(@([set addOID:firstOID])).to(beTruthy());
+		expect(@([set addGitOid:firstOID.git_oid])).to(beFalsy());
+		expect(@(set.count)).to(equal(@1));
+
+		expect(@([set containsOID:firstOID])).to(beTruthy());
+		expect(@([set containsOID:secondOID])).to(beFalsy());
+	});
+
+	it(@"should tell new object IDs from ones already in the set", ^{
+		BOOL added = NO;
+		expect(@([set addGitOid:secondOID.git_oid added:&added])).to(beTruthy());
+		expect(@(added)).to(beTruthy());
+
+		expect(@([set addGitOid:secondOID.git_oid added:&added])).to(beTruthy());
+		expect(@(added)).to(beFalsy());
+	});
+
+	it(@"should remove object IDs", ^{
+		[set addOID:firstOID];
+		[set addOID:secondOID];
+
+		expect(@([set removeOID:firstOID])).to(beTruthy());
+		expect(@([set removeOID:firstOID])).to(beFalsy());
+		expect(@([set containsOID:secondOID])).to(beTruthy());
+		expect(@(set.count)).to(equal(@1));
+
+		[set removeAllOIDs];
+		expect(@(set.count)).to(equal(@0));
+		expect(@([set containsOID:secondOID])).to(beFalsy());
+	});
+
+	it(@"should grow past its initial capacity", ^{
+		git_oid oid = { { 0 } };
+		for (uint32_t i = 0; i < 10000; i++) {
+			memcpy(oid.id, &i, sizeof(i));
+			[set addGitOid:&oid];
+		}
+
+		expect(@(set.count)).to(equal(@10000));
+
+		uint32_t i = 4321;
+		memcpy(oid.id, &i, sizeof(i));
+		expect(@([set containsGitOid:&oid])).to(beTruthy());
+	});
+
+	it(@"should return all its object IDs", ^{
+		[set addOID:firstOID];
+		[set addOID:secondOID];
+
+		NSArray *OIDs = set.allOIDs;
+		expect(@(OIDs.count)).to(equal(@2));
+		expect(OIDs).to(contain(firstOID));
+		expect(OIDs).to(contain(secondOID));
+	});
+
+	it(@"should be filled by an enumerator", ^{
+		GTRepository *repo = self.bareFixtureRepository;
+		GTEnumerator *enumerator = [[GTEnumerator alloc] initWithRepository:repo error:NULL];
+		expect(@([enumerator pushHEAD:NULL])).to(beTruthy());
+
+		NSError *error = nil;
+		expect(@([enumerator addRemainingOIDsToSet:set error:&error])).to(beTruthy());
+		expect(error).to(beNil());
+		expect(@(set.count)).to(equal(@3));
+		expect(@([set containsOID:[repo headReferenceWithError:NULL].targetOID])).to(beTruthy());
+	});
+
+	it(@"should be filled by a tree", ^{
+		GTRepository *repo = self.bareFixtureRepository;
+		GTTree *tree = (GTTree *)[repo lookUpObjectBySHA:@"c4dc1555e4d4fa0e0c9c3fc46734c7c35b3ce90b" error:NULL];
+		expect(tree).notTo(beNil());
+
+		NSError *error = nil;
+		expect(@([tree addEntryOIDsToSet:set recursive:NO error:&error])).to(beTruthy());
+		expect(@(set.count)).to(equal(@3));
+		expect(@([set containsOID:[tree entryWithName:@"README"].OID])).to(beTruthy());
+
+		GTOIDSet *recursiveSet = [[GTOIDSet alloc] init];
+		expect(@([tree addEntryOIDsToSet:recursiveSet recursive:YES error:&error])).to(beTruthy());
+		expect(error).to(beNil());
+		expect(@(recursiveSet.count)).to(beGreaterThan(@3));
+	});
+
+	it(@"should be filled by an index", ^{
+		GTIndex *index = [self.testAppFixtureRepository indexWithError:NULL];
+		expect(index).notTo(beNil());
+
+		NSError *error = nil;
+		expect(@([index addEntryOIDsToSet:set error:&error])).to(beTruthy());
+		expect(error).to(beNil());
+		expect(@(set.count)).to(beGreaterThan(@0));
+		expect(@([set containsOID:[index entryAtIndex:0].OID])).to(beTruthy());
+	});
+});
+
+describe(@"GTOIDMap", ^{
+	__block GTOIDMap *map;
+
+	beforeEach(^{
+		map = [[GTOIDMap alloc] init];
+		expect(map).notTo(beNil());
+	});
+
+	it(@"should store and replace values", ^{
+		expect(@([map setValue:1 forOID:firstOID])).to(beTruthy());
+		expect(@([map setValue:2 forGitOid:secondOID.git_oid])).to(beTruthy());
+		expect(@([map valueForOID:firstOID])).to(equal(@1));
+		expect(@([map valueForOID:secondOID])).to(equal(@2));
+
+		[map setValue:3 forOID:firstOID];
+		expect(@([map valueForOID:firstOID])).to(equal(@3));
+		expect(@(map.count)).to(equal(@2));
+	});
+
+	it(@"should return NSNotFound for missing object IDs", ^{
+		expect(@([map valueForOID:firstOID])).to(equal(@(NSNotFound)));
+		expect(@([map containsGitOid:firstOID.git_oid])).to(beFalsy());
+	});
+
+	it(@"should remove object IDs", ^{
+		[map setValue:1 forOID:firstOID];
+		expect(@([map removeGitOid:firstOID.git_oid])).to(beTruthy());
+		expect(@([map valueForOID:firstOID])).to(equal(@(NSNotFound)));
+		expect(@(map.count)).to(equal(@0));
+	});
+
+	it(@"should copy its entries", ^{
+		[map setValue:7 forOID:firstOID];
+
+		GTOIDMap *copy = [map copy];
+		[map setValue:8 forOID:firstOID];
+		expect(@([copy valueForOID:firstOID])).to(equal(@7));
+	});
+});
+
+afterEach(^{
+	[self tearDown];
+});
+
+QuickSpecEnd
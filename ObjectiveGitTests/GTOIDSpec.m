@@ -80,6 +80,66 @@ it(@"should return an error when initialized with a string shorter than 40 chara
 	expect(error).notTo(beNil());
 });
 
+describe(@"batch conversion", ^{
+	NSArray *SHAs = @[
+		@"f7ecd8f4404d3a388efbff6711f1bdf28ffd16a0",
+		@"82dc47f6ba3beecab33080a1136d8913098e1801",
+		@"0123456789ABCDEFabcdef0123456789abcdef01",
+	];
+
+	it(@"should convert many SHAs at once", ^{
+		NSError *error = nil;
+		NSArray *OIDs = [GTOID OIDsWithSHAStrings:SHAs error:&error];
+		expect(error).to(beNil());
+		expect(@(OIDs.count)).to(equal(@3));
+
+		for (NSUInteger i = 0; i < SHAs.count; i++) {
+			expect(OIDs[i]).to(equal([[GTOID alloc] initWithSHA:SHAs[i]]));
+			expect([OIDs[i] SHA]).to(equal([SHAs[i] lowercaseString]));
+		}
+	});
+
+	it(@"should fail if any SHA is invalid", ^{
+		NSError *error = nil;
+		NSArray *invalidSHAs = [SHAs arrayByAddingObject:@"zzzzz8f4404d3a388efbff6711f1bdf28ffd16a0"];
+		expect([GTOID OIDsWithSHAStrings:invalidSHAs error:&error]).to(beNil());
+		expect(error).notTo(beNil());
+
+		error = nil;
+		expect([GTOID OIDsWithSHAStrings:@[ @"f7ecd80" ] error:&error]).to(beNil());
+		expect(error).notTo(beNil());
+	});
+
+	it(@"should round trip through contiguous SHA data", ^{
+		NSArray *OIDs = [GTOID OIDsWithSHAStrings:SHAs error:NULL];
+		NSData *data = [GTOID SHADataWithOIDs:OIDs];
+		expect(@(data.length)).to(equal(@(SHAs.count * GIT_OID_HEXSZ)));
+
+		NSString *joined = [[NSString alloc] initWithData:data encoding:NSASCIIStringEncoding];
+		expect(joined).to(equal([[SHAs componentsJoinedByString:@""] lowercaseString]));
+
+		git_oid oids[3];
+		NSError *error = nil;
+		expect(@([GTOID getGitOids:oids fromSHAData:data error:&error])).to(beTruthy());
+		expect(error).to(beNil());
+		for (NSUInteger i = 0; i < SHAs.count; i++) {
+			expect([[GTOID alloc] initWithGitOid:&oids[i]]).to(equal(OIDs[i]));
+		}
+
+		char buffer[3 * GIT_OID_HEXSZ];
+		[GTOID getSHAs:buffer fromGitOids:oids count:3];
+		expect([[NSData alloc] initWithBytes:buffer length:sizeof(buffer)]).to(equal(data));
+	});
+
+	it(@"should reject SHA data which isn't a whole number of SHAs", ^{
+		git_oid oid;
+		NSError *error = nil;
+		NSData *data = [@"f7ecd8f4404d3a388efbff6711f1bdf28ffd16" dataUsingEncoding:NSASCIIStringEncoding];
+		expect(@([GTOID getGitOids:&oid fromSHAData:data error:&error])).to(beFalsy());
+		expect(error).notTo(beNil());
+	});
+});
+
 afterEach(^{
 	[self tearDown];
 });
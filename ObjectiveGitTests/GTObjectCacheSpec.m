@@ -0,0 +1,112 @@
+//
+//  GTObjectCacheSpec.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+@import ObjectiveGit;
+@import Nimble;
+@import Quick;
+
+#import "QuickSpec+GTFixtures.h"
+
+QuickSpecBegin(GTObjectCacheSpec)
+
+__block GTRepository *repo;
+__block GTCommit *HEADCommit;
+
+beforeEach(^{
+	repo = self.testAppFixtureRepository;
+	expect(repo).notTo(beNil());
+
+	HEADCommit = [repo lookUpObjectByRevParse:@"HEAD" error:NULL];
+	expect(HEADCommit).notTo(beNil());
+});
+
+it(@"should answer repeated lookups from the cache", ^{
+	GTObjectCache *cache = [[GTObjectCache alloc] init];
+	expect(@(cache.byteLimit)).to(equal(@(GTObjectCacheDefaultByteLimit)));
+	repo.objectCache = cache;
+
+	NSError *error = nil;
+	GTTree *tree = [repo lookUpObjectByOID:HEADCommit.tree.OID objectType:GTObjectTypeTree error:&error];
+	expect(tree).notTo(beNil());
+	expect(error).to(beNil());
+	expect(@(cache.missCount)).to(equal(@1));
+	expect(@(cache.hitCount)).to(equal(@0));
+	expect(@(cache.count)).to(equal(@1));
+	expect(@(cache.byteCount)).to(beGreaterThan(@0));
+
+	GTTree *cachedTree = [repo lookUpObjectByOID:HEADCommit.tree.OID error:&error];
+	expect(cachedTree).to(beAnInstanceOf(GTTree.class));
+	expect(cachedTree).to(equal(tree));
+	expect(@(cachedTree.entryCount)).to(equal(@(tree.entryCount)));
+	expect(@(cache.hitCount)).to(equal(@1));
+	expect(@(cache.count)).to(equal(@1));
+});
+
+it(@"should not return cached objects of the wrong type", ^{
+	repo.objectCache = [[GTObjectCache alloc] init];
+
+	expect([repo lookUpObjectByOID:HEADCommit.OID objectType:GTObjectTypeCommit error:NULL]).notTo(beNil());
+
+	NSError *error = nil;
+	expect([repo lookUpObjectByOID:HEADCommit.OID objectType:GTObjectTypeTree error:&error]).to(beNil());
+	expect(error).notTo(beNil());
+	expect(@(repo.objectCache.hitCount)).to(equal(@0));
+});
+
+it(@"should evict the least recently used objects", ^{
+	GTEnumerator *enumerator = [[GTEnumerator alloc] initWithRepository:repo error:NULL];
+	[enumerator pushSHA:HEADCommit.SHA error:NULL];
+	NSArray *commits = [enumerator allObjectsWithError:NULL];
+	expect(@(commits.count)).to(beGreaterThan(@10));
+
+	GTObjectCache *cache = [[GTObjectCache alloc] initWithByteLimit:4096];
+	repo.objectCache = cache;
+
+	for (GTCommit *commit in commits) {
+		expect([repo lookUpObjectByOID:commit.OID error:NULL]).notTo(beNil());
+	}
+
+	expect(@(cache.byteCount)).to(beLessThanOrEqualTo(@4096));
+	expect(@(cache.evictionCount)).to(beGreaterThan(@0));
+	expect(@(cache.count + cache.evictionCount)).to(equal(@(commits.count)));
+
+	NSUInteger hitCount = cache.hitCount;
+	expect([repo lookUpObjectByOID:[commits.lastObject OID] error:NULL]).notTo(beNil());
+	expect(@(cache.hitCount)).to(equal(@(hitCount + 1)));
+
+	expect([repo lookUpObjectByOID:[commits.firstObject OID] error:NULL]).notTo(beNil());
+	expect(@(cache.hitCount)).to(equal(@(hitCount + 1)));
+});
+
+it(@"should not cache objects bigger than its limit", ^{
+	GTObjectCache *cache = [[GTObjectCache alloc] initWithByteLimit:1];
+	repo.objectCache = cache;
+
+	expect([repo lookUpObjectByOID:HEADCommit.OID error:NULL]).notTo(beNil());
+	expect(@(cache.count)).to(equal(@0));
+	expect(@(cache.evictionCount)).to(equal(@0));
+});
+
+it(@"should remove every object", ^{
+	GTObjectCache *cache = [[GTObjectCache alloc] init];
+	repo.objectCache = cache;
+
+	expect([repo lookUpObjectByOID:HEADCommit.OID error:NULL]).notTo(beNil());
+	expect([repo lookUpObjectByOID:HEADCommit.tree.OID error:NULL]).notTo(beNil());
+	expect(@(cache.count)).to(equal(@2));
+
+	[cache removeAllObjects];
+	expect(@(cache.count)).to(equal(@0));
+	expect(@(cache.byteCount)).to(equal(@0));
+	expect(@(cache.evictionCount)).to(equal(@0));
+});
+
+afterEach(^{
+	[self tearDown];
+});
+
+QuickSpecEnd
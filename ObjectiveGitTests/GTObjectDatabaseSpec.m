@@ -74,6 +74,62 @@ it(@"should be able to write", ^{
 	expect(@([database containsObjectWithSHA:testContentSHA error:NULL])).to(beTruthy());
 });
 
+describe(@"abbreviation index", ^{
+	__block GTOIDAbbreviationIndex *index;
+
+	beforeEach(^{
+		NSError *error = nil;
+		index = [database abbreviationIndexWithError:&error];
+		expect(index).notTo(beNil());
+		expect(error).to(beNil());
+		expect(@(index.count)).to(beGreaterThan(@0));
+	});
+
+	it(@"should return prefixes which tell known objects apart", ^{
+		GTRepository *repo = database.repository;
+		GTOIDSet *set = [[GTOIDSet alloc] init];
+		GTEnumerator *enumerator = [[GTEnumerator alloc] initWithRepository:repo error:NULL];
+		[enumerator pushGlob:@"refs/*" error:NULL];
+		expect(@([enumerator addRemainingOIDsToSet:set error:NULL])).to(beTruthy());
+
+		NSArray *OIDs = set.allOIDs;
+		NSArray *prefixes = [index uniqueSHAPrefixesForOIDs:OIDs minimumLength:1];
+		expect(@(prefixes.count)).to(equal(@(OIDs.count)));
+
+		for (NSUInteger i = 0; i < OIDs.count; i++) {
+			NSString *prefix = prefixes[i];
+			expect(@([[OIDs[i] SHA] hasPrefix:prefix])).to(beTruthy());
+
+			for (NSUInteger j = 0; j < OIDs.count; j++) {
+				if (i == j) continue;
+				expect(@([[OIDs[j] SHA] hasPrefix:prefix])).to(beFalsy());
+			}
+
+			GTObject *object = [repo lookUpObjectBySHA:prefix error:NULL];
+			expect(object.OID).to(equal(OIDs[i]));
+		}
+	});
+
+	it(@"should respect the minimum length", ^{
+		GTOID *OID = [[GTOID alloc] initWithSHA:@"8496071c1b46c854b31185ea97743be6a8774479"];
+		expect(@([index uniquePrefixLengthForGitOid:OID.git_oid minimumLength:7])).to(beGreaterThanOrEqualTo(@7));
+		expect(@([index uniquePrefixLengthForGitOid:OID.git_oid minimumLength:50])).to(equal(@(GIT_OID_HEXSZ)));
+		expect([index uniqueSHAPrefixesForOIDs:@[ OID ] minimumLength:GIT_OID_HEXSZ]).to(equal(@[ OID.SHA ]));
+	});
+
+	it(@"should pick up new objects when refreshed", ^{
+		NSUInteger count = index.count;
+		GTOID *OID = [database writeData:[@"abbreviate me\n" dataUsingEncoding:NSUTF8StringEncoding] type:GTObjectTypeBlob error:NULL];
+		expect(OID).notTo(beNil());
+		expect(@(index.count)).to(equal(@(count)));
+
+		NSError *error = nil;
+		expect(@([index refresh:&error])).to(beTruthy());
+		expect(error).to(beNil());
+		expect(@(index.count)).to(equal(@(count + 1)));
+	});
+});
+
 afterEach(^{
 	[self tearDown];
 });
@@ -0,0 +1,629 @@
+//
+//  GTPerformanceTests.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+@import ObjectiveGit;
+@import XCTest;
+
+#import "git2/sys/mempack.h"
+
+// Microbenchmarks comparing the batch and raw APIs with the per-object paths
+// they replace. Run them with Xcode's performance test reporting to compare
+// against the recorded baselines.
+//
+// They take minutes, so they're left out of the normal test run. The
+// "ObjectiveGit Performance" scheme sets GT_PERFORMANCE_TESTS in the
+// environment to run them:
+//
+//   xcodebuild test -workspace ObjectiveGitFramework.xcworkspace -scheme "ObjectiveGit Performance" -only-testing:ObjectiveGit-MacTests/GTPerformanceTests
+@interface GTPerformanceTests : XCTestCase
+@end
+
+static NSString * const GTPerformanceTestsEnvironmentKey = @"GT_PERFORMANCE_TESTS";
+
+@implementation GTPerformanceTests
+
++ (XCTestSuite *)defaultTestSuite {
+	if (NSProcessInfo.processInfo.environment[GTPerformanceTestsEnvironmentKey] == nil) {
+		return [[XCTestSuite alloc] initWithName:NSStringFromClass(self)];
+	}
+
+	return [super defaultTestSuite];
+}
+
+#pragma mark Fixtures
+
+static const NSUInteger GTPerformanceOIDCount = 100000;
+
+- (NSArray<NSString *> *)randomSHAs {
+	NSMutableArray *SHAs = [NSMutableArray arrayWithCapacity:GTPerformanceOIDCount];
+	for (NSUInteger i = 0; i < GTPerformanceOIDCount; i++) {
+		git_oid oid;
+		arc4random_buf(oid.id, GIT_OID_RAWSZ);
+		[SHAs addObject:[GTOID oidWithGitOid:&oid].SHA];
+	}
+
+	return SHAs;
+}
+
+// A linear history of GTPerformanceCommitCount commits, kept in an in-memory
+// object database so it can be built in seconds and shared by every test.
+static const NSUInteger GTPerformanceCommitCount = 1000000;
+
+static NSURL *GTPerformanceHistoryURL;
+static GTRepository *GTPerformanceHistoryRepository;
+static GTOID *GTPerformanceHistoryTipOID;
+static GTOID *GTPerformanceHistoryMidpointOID;
+static GTCommitGraph *GTPerformanceHistoryCommitGraph;
+
+- (void)buildSyntheticHistory {
+	static dispatch_once_t onceToken;
+	dispatch_once(&onceToken, ^{
+		NSURL *URL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:NSUUID.UUID.UUIDString] isDirectory:YES];
+		GTPerformanceHistoryURL = URL;
+
+		GTRepository *repository = [GTRepository initializeEmptyRepositoryAtFileURL:URL options:@{ GTRepositoryInitOptionsFlags: @(GTRepositoryInitBare) } error:NULL];
+		NSCAssert(repository != nil, @"Couldn't create the synthetic history repository.");
+
+		git_odb *odb = NULL;
+		git_odb_backend *mempack = NULL;
+		git_repository_odb(&odb, repository.git_repository);
+		git_mempack_new(&mempack);
+		git_odb_add_backend(odb, mempack, 1000);
+
+		git_oid tree;
+		git_odb_write(&tree, odb, "", 0, GIT_OBJECT_TREE);
+
+		char treeSHA[GIT_OID_HEXSZ + 1] = { 0 };
+		git_oid_fmt(treeSHA, &tree);
+
+		git_oid parent;
+		for (NSUInteger i = 0; i < GTPerformanceCommitCount; i++) {
+			char parentLine[GIT_OID_HEXSZ + 9] = { 0 };
+			if (i > 0) {
+				memcpy(parentLine, "parent ", 7);
+				git_oid_fmt(parentLine + 7, &parent);
+				parentLine[GIT_OID_HEXSZ + 7] = '\n';
+			}
+
+			char buffer[512];
+			long time = 1000000000 + (long)i;
+			int length = snprintf(buffer, sizeof(buffer), "tree %s\n%sauthor A U Thor <author@example.com> %ld +0000\ncommitter A U Thor <author@example.com> %ld +0000\n\nCommit %lu\n", treeSHA, parentLine, time, time, (unsigned long)i);
+			git_odb_write(&parent, odb, buffer, (size_t)length, GIT_OBJECT_COMMIT);
+
+			if (i == GTPerformanceCommitCount / 2) GTPerformanceHistoryMidpointOID = [GTOID oidWithGitOid:&parent];
+		}
+
+		git_odb_free(odb);
+
+		GTPerformanceHistoryRepository = repository;
+		GTPerformanceHistoryTipOID = [GTOID oidWithGitOid:&parent];
+
+		[repository createReferenceNamed:@"refs/heads/master" fromOID:GTPerformanceHistoryTipOID message:nil error:NULL];
+		GTPerformanceHistoryCommitGraph = [GTCommitGraph writeCommitGraphForRepository:repository error:NULL];
+		NSCAssert(GTPerformanceHistoryCommitGraph != nil, @"Couldn't write the synthetic history's commit graph.");
+	});
+}
+
+- (GTEnumerator *)syntheticHistoryEnumeratorWithOptions:(GTEnumeratorOptions)options {
+	[self buildSyntheticHistory];
+
+	GTEnumerator *enumerator = [[GTEnumerator alloc] initWithRepository:GTPerformanceHistoryRepository error:NULL];
+	[enumerator resetWithOptions:options];
+	[enumerator pushSHA:GTPerformanceHistoryTipOID.SHA error:NULL];
+	return enumerator;
+}
+
+- (GTEnumerator *)syntheticHistoryEnumerator {
+	return [self syntheticHistoryEnumeratorWithOptions:GTEnumeratorOptionsNone];
+}
+
+- (void)tearDown {
+	GTPerformanceHistoryRepository.commitGraph = nil;
+
+	[super tearDown];
+}
+
++ (void)tearDown {
+	// The history is only built once, so it's removed once every test has
+	// run, along with the commit graph written into it.
+	GTPerformanceHistoryCommitGraph = nil;
+	GTPerformanceHistoryRepository = nil;
+	if (GTPerformanceHistoryURL != nil) [NSFileManager.defaultManager removeItemAtURL:GTPerformanceHistoryURL error:NULL];
+	GTPerformanceHistoryURL = nil;
+
+	[super tearDown];
+}
+
+#pragma mark SHA conversion
+
+- (void)testParsingSHAsOneByOne {
+	NSArray *SHAs = self.randomSHAs;
+
+	[self measureBlock:^{
+		for (NSString *SHA in SHAs) {
+			XCTAssertNotNil([[GTOID alloc] initWithSHA:SHA error:NULL]);
+		}
+	}];
+}
+
+- (void)testParsingSHAsInBatch {
+	NSArray *SHAs = self.randomSHAs;
+
+	[self measureBlock:^{
+		XCTAssertEqual([GTOID OIDsWithSHAStrings:SHAs error:NULL].count, SHAs.count);
+	}];
+}
+
+- (void)testFormattingSHAsOneByOne {
+	NSArray *OIDs = [GTOID OIDsWithSHAStrings:self.randomSHAs error:NULL];
+
+	[self measureBlock:^{
+		NSMutableString *joined = [NSMutableString stringWithCapacity:OIDs.count * GIT_OID_HEXSZ];
+		for (GTOID *OID in OIDs) {
+			[joined appendString:OID.SHA];
+		}
+		XCTAssertEqual(joined.length, OIDs.count * GIT_OID_HEXSZ);
+	}];
+}
+
+- (void)testFormattingSHAsInBatch {
+	NSArray *OIDs = [GTOID OIDsWithSHAStrings:self.randomSHAs error:NULL];
+
+	[self measureBlock:^{
+		XCTAssertEqual([GTOID SHADataWithOIDs:OIDs].length, OIDs.count * GIT_OID_HEXSZ);
+	}];
+}
+
+#pragma mark Revision walking
+
+- (void)testWalkingCommitObjects {
+	[self measureBlock:^{
+		NSArray *commits = [self.syntheticHistoryEnumerator allObjectsWithError:NULL];
+		XCTAssertEqual(commits.count, GTPerformanceCommitCount);
+	}];
+}
+
+- (void)testWalkingOIDsOneByOne {
+	[self measureBlock:^{
+		GTEnumerator *enumerator = self.syntheticHistoryEnumerator;
+		NSUInteger count = 0;
+		while ([enumerator nextOIDWithSuccess:NULL error:NULL] != nil) {
+			count++;
+		}
+		XCTAssertEqual(count, GTPerformanceCommitCount);
+	}];
+}
+
+- (void)testWalkingOIDsInBatches {
+	[self measureBlock:^{
+		GTEnumerator *enumerator = self.syntheticHistoryEnumerator;
+		git_oid buffer[1024];
+		NSUInteger count = 0;
+		NSUInteger written;
+		while ((written = [enumerator nextOIDs:buffer maxCount:1024 error:NULL]) > 0) {
+			count += written;
+		}
+		XCTAssertEqual(count, GTPerformanceCommitCount);
+	}];
+}
+
+- (void)testWalkingOIDsAsData {
+	[self measureBlock:^{
+		NSData *data = [self.syntheticHistoryEnumerator nextOIDDataWithMaxCount:NSUIntegerMax error:NULL];
+		XCTAssertEqual(data.length / sizeof(git_oid), GTPerformanceCommitCount);
+	}];
+}
+
+#pragma mark Commit graph
+
+- (void)testTopologicalSortWithoutCommitGraph {
+	[self measureBlock:^{
+		GTEnumerator *enumerator = [self syntheticHistoryEnumeratorWithOptions:GTEnumeratorOptionsTopologicalSort];
+		XCTAssertEqual([enumerator countRemainingObjects:NULL], GTPerformanceCommitCount);
+	}];
+}
+
+- (void)testTopologicalSortWithCommitGraph {
+	[self buildSyntheticHistory];
+	GTPerformanceHistoryRepository.commitGraph = GTPerformanceHistoryCommitGraph;
+
+	[self measureBlock:^{
+		GTEnumerator *enumerator = [self syntheticHistoryEnumeratorWithOptions:GTEnumeratorOptionsTopologicalSort];
+		XCTAssertEqual([enumerator countRemainingObjects:NULL], GTPerformanceCommitCount);
+	}];
+}
+
+- (void)measureAheadBehindAndMergeBase {
+	[self measureBlock:^{
+		size_t ahead = 0;
+		size_t behind = 0;
+		XCTAssertTrue([GTPerformanceHistoryRepository calculateAhead:&ahead behind:&behind ofOID:GTPerformanceHistoryTipOID relativeToOID:GTPerformanceHistoryMidpointOID error:NULL]);
+		XCTAssertEqual(ahead, GTPerformanceCommitCount - GTPerformanceCommitCount / 2 - 1);
+		XCTAssertEqual(behind, (size_t)0);
+
+		GTCommit *mergeBase = [GTPerformanceHistoryRepository mergeBaseBetweenFirstOID:GTPerformanceHistoryTipOID secondOID:GTPerformanceHistoryMidpointOID error:NULL];
+		XCTAssertEqualObjects(mergeBase.OID, GTPerformanceHistoryMidpointOID);
+	}];
+}
+
+- (void)testAheadBehindAndMergeBaseWithoutCommitGraph {
+	[self buildSyntheticHistory];
+	[self measureAheadBehindAndMergeBase];
+}
+
+- (void)testAheadBehindAndMergeBaseWithCommitGraph {
+	[self buildSyntheticHistory];
+	GTPerformanceHistoryRepository.commitGraph = GTPerformanceHistoryCommitGraph;
+
+	[self measureAheadBehindAndMergeBase];
+}
+
+
+#pragma mark Commit filtering
+
+// The commits in the second half of the synthetic history, whose committer
+// times count up from this date.
+- (NSDate *)syntheticHistoryMidpointDate {
+	return [NSDate dateWithTimeIntervalSince1970:1000000000 + GTPerformanceCommitCount / 2];
+}
+
+- (void)testFilteringCommitObjects {
+	NSDate *since = self.syntheticHistoryMidpointDate;
+
+	[self measureBlock:^{
+		NSUInteger count = 0;
+		for (GTCommit *commit in self.syntheticHistoryEnumerator) {
+			if ([commit.committer.email isEqualToString:@"author@example.com"] && [commit.committer.time compare:since] != NSOrderedAscending && [commit.message hasPrefix:@"Commit"]) count++;
+		}
+		XCTAssertEqual(count, GTPerformanceCommitCount - GTPerformanceCommitCount / 2);
+	}];
+}
+
+- (void)testFilteringRawCommits {
+	GTCommitFilter *filter = [[GTCommitFilter alloc] init];
+	filter.committerEmail = @"author@example.com";
+	filter.since = self.syntheticHistoryMidpointDate;
+	XCTAssertTrue([filter setMessagePattern:@"^Commit" caseInsensitive:NO error:NULL]);
+
+	[self measureBlock:^{
+		GTEnumerator *enumerator = self.syntheticHistoryEnumerator;
+		enumerator.commitFilter = filter;
+
+		NSUInteger count = 0;
+		for (GTCommit *commit __unused in enumerator) {
+			count++;
+		}
+		XCTAssertEqual(count, GTPerformanceCommitCount - GTPerformanceCommitCount / 2);
+	}];
+}
+
+
+#pragma mark Lazy commits
+
+static const NSUInteger GTPerformancePageCommitCount = 100000;
+
+// Pages through the newest commits the way a log listing would, keeping them
+// alive so the memory metric sees the cost of the whole page.
+- (void)measurePagingThroughCommitsLazily:(BOOL)lazily {
+	[self buildSyntheticHistory];
+
+	void (^block)(void) = ^{
+		GTEnumerator *enumerator = self.syntheticHistoryEnumerator;
+		enumerator.returnsLazyCommits = lazily;
+
+		NSMutableArray *page = [NSMutableArray arrayWithCapacity:GTPerformancePageCommitCount];
+		while (page.count < GTPerformancePageCommitCount) {
+			GTCommit *commit = [enumerator nextObject];
+			XCTAssertNotNil(commit.OID);
+			XCTAssertNotNil(commit.messageSummary);
+			XCTAssertNotNil(commit.author.time);
+			[page addObject:commit];
+		}
+	};
+
+	if (@available(macOS 10.15, iOS 13.0, *)) {
+		[self measureWithMetrics:@[ [[XCTClockMetric alloc] init], [[XCTMemoryMetric alloc] init] ] block:block];
+	} else {
+		[self measureBlock:block];
+	}
+}
+
+- (void)testPagingThroughParsedCommits {
+	[self measurePagingThroughCommitsLazily:NO];
+}
+
+- (void)testPagingThroughLazyCommits {
+	[self measurePagingThroughCommitsLazily:YES];
+}
+
+
+#pragma mark Object cache
+
+static const NSUInteger GTPerformanceTreeEntryCount = 10000;
+static const NSUInteger GTPerformanceTreeLookupCount = 1000;
+
+// Writes a flat tree with GTPerformanceTreeEntryCount entries, which is too
+// big for libgit2's own cache to keep.
+- (GTOID *)writeLargeTree {
+	[self buildSyntheticHistory];
+
+	git_odb *odb = NULL;
+	git_repository_odb(&odb, GTPerformanceHistoryRepository.git_repository);
+
+	git_oid blob;
+	git_odb_write(&blob, odb, "", 0, GIT_OBJECT_BLOB);
+
+	NSMutableData *data = [NSMutableData data];
+	for (NSUInteger i = 0; i < GTPerformanceTreeEntryCount; i++) {
+		char name[32];
+		int length = snprintf(name, sizeof(name), "100644 file-%06lu", (unsigned long)i);
+		[data appendBytes:name length:(NSUInteger)length + 1];
+		[data appendBytes:blob.id length:GIT_OID_RAWSZ];
+	}
+
+	git_oid tree;
+	git_odb_write(&tree, odb, data.bytes, data.length, GIT_OBJECT_TREE);
+	git_odb_free(odb);
+
+	return [GTOID oidWithGitOid:&tree];
+}
+
+- (void)measureLookingUpLargeTreeWithCache:(GTObjectCache *)cache {
+	GTOID *treeOID = [self writeLargeTree];
+	GTPerformanceHistoryRepository.objectCache = cache;
+
+	[self measureBlock:^{
+		for (NSUInteger i = 0; i < GTPerformanceTreeLookupCount; i++) {
+			GTTree *tree = [GTPerformanceHistoryRepository lookUpObjectByOID:treeOID objectType:GTObjectTypeTree error:NULL];
+			XCTAssertEqual(tree.entryCount, GTPerformanceTreeEntryCount);
+		}
+	}];
+
+	GTPerformanceHistoryRepository.objectCache = nil;
+}
+
+- (void)testLookingUpLargeTreeWithoutCache {
+	[self measureLookingUpLargeTreeWithCache:nil];
+}
+
+- (void)testLookingUpLargeTreeWithCache {
+	[self measureLookingUpLargeTreeWithCache:[[GTObjectCache alloc] init]];
+}
+
+
+#pragma mark Repository discovery
+
+static const NSUInteger GTPerformanceOpenCount = 10000;
+
+// A non-bare repository, and a directory four levels deep inside it, so every
+// discovering open has to walk up to find it.
+- (NSURL *)nestedDirectoryInTemporaryRepository {
+	NSURL *URL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:NSUUID.UUID.UUIDString] isDirectory:YES];
+	GTRepository *repository = [GTRepository initializeEmptyRepositoryAtFileURL:URL options:nil error:NULL];
+	XCTAssertNotNil(repository);
+
+	NSURL *nestedURL = [URL URLByAppendingPathComponent:@"a/b/c/d" isDirectory:YES];
+	XCTAssertTrue([NSFileManager.defaultManager createDirectoryAtURL:nestedURL withIntermediateDirectories:YES attributes:nil error:NULL]);
+
+	return nestedURL;
+}
+
+- (void)testOpeningRepositoryWithDiscovery {
+	NSURL *URL = [self nestedDirectoryInTemporaryRepository];
+
+	[self measureBlock:^{
+		for (NSUInteger i = 0; i < GTPerformanceOpenCount; i++) {
+			XCTAssertNotNil([[GTRepository alloc] initWithURL:URL flags:0 ceilingDirs:nil error:NULL]);
+		}
+	}];
+}
+
+- (void)testOpeningRepositoryWithDiscoveryCache {
+	NSURL *URL = [self nestedDirectoryInTemporaryRepository];
+	GTRepositoryDiscoveryCache *cache = [[GTRepositoryDiscoveryCache alloc] init];
+
+	[self measureBlock:^{
+		for (NSUInteger i = 0; i < GTPerformanceOpenCount; i++) {
+			XCTAssertNotNil([cache openRepositoryAtURL:URL flags:0 ceilingDirs:nil error:NULL]);
+		}
+	}];
+}
+
+- (void)testOpeningRepositoryWithTrustedOpen {
+	GTRepository *repository = [[GTRepository alloc] initWithURL:[self nestedDirectoryInTemporaryRepository] flags:0 ceilingDirs:nil error:NULL];
+	NSURL *gitDirectoryURL = repository.gitDirectoryURL;
+	NSURL *workingDirectoryURL = repository.fileURL;
+
+	[self measureBlock:^{
+		for (NSUInteger i = 0; i < GTPerformanceOpenCount; i++) {
+			XCTAssertNotNil([[GTRepository alloc] initWithGitDirectoryURL:gitDirectoryURL workingDirectoryURL:workingDirectoryURL error:NULL]);
+		}
+	}];
+}
+
+
+
+#pragma mark Parallel patches
+
+static const NSUInteger GTPerformanceDiffFileCount = 2000;
+static const NSUInteger GTPerformanceDiffLineCount = 500;
+
+// Writes a tree of GTPerformanceDiffFileCount files, changing every 50th line
+// of each file when `modified` is set.
+- (git_oid)writeDiffTreeInODB:(git_odb *)odb modified:(BOOL)modified {
+	NSMutableData *treeData = [NSMutableData data];
+	for (NSUInteger file = 0; file < GTPerformanceDiffFileCount; file++) {
+		NSMutableString *contents = [NSMutableString string];
+		for (NSUInteger line = 0; line < GTPerformanceDiffLineCount; line++) {
+			[contents appendFormat:@"line %lu of file %lu%@\n", (unsigned long)line, (unsigned long)file, (modified && line % 50 == 0 ? @" changed" : @"")];
+		}
+
+		NSData *blobData = [contents dataUsingEncoding:NSUTF8StringEncoding];
+		git_oid blob;
+		git_odb_write(&blob, odb, blobData.bytes, blobData.length, GIT_OBJECT_BLOB);
+
+		char name[32];
+		int length = snprintf(name, sizeof(name), "100644 file-%06lu", (unsigned long)file);
+		[treeData appendBytes:name length:(NSUInteger)length + 1];
+		[treeData appendBytes:blob.id length:GIT_OID_RAWSZ];
+	}
+
+	git_oid tree;
+	git_odb_write(&tree, odb, treeData.bytes, treeData.length, GIT_OBJECT_TREE);
+	return tree;
+}
+
+// A diff where every file is modified. Workers open their own handles, so it
+// lives on disk rather than in the in-memory history.
+- (GTDiff *)largeModificationDiff {
+	NSURL *URL = [NSURL fileURLWithPath:[NSTemporaryDirectory() stringByAppendingPathComponent:NSUUID.UUID.UUIDString] isDirectory:YES];
+	GTRepository *repository = [GTRepository initializeEmptyRepositoryAtFileURL:URL options:@{ GTRepositoryInitOptionsFlags: @(GTRepositoryInitBare) } error:NULL];
+	XCTAssertNotNil(repository);
+
+	git_odb *odb = NULL;
+	git_repository_odb(&odb, repository.git_repository);
+	git_oid oldTreeOID = [self writeDiffTreeInODB:odb modified:NO];
+	git_oid newTreeOID = [self writeDiffTreeInODB:odb modified:YES];
+	git_odb_free(odb);
+
+	GTTree *oldTree = [repository lookUpObjectByOID:[GTOID oidWithGitOid:&oldTreeOID] objectType:GTObjectTypeTree error:NULL];
+	GTTree *newTree = [repository lookUpObjectByOID:[GTOID oidWithGitOid:&newTreeOID] objectType:GTObjectTypeTree error:NULL];
+	GTDiff *diff = [GTDiff diffOldTree:oldTree withNewTree:newTree inRepository:repository options:nil error:NULL];
+	XCTAssertEqual(diff.deltaCount, GTPerformanceDiffFileCount);
+
+	return diff;
+}
+
+- (void)testGeneratingPatchesSerially {
+	GTDiff *diff = [self largeModificationDiff];
+
+	[self measureBlock:^{
+		__block NSUInteger addedLineCount = 0;
+		[diff enumerateDeltasUsingBlock:^(GTDiffDelta *delta, BOOL *stop) {
+			addedLineCount += [delta generatePatch:NULL].addedLinesCount;
+		}];
+		XCTAssertEqual(addedLineCount, GTPerformanceDiffFileCount * GTPerformanceDiffLineCount / 50);
+	}];
+}
+
+- (void)testGeneratingPatchesInParallel {
+	GTDiff *diff = [self largeModificationDiff];
+
+	[self measureBlock:^{
+		__block NSUInteger addedLineCount = 0;
+		[diff enumeratePatchesWithOptions:nil error:NULL usingBlock:^(GTDiffPatch *patch, NSTimeInterval generationTime, BOOL *stop) {
+			addedLineCount += patch.addedLinesCount;
+		}];
+		XCTAssertEqual(addedLineCount, GTPerformanceDiffFileCount * GTPerformanceDiffLineCount / 50);
+	}];
+}
+
+
+#pragma mark Diff writing
+
+- (void)testBuildingDiffText {
+	GTDiff *diff = [self largeModificationDiff];
+
+	[self measureBlock:^{
+		NSMutableData *data = [NSMutableData data];
+		[diff enumerateDeltasUsingBlock:^(GTDiffDelta *delta, BOOL *stop) {
+			[data appendData:[delta generatePatch:NULL].patchData];
+		}];
+		XCTAssertGreaterThan(data.length, 0);
+	}];
+}
+
+- (void)testStreamingDiffText {
+	GTDiff *diff = [self largeModificationDiff];
+
+	[self measureBlock:^{
+		int fileDescriptor = open("/dev/null", O_WRONLY);
+		GTDiffWriter *writer = [[GTDiffWriter alloc] initWithFileDescriptor:fileDescriptor];
+		XCTAssertTrue([writer writeDiff:diff format:GTDiffWriterFormatPatch error:NULL]);
+		XCTAssertGreaterThan(writer.bytesWritten, 0);
+		close(fileDescriptor);
+	}];
+}
+
+
+#pragma mark Diff stats
+
+- (void)testCountingDiffStats {
+	GTDiff *diff = [self largeModificationDiff];
+
+	[self measureBlock:^{
+		GTDiffStats *stats = [GTDiffStats statsWithDiff:diff error:NULL];
+		XCTAssertEqual(stats.insertions, GTPerformanceDiffFileCount * GTPerformanceDiffLineCount / 50);
+	}];
+}
+
+
+#pragma mark Delta tables
+
+- (void)testReadingDeltaPathsFromWrappers {
+	GTDiff *diff = [self largeModificationDiff];
+
+	[self measureBlock:^{
+		__block NSUInteger pathsLength = 0;
+		[diff enumerateDeltasUsingBlock:^(GTDiffDelta *delta, BOOL *stop) {
+			pathsLength += delta.oldFile.path.length + delta.newFile.path.length;
+		}];
+		XCTAssertGreaterThan(pathsLength, 0);
+	}];
+}
+
+- (void)testReadingDeltaPathsFromTable {
+	GTDiff *diff = [self largeModificationDiff];
+
+	[self measureBlock:^{
+		GTDiffDeltaTable *table = [GTDiffDeltaTable deltaTableWithDiff:diff error:NULL];
+		[table sortUsingOrder:GTDiffDeltaTableOrderPath];
+
+		NSUInteger pathsLength = 0;
+		for (NSUInteger idx = 0; idx < table.count; idx++) {
+			pathsLength += strlen([table pathOfOldFileAtIndex:idx]) + strlen([table pathOfNewFileAtIndex:idx]);
+		}
+		XCTAssertGreaterThan(pathsLength, 0);
+	}];
+}
+
+
+#pragma mark Diff lines
+
+- (void)testEnumeratingDiffLines {
+	GTDiff *diff = [self largeModificationDiff];
+
+	[self measureBlock:^{
+		__block NSUInteger contentLength = 0;
+		[diff enumerateDeltasUsingBlock:^(GTDiffDelta *delta, BOOL *stop) {
+			[[delta generatePatch:NULL] enumerateHunksUsingBlock:^(GTDiffHunk *hunk, BOOL *stop) {
+				[hunk enumerateLinesInHunk:NULL usingBlock:^(GTDiffLine *line, BOOL *stop) {
+					contentLength += line.content.length;
+				}];
+			}];
+		}];
+		XCTAssertGreaterThan(contentLength, 0);
+	}];
+}
+
+- (void)testEnumeratingDiffLineSpans {
+	GTDiff *diff = [self largeModificationDiff];
+
+	[self measureBlock:^{
+		__block NSUInteger contentLength = 0;
+		[diff enumerateDeltasUsingBlock:^(GTDiffDelta *delta, BOOL *stop) {
+			[[delta generatePatch:NULL] enumerateHunksUsingBlock:^(GTDiffHunk *hunk, BOOL *stop) {
+				[hunk enumerateLineSpansWithError:NULL usingBlock:^(GTDiffLineSpan span, BOOL *stop) {
+					contentLength += span.contentLength;
+				}];
+			}];
+		}];
+		XCTAssertGreaterThan(contentLength, 0);
+	}];
+}
+
+@end
@@ -0,0 +1,99 @@
+//
+//  GTPrefetchingEnumeratorSpec.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+@import ObjectiveGit;
+@import Nimble;
+@import Quick;
+
+#import "QuickSpec+GTFixtures.h"
+
+QuickSpecBegin(GTPrefetchingEnumeratorSpec)
+
+__block GTRepository *repo;
+__block NSArray *expectedSHAs;
+
+beforeEach(^{
+	repo = self.testAppFixtureRepository;
+	expect(repo).notTo(beNil());
+
+	GTEnumerator *enumerator = [[GTEnumerator alloc] initWithRepository:repo error:NULL];
+	[enumerator resetWithOptions:GTEnumeratorOptionsTopologicalSort];
+	expect(@([enumerator pushGlob:@"refs/heads/*" error:NULL])).to(beTruthy());
+
+	expectedSHAs = [[enumerator allObjectsWithError:NULL] valueForKey:@"SHA"];
+	expect(@(expectedSHAs.count)).to(beGreaterThan(@1));
+});
+
+GTPrefetchingEnumerator * (^prefetchingEnumerator)(NSUInteger) = ^(NSUInteger bufferSize) {
+	NSError *error = nil;
+	GTPrefetchingEnumerator *enumerator = [[GTPrefetchingEnumerator alloc] initWithRepository:repo options:GTEnumeratorOptionsTopologicalSort bufferSize:bufferSize configureBlock:^(GTEnumerator *walk, NSError **walkError) {
+		return [walk pushGlob:@"refs/heads/*" error:walkError];
+	} error:&error];
+	expect(enumerator).notTo(beNil());
+	expect(error).to(beNil());
+
+	return enumerator;
+};
+
+it(@"should deliver commits in the same order as GTEnumerator", ^{
+	NSError *error = nil;
+	NSArray *commits = [prefetchingEnumerator(GTPrefetchingEnumeratorDefaultBufferSize) allObjectsWithError:&error];
+	expect(error).to(beNil());
+	expect([commits valueForKey:@"SHA"]).to(equal(expectedSHAs));
+});
+
+it(@"should apply back-pressure with a small buffer", ^{
+	GTPrefetchingEnumerator *enumerator = prefetchingEnumerator(1);
+
+	NSMutableArray *SHAs = [NSMutableArray array];
+	for (GTCommit *commit in enumerator) {
+		expect(commit).to(beAnInstanceOf(GTCommit.class));
+		[SHAs addObject:commit.SHA];
+	}
+
+	expect(SHAs).to(equal(expectedSHAs));
+
+	BOOL success = NO;
+	expect([enumerator nextObjectWithSuccess:&success error:NULL]).to(beNil());
+	expect(@(success)).to(beTruthy());
+});
+
+it(@"should deliver commits belonging to the repository", ^{
+	for (GTCommit *commit in prefetchingEnumerator(2)) {
+		expect(commit.repository).to(beIdenticalTo(repo));
+		expect(commit.tree).notTo(beNil());
+		expect(@(commit.parents.count)).to(equal(@(commit.parentOIDs.count)));
+	}
+});
+
+it(@"should stop delivering commits once cancelled", ^{
+	GTPrefetchingEnumerator *enumerator = prefetchingEnumerator(1);
+	expect([enumerator nextObject]).notTo(beNil());
+
+	[enumerator cancel];
+	expect(@(enumerator.cancelled)).to(beTruthy());
+
+	BOOL success = NO;
+	expect([enumerator nextObjectWithSuccess:&success error:NULL]).to(beNil());
+	expect(@(success)).to(beTruthy());
+});
+
+it(@"should fail if the walk can't be configured", ^{
+	NSError *error = nil;
+	GTPrefetchingEnumerator *enumerator = [[GTPrefetchingEnumerator alloc] initWithRepository:repo options:GTEnumeratorOptionsNone bufferSize:1 configureBlock:^(GTEnumerator *walk, NSError **walkError) {
+		return [walk pushSHA:@"0000000000000000000000000000000000000000" error:walkError];
+	} error:&error];
+
+	expect(enumerator).to(beNil());
+	expect(error).notTo(beNil());
+});
+
+afterEach(^{
+	[self tearDown];
+});
+
+QuickSpecEnd
@@ -0,0 +1,108 @@
+//
+//  GTReferenceCacheSpec.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+@import ObjectiveGit;
+@import Nimble;
+@import Quick;
+
+#import "QuickSpec+GTFixtures.h"
+
+QuickSpecBegin(GTReferenceCacheSpec)
+
+__block GTRepository *repository;
+__block GTReferenceCache *cache;
+
+beforeEach(^{
+	repository = self.testAppFixtureRepository;
+	expect(repository).notTo(beNil());
+
+	cache = [[GTReferenceCache alloc] initWithRepository:repository];
+	repository.referenceCache = cache;
+});
+
+it(@"should answer repeated lookups from the cache", ^{
+	NSError *error = nil;
+	GTReference *ref = [repository lookUpReferenceWithName:@"refs/heads/master" error:&error];
+	expect(ref).notTo(beNil());
+	expect(error).to(beNil());
+	expect(@(cache.missCount)).to(equal(@1));
+	expect(@(cache.count)).to(equal(@1));
+
+	GTReference *cachedRef = [repository lookUpReferenceWithName:@"refs/heads/master" error:&error];
+	expect(cachedRef.name).to(equal(ref.name));
+	expect(cachedRef.targetOID).to(equal(ref.targetOID));
+	expect(@(cache.hitCount)).to(equal(@1));
+	expect(@(cache.staleCount)).to(equal(@0));
+});
+
+it(@"should notice references which changed on disk", ^{
+	GTReference *ref = [repository lookUpReferenceWithName:@"refs/heads/master" error:NULL];
+	GTCommit *commit = [repository lookUpObjectByOID:ref.targetOID objectType:GTObjectTypeCommit error:NULL];
+	GTCommit *parent = commit.parents.firstObject;
+	expect(parent).notTo(beNil());
+
+	GTReference *updatedRef = [ref referenceByUpdatingTarget:parent.SHA message:nil error:NULL];
+	expect(updatedRef).notTo(beNil());
+
+	GTReference *cachedRef = [repository lookUpReferenceWithName:@"refs/heads/master" error:NULL];
+	expect(cachedRef.targetOID).to(equal(parent.OID));
+	expect(@(cache.staleCount)).to(equal(@1));
+});
+
+it(@"should resolve HEAD through the cache", ^{
+	repository.referenceCache = nil;
+	GTReference *expectedHEAD = [repository headReferenceWithError:NULL];
+	expect(expectedHEAD).notTo(beNil());
+
+	repository.referenceCache = cache;
+	NSError *error = nil;
+	GTReference *HEAD = [repository headReferenceWithError:&error];
+	expect(HEAD).notTo(beNil());
+	expect(error).to(beNil());
+	expect(HEAD.name).to(equal(expectedHEAD.name));
+	expect(HEAD.targetOID).to(equal(expectedHEAD.targetOID));
+
+	GTBranch *branch = [repository currentBranchWithError:NULL];
+	expect(branch.name).to(equal(expectedHEAD.name));
+	expect(@(cache.hitCount)).to(beGreaterThan(@0));
+});
+
+it(@"should report unborn branches", ^{
+	NSURL *URL = [self.tempDirectoryFileURL URLByAppendingPathComponent:@"unborn-repository"];
+	GTRepository *emptyRepository = [GTRepository initializeEmptyRepositoryAtFileURL:URL options:nil error:NULL];
+	expect(emptyRepository).notTo(beNil());
+	emptyRepository.referenceCache = [[GTReferenceCache alloc] initWithRepository:emptyRepository];
+
+	NSError *error = nil;
+	expect([emptyRepository headReferenceWithError:&error]).to(beNil());
+	expect(@(error.code)).to(equal(@(GIT_EUNBORNBRANCH)));
+});
+
+it(@"should fail to look up missing references", ^{
+	NSError *error = nil;
+	expect([repository lookUpReferenceWithName:@"refs/heads/does-not-exist" error:&error]).to(beNil());
+	expect(error).notTo(beNil());
+	expect(@(cache.count)).to(equal(@0));
+});
+
+it(@"should forget invalidated references", ^{
+	expect([repository lookUpReferenceWithName:@"refs/heads/master" error:NULL]).notTo(beNil());
+	expect([repository lookUpReferenceWithName:@"HEAD" error:NULL]).notTo(beNil());
+	expect(@(cache.count)).to(equal(@2));
+
+	[cache invalidateReferenceNamed:@"HEAD"];
+	expect(@(cache.count)).to(equal(@1));
+
+	[cache invalidateAllReferences];
+	expect(@(cache.count)).to(equal(@0));
+});
+
+afterEach(^{
+	[self tearDown];
+});
+
+QuickSpecEnd
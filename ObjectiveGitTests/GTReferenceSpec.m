@@ -190,6 +190,58 @@ describe(@"-deleteWithError:", ^{
 	});
 });
 
+describe(@"-enumerateReferencesMatchingGlob:error:usingBlock:", ^{
+	it(@"should enumerate every reference without a glob", ^{
+		NSMutableArray *names = [NSMutableArray array];
+		NSError *error = nil;
+		BOOL success = [bareRepository enumerateReferencesMatchingGlob:nil error:&error usingBlock:^(GTReferenceEnumerationEntry *entry, BOOL *stop) {
+			[names addObject:entry.name];
+		}];
+		expect(@(success)).to(beTruthy());
+		expect(error).to(beNil());
+
+		NSArray *expectedNames = [bareRepository referenceNamesWithError:NULL];
+		expect([NSSet setWithArray:names]).to(equal([NSSet setWithArray:expectedNames]));
+	});
+
+	it(@"should only enumerate references matching the glob", ^{
+		NSMutableArray *names = [NSMutableArray array];
+		BOOL success = [bareRepository enumerateReferencesMatchingGlob:@"refs/heads/*" error:NULL usingBlock:^(GTReferenceEnumerationEntry *entry, BOOL *stop) {
+			[names addObject:entry.name];
+
+			GTReference *ref = entry.reference;
+			expect(ref.name).to(equal(entry.name));
+			expect(@(entry.referenceType)).to(equal(@(ref.referenceType)));
+			expect(entry.OID).to(equal(ref.targetOID));
+			expect(entry.symbolicTargetName).to(beNil());
+		}];
+		expect(@(success)).to(beTruthy());
+		expect(names).to(contain(@"refs/heads/master"));
+
+		for (NSString *name in names) {
+			expect(@([name hasPrefix:@"refs/heads/"])).to(beTruthy());
+		}
+	});
+
+	it(@"should stop early", ^{
+		__block NSUInteger count = 0;
+		BOOL success = [bareRepository enumerateReferencesMatchingGlob:nil error:NULL usingBlock:^(GTReferenceEnumerationEntry *entry, BOOL *stop) {
+			count++;
+			*stop = YES;
+		}];
+		expect(@(success)).to(beTruthy());
+		expect(@(count)).to(equal(@1));
+	});
+
+	it(@"should keep references created from entries", ^{
+		__block GTReference *ref = nil;
+		[bareRepository enumerateReferencesMatchingGlob:@"refs/heads/master" error:NULL usingBlock:^(GTReferenceEnumerationEntry *entry, BOOL *stop) {
+			ref = entry.reference;
+		}];
+		expectValidReference(ref, @"36060c58702ed4c2a40832c51758d5344201d89a", GTReferenceTypeDirect, @"refs/heads/master");
+	});
+});
+
 afterEach(^{
 	[self tearDown];
 });
@@ -0,0 +1,119 @@
+//
+//  GTRepositoryAsyncSpec.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+@import ObjectiveGit;
+@import Nimble;
+@import Quick;
+
+#import "QuickSpec+GTFixtures.h"
+
+QuickSpecBegin(GTRepositoryAsyncSpec)
+
+__block GTRepository *repository;
+
+beforeEach(^{
+	repository = self.testAppFixtureRepository;
+	expect(repository).notTo(beNil());
+});
+
+it(@"should run operations on a bounded queue", ^{
+	NSOperationQueue *queue = GTRepository.asyncOperationQueue;
+	expect(queue).notTo(beNil());
+	expect(@(queue.maxConcurrentOperationCount)).to(equal(@(NSProcessInfo.processInfo.activeProcessorCount)));
+	expect(GTRepository.asyncOperationQueue).to(beIdenticalTo(queue));
+});
+
+it(@"should clone a repository", ^{
+	NSURL *originURL = self.bareFixtureRepository.gitDirectoryURL;
+	NSURL *workdirURL = [self.tempDirectoryFileURL URLByAppendingPathComponent:@"async-clone"];
+
+	__block GTRepository *clone = nil;
+	__block NSError *cloneError = nil;
+	waitUntil(^(void (^done)(void)) {
+		[GTRepository cloneFromURL:originURL toWorkingDirectory:workdirURL options:@{ GTRepositoryCloneOptionsCloneLocal: @YES } cancellationToken:nil transferProgressBlock:nil completion:^(GTRepository *repository, NSError *error) {
+			clone = repository;
+			cloneError = error;
+			done();
+		}];
+	});
+
+	expect(clone).notTo(beNil());
+	expect(cloneError).to(beNil());
+	expect([clone headReferenceWithError:NULL]).notTo(beNil());
+});
+
+it(@"should diff trees", ^{
+	GTCommit *HEADCommit = [repository lookUpObjectByRevParse:@"HEAD" error:NULL];
+	GTCommit *parent = HEADCommit.parents.firstObject;
+	expect(parent).notTo(beNil());
+
+	__block GTDiff *diff = nil;
+	__block NSError *diffError = nil;
+	waitUntil(^(void (^done)(void)) {
+		[repository diffOldTree:parent.tree withNewTree:HEADCommit.tree options:nil cancellationToken:[[GTCancellationToken alloc] init] completion:^(GTDiff *result, NSError *error) {
+			diff = result;
+			diffError = error;
+			done();
+		}];
+	});
+
+	expect(diff).notTo(beNil());
+	expect(diffError).to(beNil());
+	expect(@(diff.deltaCount)).to(equal(@([GTDiff diffOldTree:parent.tree withNewTree:HEADCommit.tree inRepository:repository options:nil error:NULL].deltaCount)));
+});
+
+it(@"should not start cancelled operations", ^{
+	GTCancellationToken *token = [[GTCancellationToken alloc] init];
+	[token cancel];
+	expect(@(token.cancelled)).to(beTruthy());
+
+	__block GTDiff *diff = nil;
+	__block NSError *diffError = nil;
+	waitUntil(^(void (^done)(void)) {
+		[repository diffOldTree:nil withNewTree:nil options:nil cancellationToken:token completion:^(GTDiff *result, NSError *error) {
+			diff = result;
+			diffError = error;
+			done();
+		}];
+	});
+
+	expect(diff).to(beNil());
+	expect(diffError.domain).to(equal(NSCocoaErrorDomain));
+	expect(@(diffError.code)).to(equal(@(NSUserCancelledError)));
+});
+
+it(@"should cancel a running status enumeration", ^{
+	for (NSString *fileName in @[ @"new-file-1.txt", @"new-file-2.txt" ]) {
+		NSURL *fileURL = [repository.fileURL URLByAppendingPathComponent:fileName];
+		expect(@([@"new" writeToURL:fileURL atomically:YES encoding:NSUTF8StringEncoding error:NULL])).to(beTruthy());
+	}
+
+	GTCancellationToken *token = [[GTCancellationToken alloc] init];
+	__block NSUInteger count = 0;
+	__block BOOL statusSuccess = YES;
+	__block NSError *statusError = nil;
+	waitUntil(^(void (^done)(void)) {
+		[repository enumerateFileStatusWithOptions:nil cancellationToken:token usingBlock:^(GTStatusDelta *headToIndex, GTStatusDelta *indexToWorkingDirectory, BOOL *stop) {
+			count++;
+			[token cancel];
+		} completion:^(BOOL success, NSError *error) {
+			statusSuccess = success;
+			statusError = error;
+			done();
+		}];
+	});
+
+	expect(@(count)).to(equal(@1));
+	expect(@(statusSuccess)).to(beFalsy());
+	expect(@(statusError.code)).to(equal(@(NSUserCancelledError)));
+});
+
+afterEach(^{
+	[self tearDown];
+});
+
+QuickSpecEnd
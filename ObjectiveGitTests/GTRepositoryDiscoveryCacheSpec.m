@@ -0,0 +1,128 @@
+//
+//  GTRepositoryDiscoveryCacheSpec.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+@import ObjectiveGit;
+@import Nimble;
+@import Quick;
+
+#import "QuickSpec+GTFixtures.h"
+
+QuickSpecBegin(GTRepositoryDiscoveryCacheSpec)
+
+__block GTRepositoryDiscoveryCache *cache;
+__block NSURL *repositoryURL;
+__block NSURL *nestedURL;
+
+beforeEach(^{
+	cache = [[GTRepositoryDiscoveryCache alloc] init];
+
+	repositoryURL = [self.tempDirectoryFileURL URLByAppendingPathComponent:@"discovery-repo" isDirectory:YES];
+	expect([GTRepository initializeEmptyRepositoryAtFileURL:repositoryURL options:nil error:NULL]).notTo(beNil());
+
+	nestedURL = [repositoryURL URLByAppendingPathComponent:@"a/b" isDirectory:YES];
+	expect(@([NSFileManager.defaultManager createDirectoryAtURL:nestedURL withIntermediateDirectories:YES attributes:nil error:NULL])).to(beTruthy());
+});
+
+describe(@"-initWithGitDirectoryURL:workingDirectoryURL:error:", ^{
+	it(@"should open the same repository as discovery", ^{
+		GTRepository *discovered = [[GTRepository alloc] initWithURL:nestedURL flags:0 ceilingDirs:nil error:NULL];
+		expect(discovered).notTo(beNil());
+
+		NSError *error = nil;
+		GTRepository *repository = [[GTRepository alloc] initWithGitDirectoryURL:discovered.gitDirectoryURL workingDirectoryURL:discovered.fileURL error:&error];
+		expect(repository).notTo(beNil());
+		expect(error).to(beNil());
+		expect(repository.gitDirectoryURL).to(equal(discovered.gitDirectoryURL));
+		expect(repository.fileURL).to(equal(discovered.fileURL));
+		expect(@(repository.isBare)).to(beFalsy());
+	});
+
+	it(@"should open a repository as bare without a working directory", ^{
+		GTRepository *bareRepository = self.bareFixtureRepository;
+
+		NSError *error = nil;
+		GTRepository *repository = [[GTRepository alloc] initWithGitDirectoryURL:bareRepository.gitDirectoryURL workingDirectoryURL:nil error:&error];
+		expect(repository).notTo(beNil());
+		expect(error).to(beNil());
+		expect(@(repository.isBare)).to(beTruthy());
+		expect([repository headReferenceWithError:NULL]).notTo(beNil());
+	});
+
+	it(@"should fail for a directory which isn't a git directory", ^{
+		NSError *error = nil;
+		expect([[GTRepository alloc] initWithGitDirectoryURL:nestedURL workingDirectoryURL:nil error:&error]).to(beNil());
+		expect(error).notTo(beNil());
+	});
+});
+
+describe(@"-openRepositoryAtURL:flags:ceilingDirs:error:", ^{
+	it(@"should skip discovery once a path is known", ^{
+		GTRepository *first = [cache openRepositoryAtURL:nestedURL flags:0 ceilingDirs:nil error:NULL];
+		expect(first).notTo(beNil());
+		expect(@(cache.missCount)).to(equal(@1));
+		expect(@(cache.count)).to(equal(@1));
+
+		GTRepository *second = [cache openRepositoryAtURL:nestedURL flags:0 ceilingDirs:nil error:NULL];
+		expect(second).notTo(beNil());
+		expect(@(cache.hitCount)).to(equal(@1));
+		expect(second.gitDirectoryURL).to(equal(first.gitDirectoryURL));
+		expect(second.fileURL).to(equal(first.fileURL));
+	});
+
+	it(@"should keep separate entries for different ceilings", ^{
+		expect([cache openRepositoryAtURL:nestedURL flags:0 ceilingDirs:nil error:NULL]).notTo(beNil());
+		expect([cache openRepositoryAtURL:nestedURL flags:0 ceilingDirs:@[ repositoryURL ] error:NULL]).to(beNil());
+		expect(@(cache.missCount)).to(equal(@2));
+		expect(@(cache.hitCount)).to(equal(@0));
+	});
+
+	it(@"should notice a repository created at the path", ^{
+		expect([cache openRepositoryAtURL:nestedURL flags:0 ceilingDirs:nil error:NULL]).notTo(beNil());
+
+		GTRepository *innerRepository = [GTRepository initializeEmptyRepositoryAtFileURL:nestedURL options:nil error:NULL];
+		expect(innerRepository).notTo(beNil());
+
+		GTRepository *repository = [cache openRepositoryAtURL:nestedURL flags:0 ceilingDirs:nil error:NULL];
+		expect(repository.gitDirectoryURL).to(equal(innerRepository.gitDirectoryURL));
+		expect(@(cache.staleCount)).to(equal(@1));
+	});
+
+	it(@"should notice a repository which was replaced", ^{
+		GTRepository *first = [cache openRepositoryAtURL:nestedURL flags:0 ceilingDirs:nil error:NULL];
+		expect(first).notTo(beNil());
+
+		expect(@([NSFileManager.defaultManager removeItemAtURL:first.gitDirectoryURL error:NULL])).to(beTruthy());
+
+		NSError *error = nil;
+		expect([cache openRepositoryAtURL:nestedURL flags:0 ceilingDirs:nil error:&error]).to(beNil());
+		expect(error).notTo(beNil());
+		expect(@(cache.staleCount)).to(equal(@1));
+		expect(@(cache.count)).to(equal(@0));
+
+		expect([GTRepository initializeEmptyRepositoryAtFileURL:repositoryURL options:nil error:NULL]).notTo(beNil());
+		expect([cache openRepositoryAtURL:nestedURL flags:0 ceilingDirs:nil error:NULL]).notTo(beNil());
+		expect(@(cache.count)).to(equal(@1));
+	});
+
+	it(@"should forget removed entries", ^{
+		expect([cache openRepositoryAtURL:nestedURL flags:0 ceilingDirs:nil error:NULL]).notTo(beNil());
+		expect([cache openRepositoryAtURL:repositoryURL flags:0 ceilingDirs:nil error:NULL]).notTo(beNil());
+		expect(@(cache.count)).to(equal(@2));
+
+		[cache removeEntryForURL:nestedURL];
+		expect(@(cache.count)).to(equal(@1));
+
+		[cache removeAllEntries];
+		expect(@(cache.count)).to(equal(@0));
+	});
+});
+
+afterEach(^{
+	[self tearDown];
+});
+
+QuickSpecEnd
@@ -0,0 +1,104 @@
+//
+//  GTRepositoryPoolSpec.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+@import ObjectiveGit;
+@import Nimble;
+@import Quick;
+
+#import "QuickSpec+GTFixtures.h"
+
+QuickSpecBegin(GTRepositoryPoolSpec)
+
+__block NSURL *repositoryURL;
+
+beforeEach(^{
+	repositoryURL = self.testAppFixtureRepository.fileURL;
+	expect(repositoryURL).notTo(beNil());
+});
+
+it(@"should reuse returned repositories", ^{
+	GTRepositoryPool *pool = [[GTRepositoryPool alloc] init];
+
+	NSError *error = nil;
+	GTRepository *repository = [pool leaseRepositoryAtURL:repositoryURL error:&error];
+	expect(repository).notTo(beNil());
+	expect(error).to(beNil());
+	expect(@(pool.openCount)).to(equal(@1));
+
+	[pool returnRepository:repository];
+	expect(@(pool.idleCount)).to(equal(@1));
+
+	GTRepository *reused = [pool leaseRepositoryAtURL:repositoryURL error:NULL];
+	expect(@(reused == repository)).to(beTruthy());
+	expect(@(pool.idleCount)).to(equal(@0));
+	expect(@(pool.openCount)).to(equal(@1));
+	expect(@(pool.leaseCount)).to(equal(@2));
+	expect(@(pool.reuseCount)).to(equal(@1));
+	expect(@(pool.totalLeaseDuration)).to(beGreaterThanOrEqualTo(@(pool.totalOpenDuration)));
+});
+
+it(@"should open separate repositories for concurrent leases", ^{
+	GTRepositoryPool *pool = [[GTRepositoryPool alloc] init];
+
+	GTRepository *first = [pool leaseRepositoryAtURL:repositoryURL error:NULL];
+	GTRepository *second = [pool leaseRepositoryAtURL:repositoryURL error:NULL];
+	expect(first).notTo(beNil());
+	expect(second).notTo(beNil());
+	expect(@(first == second)).to(beFalsy());
+	expect(@(pool.openCount)).to(equal(@2));
+
+	expect(second.gitDirectoryURL).to(equal(first.gitDirectoryURL));
+	expect(second.fileURL).to(equal(first.fileURL));
+
+	GTCommit *firstHEAD = [first lookUpObjectByRevParse:@"HEAD" error:NULL];
+	GTCommit *secondHEAD = [second lookUpObjectByRevParse:@"HEAD" error:NULL];
+	expect(secondHEAD.OID).to(equal(firstHEAD.OID));
+});
+
+it(@"should only keep as many idle repositories as allowed", ^{
+	GTRepositoryPool *pool = [[GTRepositoryPool alloc] initWithMaximumIdleRepositoriesPerURL:1];
+
+	GTRepository *first = [pool leaseRepositoryAtURL:repositoryURL error:NULL];
+	GTRepository *second = [pool leaseRepositoryAtURL:repositoryURL error:NULL];
+	[pool returnRepository:first];
+	[pool returnRepository:second];
+	expect(@(pool.idleCount)).to(equal(@1));
+
+	[pool removeIdleRepositories];
+	expect(@(pool.idleCount)).to(equal(@0));
+});
+
+it(@"should lease a repository for a block", ^{
+	GTRepositoryPool *pool = [[GTRepositoryPool alloc] init];
+
+	__block GTRepository *leased = nil;
+	NSError *error = nil;
+	BOOL success = [pool performWithRepositoryAtURL:repositoryURL error:&error block:^(GTRepository *repository, NSError **blockError) {
+		leased = repository;
+		return YES;
+	}];
+	expect(@(success)).to(beTruthy());
+	expect(error).to(beNil());
+	expect(leased).notTo(beNil());
+	expect(@(pool.idleCount)).to(equal(@1));
+});
+
+it(@"should fail to lease a repository which doesn't exist", ^{
+	GTRepositoryPool *pool = [[GTRepositoryPool alloc] init];
+
+	NSError *error = nil;
+	NSURL *URL = [self.tempDirectoryFileURL URLByAppendingPathComponent:@"missing-repository"];
+	expect([pool leaseRepositoryAtURL:URL error:&error]).to(beNil());
+	expect(error).notTo(beNil());
+	expect(@(pool.leaseCount)).to(equal(@0));
+});
+
+afterEach(^{
+	[self tearDown];
+});
+
+QuickSpecEnd
@@ -0,0 +1,165 @@
+//
+//  GTRepositoryScannerSpec.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+@import ObjectiveGit;
+@import Nimble;
+@import Quick;
+
+#import "QuickSpec+GTFixtures.h"
+
+QuickSpecBegin(GTRepositoryScannerSpec)
+
+__block NSURL *rootURL;
+__block GTRepository *clone;
+__block GTRepositoryScanner *scanner;
+
+// Runs a scan to completion, and returns its results keyed by path.
+NSDictionary<NSString *, GTRepositoryScanResult *> * (^scan)(GTCancellationToken *, NSError **) = ^(GTCancellationToken *cancellationToken, NSError **error) {
+	NSMutableDictionary *results = [NSMutableDictionary dictionary];
+	__block NSError *scanError = nil;
+	waitUntil(^(void (^done)(void)) {
+		[scanner scanWithCancellationToken:cancellationToken resultBlock:^(GTRepositoryScanResult *result) {
+			results[result.fileURL.URLByStandardizingPath.path] = result;
+		} completion:^(NSUInteger repositoryCount, NSError *completionError) {
+			scanError = completionError;
+			done();
+		}];
+	});
+
+	if (error != NULL) *error = scanError;
+	return results;
+};
+
+beforeEach(^{
+	rootURL = [self.tempDirectoryFileURL URLByAppendingPathComponent:@"scan" isDirectory:YES];
+
+	NSURL *cloneURL = [rootURL URLByAppendingPathComponent:@"clone" isDirectory:YES];
+	clone = [GTRepository cloneFromURL:self.bareFixtureRepository.gitDirectoryURL toWorkingDirectory:cloneURL options:@{ GTRepositoryCloneOptionsCloneLocal: @YES } error:NULL transferProgressBlock:nil];
+	expect(clone).notTo(beNil());
+
+	expect([GTRepository initializeEmptyRepositoryAtFileURL:[rootURL URLByAppendingPathComponent:@"blank"] options:nil error:NULL]).notTo(beNil());
+	expect([GTRepository initializeEmptyRepositoryAtFileURL:[rootURL URLByAppendingPathComponent:@"blank.git"] options:@{ GTRepositoryInitOptionsFlags: @(GTRepositoryInitBare | GTRepositoryInitCreatingRepositoryDirectory) } error:NULL]).notTo(beNil());
+	expect([GTRepository initializeEmptyRepositoryAtFileURL:[cloneURL URLByAppendingPathComponent:@"vendor/nested"] options:@{ GTRepositoryInitOptionsFlags: @(GTRepositoryInitCreatingRepositoryDirectory) } error:NULL]).notTo(beNil());
+	expect(@([NSFileManager.defaultManager createDirectoryAtURL:[rootURL URLByAppendingPathComponent:@"plain/directory"] withIntermediateDirectories:YES attributes:nil error:NULL])).to(beTruthy());
+
+	scanner = [[GTRepositoryScanner alloc] initWithRootURL:rootURL];
+});
+
+it(@"should find every top level repository", ^{
+	NSError *error = nil;
+	NSDictionary *results = scan(nil, &error);
+	expect(error).to(beNil());
+
+	NSArray *names = [[results.allKeys valueForKey:@"lastPathComponent"] sortedArrayUsingSelector:@selector(compare:)];
+	expect(names).to(equal(@[ @"blank", @"blank.git", @"clone" ]));
+
+	for (GTRepositoryScanResult *result in results.allValues) {
+		expect(result.error).to(beNil());
+		expect(@(result.timedOut)).to(beFalsy());
+		expect(@(result.completedProbes)).to(equal(@(GTRepositoryScannerProbeAll)));
+	}
+});
+
+it(@"should find nested repositories when asked to", ^{
+	scanner.scansNestedRepositories = YES;
+
+	NSDictionary *results = scan(nil, NULL);
+	expect(@(results.count)).to(equal(@4));
+	expect(results[[clone.fileURL URLByAppendingPathComponent:@"vendor/nested"].URLByStandardizingPath.path]).notTo(beNil());
+});
+
+it(@"should probe a repository", ^{
+	GTBranch *currentBranch = [clone currentBranchWithError:NULL];
+	expect(currentBranch).notTo(beNil());
+
+	GTRepositoryScanResult *result = scan(nil, NULL)[clone.fileURL.URLByStandardizingPath.path];
+	expect(result).notTo(beNil());
+	expect(result.gitDirectoryURL.URLByStandardizingPath).to(equal(clone.gitDirectoryURL.URLByStandardizingPath));
+	expect(result.HEADBranchName).to(equal(currentBranch.shortName));
+	expect(result.HEADOID).to(equal(currentBranch.OID));
+	expect(result.branchNames).to(contain(currentBranch.shortName));
+	expect(@(result.workingDirectoryClean)).to(beTruthy());
+	expect(result.upstreamName).to(equal([@"refs/remotes/origin/" stringByAppendingString:currentBranch.shortName]));
+	expect(@(result.ahead)).to(equal(@0));
+	expect(@(result.behind)).to(equal(@0));
+	expect(@(result.stashCount)).to(equal(@0));
+});
+
+it(@"should notice a dirty working directory", ^{
+	NSURL *fileURL = [clone.fileURL URLByAppendingPathComponent:@"untracked.txt"];
+	expect(@([@"untracked" writeToURL:fileURL atomically:YES encoding:NSUTF8StringEncoding error:NULL])).to(beTruthy());
+
+	scanner.probes = GTRepositoryScannerProbeWorkingDirectoryClean;
+
+	GTRepositoryScanResult *result = scan(nil, NULL)[clone.fileURL.URLByStandardizingPath.path];
+	expect(@(result.completedProbes)).to(equal(@(GTRepositoryScannerProbeWorkingDirectoryClean)));
+	expect(@(result.workingDirectoryClean)).to(beFalsy());
+	expect(result.HEADBranchName).to(beNil());
+	expect(@(result.stashCount)).to(equal(@(NSNotFound)));
+});
+
+it(@"should notice a staged change", ^{
+	NSURL *fileURL = [clone.fileURL URLByAppendingPathComponent:@"staged.txt"];
+	expect(@([@"staged" writeToURL:fileURL atomically:YES encoding:NSUTF8StringEncoding error:NULL])).to(beTruthy());
+
+	GTIndex *index = [clone indexWithError:NULL];
+	expect(@([index addFile:@"staged.txt" error:NULL])).to(beTruthy());
+	expect(@([index write:NULL])).to(beTruthy());
+
+	scanner.probes = GTRepositoryScannerProbeWorkingDirectoryClean;
+
+	GTRepositoryScanResult *result = scan(nil, NULL)[clone.fileURL.URLByStandardizingPath.path];
+	expect(@(result.completedProbes)).to(equal(@(GTRepositoryScannerProbeWorkingDirectoryClean)));
+	expect(@(result.workingDirectoryClean)).to(beFalsy());
+});
+
+it(@"should report unborn repositories", ^{
+	GTRepositoryScanResult *result = scan(nil, NULL)[[rootURL URLByAppendingPathComponent:@"blank"].URLByStandardizingPath.path];
+	expect(result.error).to(beNil());
+	expect(result.HEADOID).to(beNil());
+	expect(result.branchNames).to(equal(@[]));
+	expect(@(result.workingDirectoryClean)).to(beTruthy());
+	expect(@(result.ahead)).to(equal(@(NSNotFound)));
+});
+
+it(@"should skip probes once the timeout has passed", ^{
+	scanner.timeout = DBL_MIN;
+
+	NSDictionary *results = scan(nil, NULL);
+	expect(@(results.count)).to(equal(@3));
+
+	for (GTRepositoryScanResult *result in results.allValues) {
+		expect(@(result.timedOut)).to(beTruthy());
+		expect(@(result.completedProbes)).notTo(equal(@(GTRepositoryScannerProbeAll)));
+		expect(result.error).to(beNil());
+	}
+});
+
+it(@"should stop when cancelled", ^{
+	GTCancellationToken *token = [[GTCancellationToken alloc] init];
+	[token cancel];
+
+	NSError *error = nil;
+	NSDictionary *results = scan(token, &error);
+	expect(@(results.count)).to(equal(@0));
+	expect(error.domain).to(equal(NSCocoaErrorDomain));
+	expect(@(error.code)).to(equal(@(NSUserCancelledError)));
+});
+
+it(@"should fail for a missing root", ^{
+	scanner = [[GTRepositoryScanner alloc] initWithRootURL:[rootURL URLByAppendingPathComponent:@"missing"]];
+
+	NSError *error = nil;
+	expect(@(scan(nil, &error).count)).to(equal(@0));
+	expect(error).notTo(beNil());
+});
+
+afterEach(^{
+	[self tearDown];
+});
+
+QuickSpecEnd
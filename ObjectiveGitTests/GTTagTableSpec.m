@@ -0,0 +1,114 @@
+//
+//  GTTagTableSpec.m
+//  ObjectiveGitFramework
+//
+//  Copyright (c) 2026 GitHub, Inc. All rights reserved.
+//
+
+@import ObjectiveGit;
+@import Nimble;
+@import Quick;
+
+#import "QuickSpec+GTFixtures.h"
+
+QuickSpecBegin(GTTagTableSpec)
+
+__block GTRepository *repository;
+__block GTCommit *HEADCommit;
+__block GTTag *annotatedTag;
+
+// Writes every reference into packed-refs, with peeled tags.
+void (^packReferences)(void) = ^{
+	git_refdb *refdb = NULL;
+	expect(@(git_repository_refdb(&refdb, repository.git_repository))).to(equal(@(GIT_OK)));
+	expect(@(git_refdb_compress(refdb))).to(equal(@(GIT_OK)));
+	git_refdb_free(refdb);
+};
+
+beforeEach(^{
+	repository = self.testAppFixtureRepository;
+	expect(repository).notTo(beNil());
+
+	HEADCommit = [repository lookUpObjectByRevParse:@"HEAD" error:NULL];
+	expect(HEADCommit).notTo(beNil());
+
+	GTSignature *tagger = [[GTSignature alloc] initWithName:@"Tagger" email:@"tagger@example.com" time:[NSDate date]];
+	annotatedTag = [repository createTagNamed:@"annotated" target:HEADCommit tagger:tagger message:@"Annotated\n" error:NULL];
+	expect(annotatedTag).notTo(beNil());
+	expect([repository createTagNamed:@"nested" target:annotatedTag tagger:tagger message:@"Nested\n" error:NULL]).notTo(beNil());
+	expect(@([repository createLightweightTagNamed:@"lightweight" target:HEADCommit error:NULL])).to(beTruthy());
+});
+
+it(@"should list every tag with its target", ^{
+	NSError *error = nil;
+	GTTagTable *table = [GTTagTable tagTableWithRepository:repository error:&error];
+	expect(table).notTo(beNil());
+	expect(error).to(beNil());
+
+	NSArray *expectedNames = [[[repository referenceNamesWithError:NULL] filteredArrayUsingPredicate:[NSPredicate predicateWithFormat:@"SELF BEGINSWITH 'refs/tags/'"]] sortedArrayUsingSelector:@selector(compare:)];
+	expect([table.tags valueForKey:@"name"]).to(equal(expectedNames));
+
+	for (GTTagTableEntry *entry in table.tags) {
+		GTObject *object = [repository lookUpObjectByOID:entry.OID error:NULL];
+		GTObject *target = ([object isKindOfClass:GTTag.class] ? [(GTTag *)object objectByPeelingTagError:NULL] : object);
+		expect(entry.targetOID).to(equal(target.OID));
+		expect(@(entry.annotated)).to(equal(@([object isKindOfClass:GTTag.class])));
+	}
+
+	GTTagTableEntry *nested = [table tagWithName:@"refs/tags/nested"];
+	expect(nested.shortName).to(equal(@"nested"));
+	expect(nested.targetOID).to(equal(HEADCommit.OID));
+	expect(@(nested.annotated)).to(beTruthy());
+
+	GTTagTableEntry *lightweight = [table tagWithName:@"refs/tags/lightweight"];
+	expect(lightweight.OID).to(equal(HEADCommit.OID));
+	expect(@(lightweight.annotated)).to(beFalsy());
+
+	expect([[table tagsWithTargetOID:HEADCommit.OID] valueForKey:@"shortName"]).to(contain(@"annotated", @"lightweight", @"nested"));
+	expect([table tagWithName:@"refs/tags/missing"]).to(beNil());
+});
+
+it(@"should use peeled targets from packed-refs", ^{
+	GTTagTable *looseTable = [GTTagTable tagTableWithRepository:repository error:NULL];
+	expect(@(looseTable.readObjectCount)).to(beGreaterThan(@0));
+
+	packReferences();
+
+	GTTagTable *packedTable = [GTTagTable tagTableWithRepository:repository error:NULL];
+	expect(packedTable).notTo(beNil());
+	expect(@(packedTable.readObjectCount)).to(equal(@0));
+	expect([packedTable.tags valueForKey:@"targetOID"]).to(equal([looseTable.tags valueForKey:@"targetOID"]));
+	expect([packedTable.tags valueForKey:@"annotated"]).to(equal([looseTable.tags valueForKey:@"annotated"]));
+});
+
+it(@"should only read tags which changed since they were packed", ^{
+	packReferences();
+
+	GTCommit *parent = HEADCommit.parents.firstObject;
+	expect(parent).notTo(beNil());
+	expect([[repository lookUpReferenceWithName:@"refs/tags/lightweight" error:NULL] referenceByUpdatingTarget:parent.SHA message:nil error:NULL]).notTo(beNil());
+
+	GTTagTable *table = [GTTagTable tagTableWithRepository:repository error:NULL];
+	expect(@(table.readObjectCount)).to(equal(@1));
+	expect([table tagWithName:@"refs/tags/lightweight"].targetOID).to(equal(parent.OID));
+});
+
+it(@"should look up tag objects on demand", ^{
+	GTTagTable *table = [GTTagTable tagTableWithRepository:repository error:NULL];
+
+	NSError *error = nil;
+	GTTag *tag = [[table tagWithName:@"refs/tags/annotated"] tagWithError:&error];
+	expect(tag).notTo(beNil());
+	expect(error).to(beNil());
+	expect(tag.OID).to(equal(annotatedTag.OID));
+	expect(tag.message).to(equal(@"Annotated\n"));
+
+	expect([[table tagWithName:@"refs/tags/lightweight"] tagWithError:&error]).to(beNil());
+	expect(error).to(beNil());
+});
+
+afterEach(^{
+	[self tearDown];
+});
+
+QuickSpecEnd